@@ -0,0 +1,95 @@
+#include <AutoDiff/Core>
+#include <AutoDiff/Eigen>
+
+#include <Eigen/Core>
+
+#include <catch2/benchmark/catch_benchmark.hpp>
+#include <catch2/benchmark/catch_chronometer.hpp>
+#include <catch2/catch_test_macros.hpp>
+
+#include <cstddef>
+
+using AutoDiff::Function;
+using AutoDiff::var;
+
+// The per-column and per-row loops that the Products module used before
+// batching the derivative slices into few large GEMMs, for comparison.
+
+namespace {
+
+auto pushForwardByLoop(Eigen::MatrixXd const& yDerivative,
+    Eigen::MatrixXd const& xValue,
+    Eigen::MatrixXd const& yValue) -> Eigen::MatrixXd
+{
+    auto const derivCols = yDerivative.cols();
+    auto deriv = Eigen::MatrixXd(xValue.rows() * yValue.cols(), derivCols);
+    for (std::ptrdiff_t j = 0; j != derivCols; ++j) {
+        deriv.col(j)
+            = (xValue
+                * yDerivative.col(j).reshaped(yValue.rows(), yValue.cols()))
+                  .reshaped();
+    }
+    return deriv;
+}
+
+auto pullBackByLoop(Eigen::MatrixXd const& derivative,
+    Eigen::MatrixXd const& xValue,
+    Eigen::MatrixXd const& yValue) -> Eigen::MatrixXd
+{
+    auto const derivRows = derivative.rows();
+    auto deriv           = Eigen::MatrixXd(derivRows, xValue.size());
+    for (std::ptrdiff_t i = 0; i != derivRows; ++i) {
+        auto const matricized
+            = derivative.row(i).reshaped(xValue.rows(), yValue.cols());
+        deriv.row(i) = (matricized * yValue.transpose()).reshaped();
+    }
+    return deriv;
+}
+
+} // namespace
+
+TEST_CASE("Benchmark matrix products", "[benchmark,Eigen]")
+{
+    // a linear layer W * X applied to a batch of 16 inputs
+    // (the functions also seed and store the derivatives)
+    auto const weights = Eigen::MatrixXd::Constant(32, 64, 0.5).eval();
+    auto const inputs  = Eigen::MatrixXd::Constant(64, 16, 2.0).eval();
+    auto const outputs = (weights * inputs).eval();
+
+    BENCHMARK_ADVANCED("Pushing forward by per-column loop")
+    (Catch::Benchmark::Chronometer meter)
+    {
+        auto const tangent
+            = Eigen::MatrixXd::Identity(inputs.size(), inputs.size()).eval();
+        meter.measure(
+            [&] { return pushForwardByLoop(tangent, weights, inputs); });
+    };
+    BENCHMARK_ADVANCED("Pushing forward by GEMM")
+    (Catch::Benchmark::Chronometer meter)
+    {
+        auto X = var(inputs);
+        auto Z = var(weights * X);
+        auto f = Function(from(X), to(Z));
+        f.evaluate();
+
+        meter.measure([&] { f.pushTangentAt(X); });
+    };
+    BENCHMARK_ADVANCED("Pulling back by per-row loop")
+    (Catch::Benchmark::Chronometer meter)
+    {
+        auto const gradient
+            = Eigen::MatrixXd::Identity(outputs.size(), outputs.size()).eval();
+        meter.measure(
+            [&] { return pullBackByLoop(gradient, weights, inputs); });
+    };
+    BENCHMARK_ADVANCED("Pulling back by GEMM")
+    (Catch::Benchmark::Chronometer meter)
+    {
+        auto W = var(weights);
+        auto Z = var(W * inputs);
+        auto f = Function(from(W), to(Z));
+        f.evaluate();
+
+        meter.measure([&] { f.pullGradientAt(Z); });
+    };
+}
@@ -22,6 +22,17 @@ TEST_CASE("Benchmark sigmoid", "[benchmark,Eigen]")
             return z;
         });
     };
+    BENCHMARK_ADVANCED("Building expression in lazy scope")
+    (Catch::Benchmark::Chronometer meter)
+    {
+        meter.measure([] {
+            auto lazy = AutoDiff::LazyScope();
+            auto x    = var(Eigen::ArrayXd::Constant(1000, 0.5));
+            auto k    = var(Eigen::ArrayXd::Constant(1000, 4.0));
+            auto z    = var(1 / (1 + exp(-k * x)));
+            return z;
+        });
+    };
     BENCHMARK_ADVANCED("Compiling function")
     (Catch::Benchmark::Chronometer meter)
     {
@@ -95,6 +106,17 @@ TEST_CASE("Benchmark sigmoid", "[benchmark,Eigen]")
 
         meter.measure([&] { f.pullGradientAt(z); });
     };
+    BENCHMARK_ADVANCED("Pulling back with cached subexpression")
+    (Catch::Benchmark::Chronometer meter)
+    {
+        auto x = var(Eigen::ArrayXd::Constant(1000, 0.5));
+        auto k = var(Eigen::ArrayXd::Constant(1000, 4.0));
+        auto z = var(1 / (1 + cache(exp(-k * x))));
+        auto f = Function(z);
+        f.evaluate();
+
+        meter.measure([&] { f.pullGradientAt(z); });
+    };
     BENCHMARK_ADVANCED("Pulling back with intermediate variable 2")
     (Catch::Benchmark::Chronometer meter)
     {
@@ -108,3 +130,51 @@ TEST_CASE("Benchmark sigmoid", "[benchmark,Eigen]")
         meter.measure([&] { f.pullGradientAt(z); });
     };
 }
+
+TEST_CASE("Benchmark elementwise Jacobians", "[benchmark,Eigen]")
+{
+    using Structured = AutoDiff::EigenAD::StructuredMatrix<double>;
+
+    BENCHMARK_ADVANCED("Pushing forward dense Jacobians")
+    (Catch::Benchmark::Chronometer meter)
+    {
+        auto x = var(Eigen::VectorXd::Constant(300, 0.5).eval());
+        auto z = var(exp(x) + square(x) - x);
+        auto f = Function(z);
+        f.evaluate();
+
+        meter.measure([&] { f.pushTangentAt(x); });
+    };
+    BENCHMARK_ADVANCED("Pushing forward structured Jacobians")
+    (Catch::Benchmark::Chronometer meter)
+    {
+        auto x = AutoDiff::Variable<Eigen::VectorXd, Structured>(
+            Eigen::VectorXd::Constant(300, 0.5));
+        auto z = var(exp(x) + square(x) - x);
+        auto f = Function(z);
+        f.evaluate();
+
+        meter.measure([&] { f.pushTangentAt(x); });
+    };
+    BENCHMARK_ADVANCED("Pulling back dense Jacobians")
+    (Catch::Benchmark::Chronometer meter)
+    {
+        auto x = var(Eigen::VectorXd::Constant(300, 0.5).eval());
+        auto z = var(exp(x) + square(x) - x);
+        auto f = Function(z);
+        f.evaluate();
+
+        meter.measure([&] { f.pullGradientAt(z); });
+    };
+    BENCHMARK_ADVANCED("Pulling back structured Jacobians")
+    (Catch::Benchmark::Chronometer meter)
+    {
+        auto x = AutoDiff::Variable<Eigen::VectorXd, Structured>(
+            Eigen::VectorXd::Constant(300, 0.5));
+        auto z = var(exp(x) + square(x) - x);
+        auto f = Function(z);
+        f.evaluate();
+
+        meter.measure([&] { f.pullGradientAt(z); });
+    };
+}
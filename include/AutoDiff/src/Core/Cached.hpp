@@ -0,0 +1,138 @@
+// Copyright (c) 2024 Matthias Krippner
+//
+// This software is released under the MIT License.
+// https://opensource.org/licenses/MIT
+
+#ifndef AUTODIFF_SRC_CORE_CACHED_HPP
+#define AUTODIFF_SRC_CORE_CACHED_HPP
+
+#include "../internal/TypeImpl.hpp"
+#include "../internal/traits.hpp"
+#include "Expression.hpp"
+#include "UnaryOperation.hpp"
+
+#include <type_traits> // is_same
+
+namespace AutoDiff {
+
+namespace internal {
+
+    /**
+     * @brief A value that is computed at most once per evaluation.
+     *
+     * Operations that compute their value into new storage (e.g., a matrix
+     * that is not a lazy expression of their operands) keep it here and
+     * return it by reference, since expressions of the value would dangle
+     * if it was returned by value.
+     * The value is outdated when the cache of the operation is released.
+     * Values computed as expressions are assigned to the kept storage, so
+     * that repeated evaluations do not reallocate; computed values are moved.
+     *
+     * @tparam Value    the evaluated type of the value
+     */
+    template <typename Value>
+    class CachedValue {
+    public:
+        /**
+         * @brief The value, computed if outdated.
+         *
+         * @param  value   a function returning the value (or an expression)
+         */
+        template <typename ValueFn>
+        auto operator()(ValueFn const& value) -> Value const&
+        {
+            if (!mIsCached) {
+                if constexpr (std::is_same_v<decltype(value()), Value>) {
+                    mValue = value();
+                } else {
+                    assign(mValue, value());
+                }
+                mIsCached = true;
+            }
+            return mValue;
+        }
+
+        void release() { mIsCached = false; }
+
+    private:
+        Value mValue{};
+        bool mIsCached{false};
+    };
+
+} // namespace internal
+
+/**
+ * @class Cached
+ * @brief Memoizes the value of a subexpression.
+ *
+ * Operations compute the values of their operands on demand, so that
+ * differentiating a deep expression re-evaluates its subexpressions
+ * many times.
+ * This operation stores the value of its operand when it is first computed
+ * and returns the stored value until the cache is released.
+ * The evaluator of a variable releases the cache before every evaluation,
+ * so that the values computed during evaluation are reused in the
+ * subsequent forward- and reverse-mode passes.
+ *
+ * Unlike an intermediate variable, the cache does not add a node to the
+ * computation graph and does not store a derivative.
+ *
+ * @code{.cpp}
+ * auto z = var(1 / (1 + cache(exp(-k * x)))); // exp is evaluated once
+ * @endcode
+ *
+ * @tparam X        the derived class of the operand
+ */
+template <typename X>
+class Cached : public UnaryOperation<Cached<X>, X> {
+public:
+    using Base  = UnaryOperation<Cached<X>, X>;
+    using Value = internal::Evaluated_t<ValueType_t<X>>;
+    using Base::Base;
+
+    // Expression implementation ===============================================
+
+    // Must return Value by reference to avoid dangling references to
+    // temporaries in expressions!
+    [[nodiscard]] auto _valueImpl() -> Value const&
+    {
+        return mValue([&]() -> decltype(auto) { return Base::xValue(); });
+    }
+
+    [[nodiscard]] auto _pushForwardImpl() -> decltype(auto)
+    {
+        return Base::xPushForward();
+    }
+
+    template <typename Derivative>
+    void _pullBackImpl(Derivative const& derivative)
+    {
+        Base::xPullBack(derivative);
+    }
+
+    void _releaseCacheImpl()
+    {
+        // keep the storage to avoid reallocation in the next evaluation
+        mValue.release();
+        Base::_releaseCacheImpl();
+    }
+
+private:
+    internal::CachedValue<Value> mValue;
+};
+
+/**
+ * @brief Memoize the value of an expression.
+ *
+ * @tparam X            the type of the expression
+ * @param  expression   the expression whose value is cached
+ */
+template <typename X>
+auto cache(Expression<X> const& expression) -> Cached<X>
+{
+    return Cached<X>(expression);
+}
+
+} // namespace AutoDiff
+
+#endif // AUTODIFF_SRC_CORE_CACHED_HPP
@@ -118,6 +118,8 @@ public:
     /**
      * @brief Release temporary data that has been cached during evaluation.
      *
+     * Called before every evaluation, such that values cached during the
+     * previous evaluation (see @c Cached) are recomputed.
      * Needed, e.g., for the Python bindings, where every operation
      * must temporarily cache its result.
      */
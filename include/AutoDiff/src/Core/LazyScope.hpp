@@ -0,0 +1,65 @@
+// Copyright (c) 2024 Matthias Krippner
+//
+// This software is released under the MIT License.
+// https://opensource.org/licenses/MIT
+
+#ifndef AUTODIFF_SRC_CORE_LAZY_SCOPE_HPP
+#define AUTODIFF_SRC_CORE_LAZY_SCOPE_HPP
+
+namespace AutoDiff {
+
+/**
+ * @class LazyScope
+ * @brief Disables eager evaluation of variables during its lifetime.
+ *
+ * By default, a variable evaluates a new expression immediately.
+ * When a large graph is built and then evaluated by a @c Function,
+ * the eager evaluation is redundant.
+ * While a @c LazyScope object exists, expressions assigned to variables
+ * on the same thread are not evaluated until the next evaluation of a
+ * @c Function (or variable).
+ * Eager evaluation remains enabled outside the scope and on other threads.
+ *
+ * Scopes can be nested; eager evaluation is re-enabled when the outermost
+ * scope ends.
+ *
+ * @code{.cpp}
+ * {
+ *     auto lazy = LazyScope();
+ *     auto u    = var(x * 2); // not evaluated
+ * }
+ * auto v = var(x * 3);        // evaluated eagerly
+ * @endcode
+ *
+ * @note Defining the macro @c AUTODIFF_NO_EAGER_EVALUATION disables eager
+ * evaluation regardless of this scope.
+ */
+class LazyScope {
+public:
+    LazyScope() { ++depth(); }
+
+    ~LazyScope() { --depth(); }
+
+    // a scope is bound to the thread and lifetime of its creator
+    LazyScope(LazyScope const&)                    = delete;
+    LazyScope(LazyScope&&)                         = delete;
+    auto operator=(LazyScope const&) -> LazyScope& = delete;
+    auto operator=(LazyScope&&) -> LazyScope&      = delete;
+
+    /**
+     * @brief Whether a lazy scope is active on the current thread.
+     */
+    [[nodiscard]] static auto isActive() -> bool { return depth() > 0; }
+
+private:
+    // number of nested scopes on the current thread
+    static auto depth() -> int&
+    {
+        thread_local int depth = 0;
+        return depth;
+    }
+};
+
+} // namespace AutoDiff
+
+#endif // AUTODIFF_SRC_CORE_LAZY_SCOPE_HPP
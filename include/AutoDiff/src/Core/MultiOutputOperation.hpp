@@ -0,0 +1,151 @@
+// Copyright (c) 2024 Matthias Krippner
+//
+// This software is released under the MIT License.
+// https://opensource.org/licenses/MIT
+
+#ifndef AUTODIFF_SRC_CORE_MULTI_OUTPUT_OPERATION_HPP
+#define AUTODIFF_SRC_CORE_MULTI_OUTPUT_OPERATION_HPP
+
+#include "../internal/JointComputation.hpp"
+#include "Expression.hpp"
+#include "LazyScope.hpp"
+#include "Variable.hpp"
+
+#include <array>
+#include <cstddef> // size_t
+#include <memory>
+#include <tuple>
+#include <utility> // index_sequence
+
+namespace AutoDiff {
+
+/**
+ * @class MultiOutputOperation
+ * @brief Auxiliary base class for operations with several outputs computed
+ * by one kernel, e.g., matrix decompositions.
+ *
+ * The outputs are separate variables backed by one shared computation node,
+ * which evaluates the kernel once for all outputs (see @c outputVariables).
+ *
+ * A subclass can simply reuse the constructor "using Base::Base".
+ * The derived class must implement the public functions
+ * @c _valueImpl       (returning a tuple of the output values),
+ * @c _pushForwardImpl (returning a tuple of the output tangents), and
+ * @c _pullBackImpl    (pulling back the gradients of all outputs at once).
+ * The pullback receives an array of pointers to the gradients of the outputs,
+ * which are null for outputs without gradient (e.g., outputs that are not
+ * part of the differentiated function).
+ *
+ * @tparam X        the derived class of the operand
+ * @tparam Outputs  the value types of the outputs
+ */
+template <typename X, typename... Outputs>
+class MultiOutputOperation {
+public:
+    using Derivative = typename X::Derivative; // propagate the derivative type
+    using Values     = std::tuple<Outputs...>;
+
+    static constexpr std::size_t outputCount = sizeof...(Outputs);
+
+    // The gradients of the outputs, null for outputs without gradient
+    using Gradients = std::array<Derivative const*, outputCount>;
+
+    /**
+     * @brief Create an operation that stores a copy of the operand.
+     *
+     * @param  operand     the operand
+     */
+    explicit MultiOutputOperation(Expression<X> const& operand)
+        : mOperand{operand.derived()}
+    {
+    }
+
+    void _transferChildrenToImpl(internal::Node& node)
+    {
+        mOperand._transferChildrenTo(node);
+    }
+
+    void _releaseCacheImpl() { mOperand._releaseCache(); }
+
+protected:
+    ~MultiOutputOperation() = default;
+
+    MultiOutputOperation(MultiOutputOperation const&)                = default;
+    MultiOutputOperation(MultiOutputOperation&&) noexcept            = default;
+    auto operator=(MultiOutputOperation const&) -> MultiOutputOperation&
+        = default;
+    auto operator=(MultiOutputOperation&&) noexcept -> MultiOutputOperation&
+        = default;
+
+    /**
+     * @brief Compute the value of the operand.
+     */
+    auto xValue() -> decltype(auto) { return mOperand._value(); }
+
+    /**
+     * @brief Compute the pushforward by the operand.
+     */
+    auto xPushForward() -> decltype(auto) { return mOperand._pushForward(); }
+
+    /**
+     * @brief Pull back the gradient by the operand.
+     */
+    template <typename OtherDerivative>
+    void xPullBack(OtherDerivative const& derivative)
+    {
+        mOperand._pullBack(derivative);
+    }
+
+private:
+    X mOperand;
+};
+
+namespace detail {
+
+    template <typename Operation, std::size_t... K>
+    auto makeOutputVariables(
+        std::shared_ptr<internal::JointComputation<Operation>> const& joint,
+        std::index_sequence<K...>)
+    {
+        using Derivative = typename Operation::Derivative;
+        using Values     = typename Operation::Values;
+        return std::make_tuple(
+            Variable<std::tuple_element_t<K, Values>, Derivative>(
+                internal::JointOutput<Operation, K>(joint))...);
+    }
+
+} // namespace detail
+
+/**
+ * @brief Create the output variables of a multi-output operation.
+ *
+ * The variables share one computation node, which evaluates the operation
+ * once for all outputs and pulls back their gradients at once.
+ * The outputs are evaluated immediately (eager evaluation)
+ * unless macro @c AUTODIFF_NO_EAGER_EVALUATION is defined
+ * or a @c LazyScope is active.
+ *
+ * @code{.cpp}
+ * auto [values, vectors] = symmetricEigen(A); // one decomposition
+ * @endcode
+ *
+ * @param  operation   the multi-output operation
+ * @return a tuple of variables, one for each output
+ */
+template <typename Operation>
+auto outputVariables(Operation const& operation)
+{
+    auto const joint
+        = std::make_shared<internal::JointComputation<Operation>>(operation);
+#ifndef AUTODIFF_NO_EAGER_EVALUATION
+    if (!LazyScope::isActive()) {
+        joint->evaluate();
+    }
+#endif
+    return detail::makeOutputVariables(
+        joint, std::make_index_sequence<Operation::outputCount>{});
+}
+
+} // namespace AutoDiff
+
+#endif // AUTODIFF_SRC_CORE_MULTI_OUTPUT_OPERATION_HPP
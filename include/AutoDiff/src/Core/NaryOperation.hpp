@@ -0,0 +1,138 @@
+// Copyright (c) 2024 Matthias Krippner
+//
+// This software is released under the MIT License.
+// https://opensource.org/licenses/MIT
+
+#ifndef AUTODIFF_SRC_CORE_NARY_OPERATION_HPP
+#define AUTODIFF_SRC_CORE_NARY_OPERATION_HPP
+
+#include "Expression.hpp"
+
+#include <cstddef>     // size_t
+#include <tuple>       // apply get tuple tuple_element
+#include <type_traits> // conjunction is_same
+#include <utility>     // index_sequence_for
+
+namespace AutoDiff {
+
+/**
+ * @class NaryOperation
+ * @brief Auxiliary base class for operations depending on any number of
+ * other expressions.
+ *
+ * A subclass can simply reuse the constructor "using Base::Base".
+ * The derived class must implement the public functions
+ * @c _valueImpl       (returning its value),
+ * @c _pushForwardImpl (returning the pushforward of the tangent vector), and
+ * @c _pullBackImpl    (pushing back the gradient).
+ * For details, see the @c Expression class.
+ *
+ * @tparam Derived  the derived class of the expression,
+ *                  e.g. EigenAD::Concatenation<true, X, Y>
+ * @tparam Xs       the derived classes of the operands
+ */
+template <typename Derived, typename... Xs>
+class NaryOperation : public Expression<Derived> {
+public:
+    static_assert(sizeof...(Xs) > 0, "OPERATION REQUIRES AN OPERAND");
+
+    // propagate the derivative type
+    using Derivative =
+        typename std::tuple_element_t<0, std::tuple<Xs...>>::Derivative;
+
+    // The number of operands
+    static constexpr std::size_t operandCount = sizeof...(Xs);
+
+    /**
+     * @brief Create an n-ary operation that stores copies of the operands.
+     *
+     * @note The operands must have the same derivative type.
+     *
+     * @param  operands    the operands
+     */
+    explicit NaryOperation(Expression<Xs> const&... operands)
+        : mOperands{operands.derived()...}
+    {
+        static_assert(
+            std::conjunction_v<
+                std::is_same<Derivative, typename Xs::Derivative>...>,
+            "OPERANDS MUST HAVE THE SAME DERIVATIVE TYPE");
+    }
+
+    // Expression implementation ===============================================
+
+    void _transferChildrenToImpl(internal::Node& node)
+    {
+        std::apply(
+            [&](auto&... operands) {
+                (operands._transferChildrenTo(node), ...);
+            },
+            mOperands);
+    }
+
+    void _releaseCacheImpl()
+    {
+        std::apply(
+            [](auto&... operands) { (operands._releaseCache(), ...); },
+            mOperands);
+    }
+
+protected:
+    ~NaryOperation() = default;
+
+    NaryOperation(NaryOperation const&)                        = default;
+    NaryOperation(NaryOperation&&) noexcept                    = default;
+    auto operator=(NaryOperation const&) -> NaryOperation&     = default;
+    auto operator=(NaryOperation&&) noexcept -> NaryOperation& = default;
+
+    /**
+     * @brief Compute the value of the operand @p K.
+     */
+    template <std::size_t K>
+    auto operandValue() -> decltype(auto)
+    {
+        return std::get<K>(mOperands)._value();
+    }
+
+    /**
+     * @brief Compute the values of all operands.
+     *
+     * References to values are kept, temporary values are stored.
+     */
+    auto operandValues()
+    {
+        return operandValues(std::index_sequence_for<Xs...>());
+    }
+
+    /**
+     * @brief Compute the pushforward by the operand @p K.
+     */
+    template <std::size_t K>
+    auto operandPushForward() -> decltype(auto)
+    {
+        return std::get<K>(mOperands)._pushForward();
+    }
+
+    /**
+     * @brief Pull back the gradient by the operand @p K.
+     */
+    template <std::size_t K, typename Derivative>
+    void operandPullBack(Derivative const& derivative)
+    {
+        std::get<K>(mOperands)._pullBack(derivative);
+    }
+
+private:
+    template <std::size_t... K>
+    auto operandValues(std::index_sequence<K...> /*indices*/)
+    {
+        return std::tuple<decltype(operandValue<K>())...>(
+            operandValue<K>()...);
+    }
+
+    std::tuple<Xs...> mOperands;
+};
+
+} // namespace AutoDiff
+
+#endif // AUTODIFF_SRC_CORE_NARY_OPERATION_HPP
@@ -11,6 +11,7 @@
 #include "../internal/traits.hpp"
 #include "AbstractVariable.hpp"
 #include "Expression.hpp"
+#include "LazyScope.hpp"
 
 #include <algorithm> // swap
 #include <memory>
@@ -75,7 +76,8 @@ public:
      * @brief Create a variable that evaluates an expression of other variables.
      *
      * The expression is immediately evaluated (eager evaluation)
-     * unless macro @c AUTODIFF_NO_EAGER_EVALUATION is defined.
+     * unless macro @c AUTODIFF_NO_EAGER_EVALUATION is defined
+     * or a @c LazyScope is active.
      *
      * @tparam Expr            the type of the expression
      * @param expression       the expression to be evaluated
@@ -120,7 +122,8 @@ public:
      * expression.
      *
      * The new expression is immediately evaluated (eager evaluation)
-     * unless macro @c AUTODIFF_NO_EAGER_EVALUATION is defined.
+     * unless macro @c AUTODIFF_NO_EAGER_EVALUATION is defined
+     * or a @c LazyScope is active.
      *
      * @warning The expression must not contain this variable.
      * If it does, the @c Function it is added to
@@ -153,7 +156,8 @@ public:
      * @brief Assign an expression to replace the current value or expression.
 
      * The new expression is immediately evaluated (eager evaluation)
-     * unless macro @c AUTODIFF_NO_EAGER_EVALUATION is defined.
+     * unless macro @c AUTODIFF_NO_EAGER_EVALUATION is defined
+     * or a @c LazyScope is active.
      *
      * @tparam Expr         the type of the expression
      * @param expression    the expression to be assigned
@@ -163,7 +167,9 @@ public:
     {
         mRef->setExpression(expression);
 #ifndef AUTODIFF_NO_EAGER_EVALUATION
-        mRef->evaluate();
+        if (!LazyScope::isActive()) {
+            mRef->evaluate();
+        }
 #endif
     }
 
@@ -195,6 +201,31 @@ public:
         mRef->setDerivative(std::move(derivative));
     }
 
+    /**
+     * @brief Enable or disable concurrent gradient accumulation.
+     *
+     * Intended for parameters shared by functions that are differentiated
+     * concurrently in reverse mode (Hogwild-style training).
+     * When enabled, the gradients pulled back by all functions are
+     * accumulated in this variable, and the gradient is kept across passes
+     * until it is reset by @c resetGradient.
+     * Enabling the accumulation resets the gradient.
+     *
+     * The accumulated gradient must only be read (and reset)
+     * when no reverse-mode pass is running.
+     *
+     * @param  enabled     whether to accumulate concurrently
+     */
+    void setConcurrentAccumulation(bool enabled) const
+    {
+        mRef->setConcurrentAccumulation(enabled);
+    }
+
+    /**
+     * @brief Reset the gradient to zero.
+     */
+    void resetGradient() const { mRef->resetGradient(); }
+
     // Note: The following functions with leading underscores
     // are not part of the public API.
 
@@ -339,6 +370,17 @@ namespace detail {
         using type       = Variable<Value, Derivative>;
     };
 
+    // identity copies of views own their value
+    template <typename T, typename = void>
+    struct OwnedValue {
+        using type = T;
+    };
+
+    template <typename T>
+    struct OwnedValue<T, std::enable_if_t<internal::isView_v<T>>> {
+        using type = internal::Evaluated_t<T>;
+    };
+
     template <typename T, typename = std::void_t<>>
     struct IsSupportedValue : std::false_type { };
 
@@ -375,7 +417,8 @@ auto var(T const& literal) -> typename detail::VariableFromValue<T>::type
  * @brief Create a variable that evaluates an expression of other variables.
  *
  * The expression is immediately evaluated (eager evaluation)
- * unless macro @c AUTODIFF_NO_EAGER_EVALUATION is defined.
+ * unless macro @c AUTODIFF_NO_EAGER_EVALUATION is defined
+ * or a @c LazyScope is active.
  *
  * @note The value and derivative type of the resulting variable
  * depend on the implementation supplied by a module.
@@ -394,6 +437,8 @@ auto var(Expression<Expr> const& expression) ->
  * @brief Create a variable that depends on another variable
  * through the identity.
  *
+ * The new variable owns a copy of the value if the variable is a view.
+ *
  * @tparam Value           the value type of the variable
  * @tparam Derivative      the derivative type of the variable
  * @param  variable        the variable to depend on
@@ -401,7 +446,8 @@ auto var(Expression<Expr> const& expression) ->
 template <typename Value, typename Derivative>
 auto var(Variable<Value, Derivative> const& variable)
 {
-    Variable<Value, Derivative> newVariable;
+    using OwnedValue = typename detail::OwnedValue<Value>::type;
+    Variable<OwnedValue, Derivative> newVariable;
     newVariable.setExpression(variable);
     return newVariable;
 }
@@ -12,5 +12,6 @@
 
 #include "../../Core/BinaryOperation.hpp"
 #include "../../Core/UnaryOperation.hpp"
+#include "../derivatives.hpp" // promote
 
 #endif // AUTODIFF_SRC_EIGEN_ARRAY_COMMON_HPP
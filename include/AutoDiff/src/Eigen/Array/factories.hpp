@@ -28,7 +28,8 @@
     template <typename X, typename Y>                                          \
     auto operation(Expression<X> const& x, Expression<Y> const& y)             \
         -> std::enable_if_t<EigenAD::hasArrayValue_v<X>                        \
-                                && EigenAD::hasArrayValue_v<Y>,                \
+                                && EigenAD::hasArrayValue_v<Y>                 \
+                                && !EigenAD::hasBroadcastValues_v<X, Y>,       \
             Type<X, Y>>                                                        \
     {                                                                          \
         return Type<X, Y>(x, y);                                               \
@@ -36,14 +37,18 @@
                                                                                \
     template <typename Derived, typename Y>                                    \
     auto operation(Eigen::ArrayBase<Derived> const& x, Expression<Y> const& y) \
-        -> std::enable_if_t<EigenAD::hasArrayValue_v<Y>, Type<Derived, Y>>     \
+        -> std::enable_if_t<EigenAD::hasArrayValue_v<Y>                        \
+                                && !EigenAD::hasBroadcastValues_v<Derived, Y>, \
+            Type<Derived, Y>>                                                  \
     {                                                                          \
         return Type<Derived, Y>(x.derived(), y);                               \
     }                                                                          \
                                                                                \
     template <typename X, typename Derived>                                    \
     auto operation(Expression<X> const& x, Eigen::ArrayBase<Derived> const& y) \
-        -> std::enable_if_t<EigenAD::hasArrayValue_v<X>, Type<X, Derived>>     \
+        -> std::enable_if_t<EigenAD::hasArrayValue_v<X>                        \
+                                && !EigenAD::hasBroadcastValues_v<X, Derived>, \
+            Type<X, Derived>>                                                  \
     {                                                                          \
         return Type<X, Derived>(x, y.derived());                               \
     }
@@ -13,6 +13,7 @@ class Cos : public UnaryOperation<Cos<X>, X> {
 public:
     using Base = UnaryOperation<Cos<X>, X>;
     using Base::Base;
+    using typename Base::Derivative;
 
     [[nodiscard]] auto _valueImpl() -> decltype(auto)
     {
@@ -21,13 +22,15 @@ public:
 
     [[nodiscard]] auto _pushForwardImpl() -> decltype(auto)
     {
-        return (-Base::xValue()).sin() * Base::xPushForward();
+        return (-promote<Derivative>(Base::xValue())).sin()
+             * Base::xPushForward();
     }
 
     template <typename Derivative>
     void _pullBackImpl(Derivative const& derivative)
     {
-        Base::xPullBack(derivative * (-Base::xValue()).sin());
+        Base::xPullBack(
+            derivative * (-promote<Derivative>(Base::xValue())).sin());
     }
 };
 
@@ -13,6 +13,7 @@ class Log : public UnaryOperation<Log<X>, X> {
 public:
     using Base = UnaryOperation<Log<X>, X>;
     using Base::Base;
+    using typename Base::Derivative;
 
     [[nodiscard]] auto _valueImpl() -> decltype(auto)
     {
@@ -21,13 +22,13 @@ public:
 
     [[nodiscard]] auto _pushForwardImpl() -> decltype(auto)
     {
-        return Base::xPushForward() / Base::xValue();
+        return Base::xPushForward() / promote<Derivative>(Base::xValue());
     }
 
     template <typename Derivative>
     void _pullBackImpl(Derivative const& derivative)
     {
-        Base::xPullBack(derivative / Base::xValue());
+        Base::xPullBack(derivative / promote<Derivative>(Base::xValue()));
     }
 };
 
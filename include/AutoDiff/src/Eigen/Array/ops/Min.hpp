@@ -13,6 +13,7 @@ class Min : public UnaryOperation<Min<X>, X> {
 public:
     using Base = UnaryOperation<Min<X>, X>;
     using Base::Base;
+    using typename Base::Derivative;
 
     [[nodiscard]] auto _valueImpl() -> decltype(auto)
     {
@@ -33,7 +34,7 @@ public:
 private:
     [[nodiscard]] auto xDeriv() -> decltype(auto)
     {
-        return Base::xValue().unaryExpr([](auto x) ->
+        return promote<Derivative>(Base::xValue()).unaryExpr([](auto x) ->
             typename Base::Derivative::Scalar { return (x < 0) ? 1 : 0; });
     }
 };
@@ -13,6 +13,7 @@ class Pow : public BinaryOperation<Pow<X, Y>, X, Y> {
 public:
     using Base = BinaryOperation<Pow<X, Y>, X, Y>;
     using Base::Base;
+    using typename Base::Derivative;
 
     [[nodiscard]] auto _valueImpl() -> decltype(auto)
     {
@@ -21,8 +22,8 @@ public:
 
     [[nodiscard]] auto _pushForwardImpl() -> decltype(auto)
     {
-        auto const& xValue = Base::xValue();
-        auto const& yValue = Base::yValue();
+        auto const& xValue = promote<Derivative>(Base::xValue());
+        auto const& yValue = promote<Derivative>(Base::yValue());
 
         if constexpr (!Base::hasOperandX) {
             return xValue.pow(yValue) * xValue.log() * Base::yPushForward();
@@ -37,8 +38,8 @@ public:
     template <typename Derivative>
     void _pullBackImpl(Derivative const& derivative)
     {
-        auto const& xValue = Base::xValue();
-        auto const& yValue = Base::yValue();
+        auto const& xValue = promote<Derivative>(Base::xValue());
+        auto const& yValue = promote<Derivative>(Base::yValue());
 
         if constexpr (Base::hasOperandX) {
             Base::xPullBack(derivative * xValue.pow(yValue - 1) * yValue);
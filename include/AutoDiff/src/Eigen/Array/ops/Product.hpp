@@ -13,6 +13,7 @@ class Product : public BinaryOperation<Product<X, Y>, X, Y> {
 public:
     using Base = BinaryOperation<Product<X, Y>, X, Y>;
     using Base::Base;
+    using typename Base::Derivative;
 
     [[nodiscard]] auto _valueImpl() -> decltype(auto)
     {
@@ -22,12 +23,12 @@ public:
     [[nodiscard]] auto _pushForwardImpl() -> decltype(auto)
     {
         if constexpr (!Base::hasOperandX) {
-            return Base::xValue() * Base::yPushForward();
+            return promote<Derivative>(Base::xValue()) * Base::yPushForward();
         } else if constexpr (!Base::hasOperandY) {
-            return Base::yValue() * Base::xPushForward();
+            return promote<Derivative>(Base::yValue()) * Base::xPushForward();
         } else {
-            return Base::yValue() * Base::xPushForward()
-                 + Base::xValue() * Base::yPushForward();
+            return promote<Derivative>(Base::yValue()) * Base::xPushForward()
+                 + promote<Derivative>(Base::xValue()) * Base::yPushForward();
         }
     }
 
@@ -35,10 +36,10 @@ public:
     void _pullBackImpl(Derivative const& derivative)
     {
         if constexpr (Base::hasOperandX) {
-            Base::xPullBack(derivative * Base::yValue());
+            Base::xPullBack(derivative * promote<Derivative>(Base::yValue()));
         }
         if constexpr (Base::hasOperandY) {
-            Base::yPullBack(derivative * Base::xValue());
+            Base::yPullBack(derivative * promote<Derivative>(Base::xValue()));
         }
     }
 };
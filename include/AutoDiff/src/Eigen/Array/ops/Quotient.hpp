@@ -13,6 +13,7 @@ class Quotient : public BinaryOperation<Quotient<X, Y>, X, Y> {
 public:
     using Base = BinaryOperation<Quotient<X, Y>, X, Y>;
     using Base::Base;
+    using typename Base::Derivative;
 
     [[nodiscard]] auto _valueImpl() -> decltype(auto)
     {
@@ -43,12 +44,15 @@ public:
     }
 
 private:
-    [[nodiscard]] auto xDeriv() -> decltype(auto) { return 1 / Base::yValue(); }
+    [[nodiscard]] auto xDeriv() -> decltype(auto)
+    {
+        return 1 / promote<Derivative>(Base::yValue());
+    }
 
     [[nodiscard]] auto yDeriv() -> decltype(auto)
     {
-        auto const& yValue = Base::yValue();
-        return -Base::xValue() / (yValue * yValue);
+        auto const& yValue = promote<Derivative>(Base::yValue());
+        return -promote<Derivative>(Base::xValue()) / (yValue * yValue);
     }
 };
 
@@ -13,6 +13,7 @@ class Sin : public UnaryOperation<Sin<X>, X> {
 public:
     using Base = UnaryOperation<Sin<X>, X>;
     using Base::Base;
+    using typename Base::Derivative;
 
     [[nodiscard]] auto _valueImpl() -> decltype(auto)
     {
@@ -21,13 +22,13 @@ public:
 
     [[nodiscard]] auto _pushForwardImpl() -> decltype(auto)
     {
-        return Base::xValue().cos() * Base::xPushForward();
+        return promote<Derivative>(Base::xValue()).cos() * Base::xPushForward();
     }
 
     template <typename Derivative>
     void _pullBackImpl(Derivative const& derivative)
     {
-        Base::xPullBack(derivative * Base::xValue().cos());
+        Base::xPullBack(derivative * promote<Derivative>(Base::xValue()).cos());
     }
 };
 
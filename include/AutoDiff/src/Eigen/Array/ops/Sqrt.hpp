@@ -13,6 +13,7 @@ class Sqrt : public UnaryOperation<Sqrt<X>, X> {
 public:
     using Base = UnaryOperation<Sqrt<X>, X>;
     using Base::Base;
+    using typename Base::Derivative;
 
     [[nodiscard]] auto _valueImpl() -> decltype(auto)
     {
@@ -21,13 +22,15 @@ public:
 
     [[nodiscard]] auto _pushForwardImpl() -> decltype(auto)
     {
-        return Base::xPushForward() / (2 * Base::xValue().sqrt());
+        return Base::xPushForward()
+             / (2 * promote<Derivative>(Base::xValue()).sqrt());
     }
 
     template <typename Derivative>
     void _pullBackImpl(Derivative const& derivative)
     {
-        Base::xPullBack(derivative / (2 * Base::xValue().sqrt()));
+        Base::xPullBack(
+            derivative / (2 * promote<Derivative>(Base::xValue()).sqrt()));
     }
 };
 
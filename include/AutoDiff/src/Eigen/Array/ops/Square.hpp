@@ -13,6 +13,7 @@ class Square : public UnaryOperation<Square<X>, X> {
 public:
     using Base = UnaryOperation<Square<X>, X>;
     using Base::Base;
+    using typename Base::Derivative;
 
     [[nodiscard]] auto _valueImpl() -> decltype(auto)
     {
@@ -21,13 +22,13 @@ public:
 
     [[nodiscard]] auto _pushForwardImpl() -> decltype(auto)
     {
-        return 2 * Base::xValue() * Base::xPushForward();
+        return 2 * promote<Derivative>(Base::xValue()) * Base::xPushForward();
     }
 
     template <typename Derivative>
     void _pullBackImpl(Derivative const& derivative)
     {
-        Base::xPullBack(derivative * 2 * Base::xValue());
+        Base::xPullBack(derivative * 2 * promote<Derivative>(Base::xValue()));
     }
 };
 
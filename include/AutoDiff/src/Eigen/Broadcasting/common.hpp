@@ -0,0 +1,20 @@
+// Copyright (c) 2024 Matthias Krippner
+//
+// This software is released under the MIT License.
+// https://opensource.org/licenses/MIT
+
+#ifndef AUTODIFF_SRC_EIGEN_BROADCASTING_COMMON_HPP
+#define AUTODIFF_SRC_EIGEN_BROADCASTING_COMMON_HPP
+
+// included here instead of for each operation
+
+#include "factories.hpp"
+
+#include "../../Core/BinaryOperation.hpp"
+#include "../../Core/Cached.hpp" // CachedValue
+#include "../derivatives.hpp" // Dense_t mapColumns mapRows promote
+
+#include <cstddef>     // ptrdiff_t
+#include <type_traits> // conditional decay
+
+#endif // AUTODIFF_SRC_EIGEN_BROADCASTING_COMMON_HPP
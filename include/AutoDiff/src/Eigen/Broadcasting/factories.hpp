@@ -0,0 +1,47 @@
+// Copyright (c) 2024 Matthias Krippner
+//
+// This software is released under the MIT License.
+// https://opensource.org/licenses/MIT
+
+/**
+ * @file factories.hpp
+ * @brief Macro defining factory functions for broadcasting operations.
+ *
+ * Use these macros inside the @c AutoDiff namespace. They can be used without
+ * namespace qualification in user code because of argument-dependent lookup.
+ */
+
+#ifndef AUTODIFF_SRC_EIGEN_BROADCASTING_FACTORIES_HPP
+#define AUTODIFF_SRC_EIGEN_BROADCASTING_FACTORIES_HPP
+
+#include "../traits.hpp"
+
+// For matrices (hasValue = EigenAD::hasMatrixBaseValue_v, Base =
+// Eigen::MatrixBase) or arrays (EigenAD::hasArrayValue_v, Eigen::ArrayBase).
+#define AUTODIFF_MAKE_BROADCAST_OP(operation, Type, hasValue, Base)            \
+    template <typename X, typename Y>                                          \
+    auto operation(Expression<X> const& x, Expression<Y> const& y)             \
+        -> std::enable_if_t<hasValue<X>                                        \
+                                && EigenAD::hasBroadcastValues_v<X, Y>,        \
+            Type<X, Y>>                                                        \
+    {                                                                          \
+        return Type<X, Y>(x, y);                                               \
+    }                                                                          \
+                                                                               \
+    template <typename Derived, typename Y>                                    \
+    auto operation(Base<Derived> const& x, Expression<Y> const& y)             \
+        -> std::enable_if_t<EigenAD::hasBroadcastValues_v<Derived, Y>,         \
+            Type<Derived, Y>>                                                  \
+    {                                                                          \
+        return Type<Derived, Y>(x.derived(), y);                               \
+    }                                                                          \
+                                                                               \
+    template <typename X, typename Derived>                                    \
+    auto operation(Expression<X> const& x, Base<Derived> const& y)             \
+        -> std::enable_if_t<EigenAD::hasBroadcastValues_v<X, Derived>,         \
+            Type<X, Derived>>                                                  \
+    {                                                                          \
+        return Type<X, Derived>(x, y.derived());                               \
+    }
+
+#endif // AUTODIFF_SRC_EIGEN_BROADCASTING_FACTORIES_HPP
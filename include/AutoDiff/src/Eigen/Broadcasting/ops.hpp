@@ -0,0 +1,19 @@
+// Copyright (c) 2024 Matthias Krippner
+//
+// This software is released under the MIT License.
+// https://opensource.org/licenses/MIT
+
+/**
+ * @file ops.hpp
+ * @brief Includes supported broadcasting operations.
+ */
+
+#ifndef AUTODIFF_SRC_EIGEN_BROADCASTING_OPS_HPP
+#define AUTODIFF_SRC_EIGEN_BROADCASTING_OPS_HPP
+
+// avoid includes in operation headers
+#include "common.hpp"
+
+#include "ops/Broadcast.hpp"
+
+#endif // AUTODIFF_SRC_EIGEN_BROADCASTING_OPS_HPP
@@ -0,0 +1,389 @@
+// Copyright (c) 2024 Matthias Krippner
+//
+// This software is released under the MIT License.
+// https://opensource.org/licenses/MIT
+
+#ifndef AUTODIFF_SRC_EIGEN_BROADCASTING_OPS_BROADCAST_HPP
+#define AUTODIFF_SRC_EIGEN_BROADCASTING_OPS_BROADCAST_HPP
+
+namespace AutoDiff::EigenAD {
+
+enum class BroadcastOperation { Sum, Difference, Product, Quotient };
+
+/**
+ * @brief Coefficient-wise operation of a matrix and a vector that is
+ * broadcast along the matrix.
+ *
+ * A column vector is combined with each column of the matrix,
+ * a row vector with each row.
+ * Which operand is the vector is decided by the compile-time shapes.
+ * The vector is never replicated: the pushforward applies its tangent to each
+ * column (row) and the pullback reduces the gradient along the broadcast axis.
+ *
+ * Both matrices (with Jacobian derivatives) and arrays (with coefficient-wise
+ * derivatives) are supported.
+ */
+template <typename X, typename Y, BroadcastOperation Operation>
+class Broadcast : public BinaryOperation<Broadcast<X, Y, Operation>, X, Y> {
+public:
+    using Base  = BinaryOperation<Broadcast<X, Y, Operation>, X, Y>;
+    using Value = internal::Evaluated_t<ValueType_t<std::conditional_t<
+        bool(ValueType_t<X>::IsVectorAtCompileTime), Y, X>>>;
+    using Base::Base;
+    using typename Base::Derivative;
+    using DenseDerivative = Dense_t<Derivative>;
+
+    void _releaseCacheImpl()
+    {
+        Base::_releaseCacheImpl();
+        mValue.release();
+    }
+
+    [[nodiscard]] auto _valueImpl() -> Value const&
+    {
+        return mValue([&]() { return combine(); });
+    }
+
+    [[nodiscard]] auto _pushForwardImpl()
+    {
+        auto const matrixSlope = slopeByMatrix();
+        auto const vectorSlope = slopeByVector();
+        auto const rows        = matrixValue().rows();
+        auto const cols        = matrixValue().cols();
+
+        auto const pushMatrix = [&](auto const& tangent) {
+            if constexpr (isArray) {
+                // seeding the vector generates zero tangents of its shape
+                if (tangent.rows() != rows || tangent.cols() != cols) {
+                    return DenseDerivative(DenseDerivative::Zero(rows, cols));
+                }
+                return DenseDerivative(matrixSlope * tangent);
+            } else if constexpr (isLinear) {
+                return DenseDerivative(matrixSlope * tangent);
+            } else {
+                return DenseDerivative(
+                    matrixSlope.matrix().reshaped().asDiagonal() * tangent);
+            }
+        };
+        auto const pushVector = [&](auto const& tangent) {
+            if constexpr (isArray) {
+                auto deriv = DenseDerivative(rows, cols);
+                if constexpr (isLinear) {
+                    along(deriv) = vectorSlope * vectorOf(tangent);
+                } else {
+                    deriv = vectorSlope;
+                    along(deriv) *= vectorOf(tangent);
+                }
+                return deriv;
+            } else {
+                auto deriv = DenseDerivative(rows * cols, tangent.cols());
+                for (std::ptrdiff_t j = 0; j != cols; ++j) {
+                    auto block = deriv.middleRows(j * rows, rows);
+                    if constexpr (isColwise && isLinear) {
+                        block = vectorSlope * tangent;
+                    } else if constexpr (isColwise) {
+                        block = vectorSlope.col(j).matrix().asDiagonal()
+                              * tangent;
+                    } else if constexpr (isLinear) {
+                        block = vectorSlope * tangent.row(j).replicate(rows, 1);
+                    } else {
+                        block = vectorSlope.col(j).matrix() * tangent.row(j);
+                    }
+                }
+                return deriv;
+            }
+        };
+
+        if constexpr (!hasVectorOperand) {
+            return mapColumns(pushMatrix, matrixPushForward());
+        } else if constexpr (!hasMatrixOperand) {
+            return mapColumns(pushVector, vectorPushForward());
+        } else {
+            return mapColumns(
+                [&](auto const& matrixTangent, auto const& vectorTangent) {
+                    return DenseDerivative(
+                        pushMatrix(matrixTangent) + pushVector(vectorTangent));
+                },
+                matrixPushForward(), vectorPushForward());
+        }
+    }
+
+    template <typename OtherDerivative>
+    void _pullBackImpl(OtherDerivative const& derivative)
+    {
+        auto const rows = matrixValue().rows();
+        auto const cols = matrixValue().cols();
+        if constexpr (hasMatrixOperand) {
+            auto const matrixSlope = slopeByMatrix();
+            matrixPullBack(mapRows(
+                [&](auto const& gradient) {
+                    if constexpr (isArray || isLinear) {
+                        return DenseDerivative(matrixSlope * gradient);
+                    } else {
+                        return DenseDerivative(gradient
+                            * matrixSlope.matrix().reshaped().asDiagonal());
+                    }
+                },
+                derivative));
+        }
+        if constexpr (hasVectorOperand) {
+            auto const vectorSlope = slopeByVector();
+            vectorPullBack(mapRows(
+                [&](auto const& gradient) {
+                    if constexpr (isArray && isColwise) {
+                        return DenseDerivative(
+                            (vectorSlope * gradient).rowwise().sum());
+                    } else if constexpr (isArray) {
+                        return DenseDerivative(
+                            (vectorSlope * gradient).colwise().sum());
+                    } else if constexpr (isColwise) {
+                        DenseDerivative deriv
+                            = DenseDerivative::Zero(gradient.rows(), rows);
+                        for (std::ptrdiff_t j = 0; j != cols; ++j) {
+                            auto const block
+                                = gradient.middleCols(j * rows, rows);
+                            if constexpr (isLinear) {
+                                deriv += vectorSlope * block;
+                            } else {
+                                deriv += block
+                                       * vectorSlope.col(j)
+                                             .matrix()
+                                             .asDiagonal();
+                            }
+                        }
+                        return deriv;
+                    } else {
+                        auto deriv = DenseDerivative(gradient.rows(), cols);
+                        for (std::ptrdiff_t j = 0; j != cols; ++j) {
+                            auto const block
+                                = gradient.middleCols(j * rows, rows);
+                            if constexpr (isLinear) {
+                                deriv.col(j)
+                                    = vectorSlope * block.rowwise().sum();
+                            } else {
+                                deriv.col(j)
+                                    = block * vectorSlope.col(j).matrix();
+                            }
+                        }
+                        return deriv;
+                    }
+                },
+                derivative));
+        }
+    }
+
+private:
+    static constexpr bool isVectorX
+        = bool(ValueType_t<X>::IsVectorAtCompileTime);
+
+    using VectorValue = ValueType_t<std::conditional_t<isVectorX, X, Y>>;
+
+    static constexpr bool isColwise = VectorValue::ColsAtCompileTime == 1;
+    static constexpr bool isArray   = isArray_v<VectorValue>;
+    static constexpr bool isLinear
+        = Operation == BroadcastOperation::Sum
+       || Operation == BroadcastOperation::Difference;
+
+    static constexpr bool hasMatrixOperand
+        = isVectorX ? Base::hasOperandY : Base::hasOperandX;
+    static constexpr bool hasVectorOperand
+        = isVectorX ? Base::hasOperandX : Base::hasOperandY;
+
+    static_assert(!isArray || !DenseDerivative::IsVectorAtCompileTime,
+        "BROADCASTING ARRAYS REQUIRES DERIVATIVES OF MATRIX TYPE");
+
+    // the column-wise (row-wise) view of the coefficients
+    template <typename Coefficients>
+    static auto along(Coefficients& coeffs)
+    {
+        if constexpr (isColwise) {
+            return coeffs.colwise();
+        } else {
+            return coeffs.rowwise();
+        }
+    }
+
+    // the coefficient-wise derivative of a vector, as vector type
+    template <typename Tangent>
+    static auto vectorOf(Tangent const& tangent)
+    {
+        if constexpr (isColwise) {
+            return tangent.col(0);
+        } else {
+            return tangent.row(0);
+        }
+    }
+
+    // the vector combined with each column (row) of the matrix
+    [[nodiscard]] auto combine() -> Value
+    {
+        Value result      = matrixValue();
+        auto&& coeffs     = result.array();
+        auto const vector = vectorValue().eval();
+        if constexpr (Operation == BroadcastOperation::Sum) {
+            along(coeffs) += vector.array();
+        } else if constexpr (Operation == BroadcastOperation::Difference) {
+            if constexpr (isVectorX) {
+                coeffs = -coeffs;
+                along(coeffs) += vector.array();
+            } else {
+                along(coeffs) -= vector.array();
+            }
+        } else if constexpr (Operation == BroadcastOperation::Product) {
+            along(coeffs) *= vector.array();
+        } else {
+            if constexpr (isVectorX) {
+                coeffs = coeffs.inverse();
+                along(coeffs) *= vector.array();
+            } else {
+                along(coeffs) /= vector.array();
+            }
+        }
+        return result;
+    }
+
+    // The derivatives of the value coefficients by the corresponding matrix
+    // and vector coefficients (scalars for sums and differences).
+
+    [[nodiscard]] auto slopeByMatrix()
+    {
+        using Scalar = typename DenseDerivative::Scalar;
+        if constexpr (isLinear) {
+            constexpr bool isNegated
+                = isVectorX && Operation == BroadcastOperation::Difference;
+            return Scalar(isNegated ? -1 : 1);
+        } else if constexpr (Operation == BroadcastOperation::Product) {
+            auto slope = promote<Derivative>(matrixValue()).array().eval();
+            along(slope) = promote<Derivative>(vectorValue()).array();
+            return slope;
+        } else if constexpr (isVectorX) {
+            return (-promote<Derivative>(_valueImpl()).array()
+                    / promote<Derivative>(matrixValue()).array())
+                .eval();
+        } else {
+            auto slope = promote<Derivative>(matrixValue()).array().eval();
+            along(slope) = promote<Derivative>(vectorValue()).array().inverse();
+            return slope;
+        }
+    }
+
+    [[nodiscard]] auto slopeByVector()
+    {
+        using Scalar = typename DenseDerivative::Scalar;
+        if constexpr (isLinear) {
+            constexpr bool isNegated
+                = !isVectorX && Operation == BroadcastOperation::Difference;
+            return Scalar(isNegated ? -1 : 1);
+        } else if constexpr (Operation == BroadcastOperation::Product) {
+            return promote<Derivative>(matrixValue()).array().eval();
+        } else if constexpr (isVectorX) {
+            return promote<Derivative>(matrixValue()).array().inverse().eval();
+        } else {
+            auto slope = (-promote<Derivative>(_valueImpl()).array()).eval();
+            along(slope) /= promote<Derivative>(vectorValue()).array();
+            return slope;
+        }
+    }
+
+    // Operand access by role instead of position.
+
+    auto matrixValue() -> decltype(auto)
+    {
+        if constexpr (isVectorX) {
+            return Base::yValue();
+        } else {
+            return Base::xValue();
+        }
+    }
+
+    auto vectorValue() -> decltype(auto)
+    {
+        if constexpr (isVectorX) {
+            return Base::xValue();
+        } else {
+            return Base::yValue();
+        }
+    }
+
+    auto matrixPushForward() -> decltype(auto)
+    {
+        if constexpr (isVectorX) {
+            return Base::yPushForward();
+        } else {
+            return Base::xPushForward();
+        }
+    }
+
+    auto vectorPushForward() -> decltype(auto)
+    {
+        if constexpr (isVectorX) {
+            return Base::xPushForward();
+        } else {
+            return Base::yPushForward();
+        }
+    }
+
+    template <typename Gradient>
+    void matrixPullBack(Gradient const& gradient)
+    {
+        if constexpr (isVectorX) {
+            Base::yPullBack(gradient);
+        } else {
+            Base::xPullBack(gradient);
+        }
+    }
+
+    template <typename Gradient>
+    void vectorPullBack(Gradient const& gradient)
+    {
+        if constexpr (isVectorX) {
+            Base::xPullBack(gradient);
+        } else {
+            Base::yPullBack(gradient);
+        }
+    }
+
+    internal::CachedValue<Value> mValue;
+};
+
+template <typename X, typename Y>
+using BroadcastSum = Broadcast<X, Y, BroadcastOperation::Sum>;
+
+template <typename X, typename Y>
+using BroadcastDifference = Broadcast<X, Y, BroadcastOperation::Difference>;
+
+template <typename X, typename Y>
+using BroadcastProduct = Broadcast<X, Y, BroadcastOperation::Product>;
+
+template <typename X, typename Y>
+using BroadcastQuotient = Broadcast<X, Y, BroadcastOperation::Quotient>;
+
+} // namespace AutoDiff::EigenAD
+
+namespace AutoDiff {
+
+// matrices
+
+AUTODIFF_MAKE_BROADCAST_OP(operator+, EigenAD::BroadcastSum,
+    EigenAD::hasMatrixBaseValue_v, Eigen::MatrixBase)
+AUTODIFF_MAKE_BROADCAST_OP(operator-, EigenAD::BroadcastDifference,
+    EigenAD::hasMatrixBaseValue_v, Eigen::MatrixBase)
+AUTODIFF_MAKE_BROADCAST_OP(cwiseProduct, EigenAD::BroadcastProduct,
+    EigenAD::hasMatrixBaseValue_v, Eigen::MatrixBase)
+AUTODIFF_MAKE_BROADCAST_OP(cwiseQuotient, EigenAD::BroadcastQuotient,
+    EigenAD::hasMatrixBaseValue_v, Eigen::MatrixBase)
+
+// arrays
+
+AUTODIFF_MAKE_BROADCAST_OP(operator+, EigenAD::BroadcastSum,
+    EigenAD::hasArrayValue_v, Eigen::ArrayBase)
+AUTODIFF_MAKE_BROADCAST_OP(operator-, EigenAD::BroadcastDifference,
+    EigenAD::hasArrayValue_v, Eigen::ArrayBase)
+AUTODIFF_MAKE_BROADCAST_OP(operator*, EigenAD::BroadcastProduct,
+    EigenAD::hasArrayValue_v, Eigen::ArrayBase)
+AUTODIFF_MAKE_BROADCAST_OP(operator/, EigenAD::BroadcastQuotient,
+    EigenAD::hasArrayValue_v, Eigen::ArrayBase)
+
+} // namespace AutoDiff
+
+#endif // AUTODIFF_SRC_EIGEN_BROADCASTING_OPS_BROADCAST_HPP
@@ -12,7 +12,11 @@
 
 #include "../../Core/BinaryOperation.hpp"
 #include "../../Core/UnaryOperation.hpp"
+#include "../derivatives.hpp" // broadcasting mapColumns mapRows promote
+#include "../traits.hpp"      // isMatrixBase isTemporary
 
+#include <cassert>
 #include <cstddef> // ptrdiff
+#include <utility> // move
 
 #endif // AUTODIFF_SRC_EIGEN_CWISE_COMMON_HPP
@@ -29,7 +29,8 @@
     template <typename X, typename Y>                                          \
     auto operation(Expression<X> const& x, Expression<Y> const& y)             \
         -> std::enable_if_t<EigenAD::hasMatrixBaseValue_v<X>                   \
-                                && EigenAD::hasMatrixBaseValue_v<Y>,           \
+                                && EigenAD::hasMatrixBaseValue_v<Y>            \
+                                && !EigenAD::hasBroadcastValues_v<X, Y>,       \
             Type<X, Y>>                                                        \
     {                                                                          \
         return Type<X, Y>(x, y);                                               \
@@ -38,7 +39,8 @@
     template <typename Derived, typename Y>                                    \
     auto operation(                                                            \
         Eigen::MatrixBase<Derived> const& x, Expression<Y> const& y)           \
-        -> std::enable_if_t<EigenAD::hasMatrixBaseValue_v<Y>,                  \
+        -> std::enable_if_t<EigenAD::hasMatrixBaseValue_v<Y>                   \
+                                && !EigenAD::hasBroadcastValues_v<Derived, Y>, \
             Type<Derived, Y>>                                                  \
     {                                                                          \
         return Type<Derived, Y>(x.derived(), y);                               \
@@ -47,7 +49,8 @@
     template <typename X, typename Derived>                                    \
     auto operation(                                                            \
         Expression<X> const& x, Eigen::MatrixBase<Derived> const& y)           \
-        -> std::enable_if_t<EigenAD::hasMatrixBaseValue_v<X>,                  \
+        -> std::enable_if_t<EigenAD::hasMatrixBaseValue_v<X>                   \
+                                && !EigenAD::hasBroadcastValues_v<X, Derived>, \
             Type<X, Derived>>                                                  \
     {                                                                          \
         return Type<X, Derived>(x, y.derived());                               \
@@ -24,6 +24,7 @@
 #include "ops/Pow.hpp"
 #include "ops/Product.hpp"
 #include "ops/Quotient.hpp"
+#include "ops/Select.hpp"
 #include "ops/Sin.hpp"
 #include "ops/Sqrt.hpp"
 #include "ops/Square.hpp"
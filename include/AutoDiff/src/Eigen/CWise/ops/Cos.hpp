@@ -13,6 +13,7 @@ class Cos : public UnaryOperation<Cos<X>, X> {
 public:
     using Base = UnaryOperation<Cos<X>, X>;
     using Base::Base;
+    using typename Base::Derivative;
 
     [[nodiscard]] auto _valueImpl() -> decltype(auto)
     {
@@ -21,16 +22,20 @@ public:
 
     [[nodiscard]] auto _pushForwardImpl() -> decltype(auto)
     {
-        return (-Base::xValue()).array().sin().matrix().reshaped().asDiagonal()
-             * Base::xPushForward();
+        return xDeriv() * Base::xPushForward();
     }
 
     template <typename Derivative>
     void _pullBackImpl(Derivative const& derivative)
     {
-        Base::xPullBack(
-            derivative
-            * (-Base::xValue()).array().sin().matrix().reshaped().asDiagonal());
+        Base::xPullBack(derivative * xDeriv());
+    }
+
+private:
+    [[nodiscard]] auto xDeriv() -> decltype(auto)
+    {
+        return asDiagonal<Derivative>(
+            (-promote<Derivative>(Base::xValue())).array().sin().matrix());
     }
 };
 
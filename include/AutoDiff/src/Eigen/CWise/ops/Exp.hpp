@@ -13,6 +13,7 @@ class Exp : public UnaryOperation<Exp<X>, X> {
 public:
     using Base = UnaryOperation<Exp<X>, X>;
     using Base::Base;
+    using typename Base::Derivative;
 
     [[nodiscard]] auto _valueImpl() -> decltype(auto)
     {
@@ -21,13 +22,19 @@ public:
 
     [[nodiscard]] auto _pushForwardImpl() -> decltype(auto)
     {
-        return _valueImpl().reshaped().asDiagonal() * Base::xPushForward();
+        return xDeriv() * Base::xPushForward();
     }
 
     template <typename Derivative>
     void _pullBackImpl(Derivative const& derivative)
     {
-        Base::xPullBack(derivative * _valueImpl().reshaped().asDiagonal());
+        Base::xPullBack(derivative * xDeriv());
+    }
+
+private:
+    [[nodiscard]] auto xDeriv() -> decltype(auto)
+    {
+        return asDiagonal<Derivative>(promote<Derivative>(_valueImpl()));
     }
 };
 
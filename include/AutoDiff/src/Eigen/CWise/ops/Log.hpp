@@ -13,6 +13,7 @@ class Log : public UnaryOperation<Log<X>, X> {
 public:
     using Base = UnaryOperation<Log<X>, X>;
     using Base::Base;
+    using typename Base::Derivative;
 
     [[nodiscard]] auto _valueImpl() -> decltype(auto)
     {
@@ -33,7 +34,8 @@ public:
 private:
     auto xDeriv() -> decltype(auto)
     {
-        return Base::xValue().reshaped().asDiagonal().inverse();
+        return asDiagonal<Derivative>(promote<Derivative>(Base::xValue()))
+            .inverse();
     }
 };
 
@@ -13,6 +13,7 @@ class Max : public UnaryOperation<Max<X>, X> {
 public:
     using Base = UnaryOperation<Max<X>, X>;
     using Base::Base;
+    using typename Base::Derivative;
 
     [[nodiscard]] auto _valueImpl() -> decltype(auto)
     {
@@ -33,10 +34,8 @@ public:
 private:
     [[nodiscard]] auto xDeriv() -> decltype(auto)
     {
-        return Base::xValue()
-            .unaryExpr([](auto x) -> decltype(x) { return x > 0; })
-            .reshaped()
-            .asDiagonal();
+        return asDiagonal<Derivative>(promote<Derivative>(Base::xValue())
+                .unaryExpr([](auto x) -> decltype(x) { return x > 0; }));
     }
 };
 
@@ -13,6 +13,7 @@ class Pow : public BinaryOperation<Pow<X, Y>, X, Y> {
 public:
     using Base = BinaryOperation<Pow<X, Y>, X, Y>;
     using Base::Base;
+    using typename Base::Derivative;
 
     [[nodiscard]] auto _valueImpl() -> decltype(auto)
     {
@@ -21,8 +22,8 @@ public:
 
     [[nodiscard]] auto _pushForwardImpl() -> decltype(auto)
     {
-        auto const xArray = Base::xValue().array();
-        auto const yArray = Base::yValue().array();
+        auto const xArray = promote<Derivative>(Base::xValue()).array();
+        auto const yArray = promote<Derivative>(Base::yValue()).array();
         if constexpr (!Base::hasOperandX) {
             return yDeriv(xArray, yArray) * Base::yPushForward();
         } else if constexpr (!Base::hasOperandY) {
@@ -36,8 +37,8 @@ public:
     template <typename Derivative>
     void _pullBackImpl(Derivative const& derivative)
     {
-        auto const xArray = Base::xValue().array();
-        auto const yArray = Base::yValue().array();
+        auto const xArray = promote<Derivative>(Base::xValue()).array();
+        auto const yArray = promote<Derivative>(Base::yValue()).array();
         if constexpr (Base::hasOperandX) {
             Base::xPullBack(derivative * xDeriv(xArray, yArray));
         }
@@ -51,20 +52,16 @@ private:
     [[nodiscard]] static auto xDeriv(XArray const& xArray, YArray const& yArray)
         -> decltype(auto)
     {
-        return (xArray.pow(yArray - 1) * yArray)
-            .matrix()
-            .reshaped()
-            .asDiagonal();
+        return asDiagonal<Derivative>(
+            (xArray.pow(yArray - 1) * yArray).matrix());
     }
 
     template <typename XArray, typename YArray>
     [[nodiscard]] static auto yDeriv(XArray const& xArray, YArray const& yArray)
         -> decltype(auto)
     {
-        return (xArray.pow(yArray) * xArray.log())
-            .matrix()
-            .reshaped()
-            .asDiagonal();
+        return asDiagonal<Derivative>(
+            (xArray.pow(yArray) * xArray.log()).matrix());
     }
 };
 
@@ -76,6 +73,7 @@ class PowScalar : public BinaryOperation<PowScalar<X, Y>, X, Y> {
 public:
     using Base = BinaryOperation<PowScalar<X, Y>, X, Y>;
     using Base::Base;
+    using typename Base::Derivative;
 
     [[nodiscard]] auto _valueImpl() -> decltype(auto)
     {
@@ -84,8 +82,8 @@ public:
 
     [[nodiscard]] auto _pushForwardImpl() -> decltype(auto)
     {
-        auto const xArray = Base::xValue().array();
-        auto const yValue = Base::yValue();
+        auto const xArray = promote<Derivative>(Base::xValue()).array();
+        auto const yValue = promote<Derivative>(Base::yValue());
         if constexpr (!Base::hasOperandX) {
             return yDeriv(xArray, yValue) * Base::yPushForward();
         } else if constexpr (!Base::hasOperandY) {
@@ -99,8 +97,8 @@ public:
     template <typename Derivative>
     void _pullBackImpl(Derivative const& derivative)
     {
-        auto const xArray = Base::xValue().array();
-        auto const yValue = Base::yValue();
+        auto const xArray = promote<Derivative>(Base::xValue()).array();
+        auto const yValue = promote<Derivative>(Base::yValue());
         if constexpr (Base::hasOperandX) {
             Base::xPullBack(derivative * xDeriv(xArray, yValue));
         }
@@ -114,10 +112,8 @@ private:
     [[nodiscard]] static auto xDeriv(
         XArray const& xArray, YValueType const& yValue) -> decltype(auto)
     {
-        return (xArray.pow(yValue - 1) * yValue)
-            .matrix()
-            .reshaped()
-            .asDiagonal();
+        return asDiagonal<Derivative>(
+            (xArray.pow(yValue - 1) * yValue).matrix());
     }
 
     template <typename XArray, typename YValueType>
@@ -13,6 +13,7 @@ class Product : public BinaryOperation<Product<X, Y>, X, Y> {
 public:
     using Base = BinaryOperation<Product<X, Y>, X, Y>;
     using Base::Base;
+    using typename Base::Derivative;
 
     [[nodiscard]] auto _valueImpl() -> decltype(auto)
     {
@@ -45,12 +46,12 @@ public:
 private:
     [[nodiscard]] auto xDeriv() -> decltype(auto)
     {
-        return Base::yValue().reshaped().asDiagonal();
+        return asDiagonal<Derivative>(promote<Derivative>(Base::yValue()));
     }
 
     [[nodiscard]] auto yDeriv() -> decltype(auto)
     {
-        return Base::xValue().reshaped().asDiagonal();
+        return asDiagonal<Derivative>(promote<Derivative>(Base::xValue()));
     }
 };
 
@@ -59,6 +60,7 @@ class ProductScalar : public BinaryOperation<ProductScalar<X, Y>, X, Y> {
 public:
     using Base = BinaryOperation<ProductScalar<X, Y>, X, Y>;
     using Base::Base;
+    using typename Base::Derivative;
 
     [[nodiscard]] auto _valueImpl() -> decltype(auto)
     {
@@ -68,12 +70,12 @@ public:
     [[nodiscard]] auto _pushForwardImpl() -> decltype(auto)
     {
         if constexpr (!Base::hasOperandX) {
-            return Base::xValue().reshaped() * Base::yPushForward();
+            return yDeriv() * Base::yPushForward();
         } else if constexpr (!Base::hasOperandY) {
             return Base::yValue() * Base::xPushForward();
         } else {
             return Base::yValue() * Base::xPushForward()
-                 + Base::xValue().reshaped() * Base::yPushForward();
+                 + yDeriv() * Base::yPushForward();
         }
     }
 
@@ -84,9 +86,15 @@ public:
             Base::xPullBack(derivative * Base::yValue());
         }
         if constexpr (Base::hasOperandY) {
-            Base::yPullBack(derivative * Base::xValue().reshaped());
+            Base::yPullBack(derivative * yDeriv());
         }
     }
+
+private:
+    [[nodiscard]] auto yDeriv() -> decltype(auto)
+    {
+        return promote<Derivative>(Base::xValue()).reshaped();
+    }
 };
 
 template <typename X, typename Y>
@@ -95,6 +103,7 @@ class ProductScalarMatrix
 public:
     using Base = BinaryOperation<ProductScalarMatrix<X, Y>, X, Y>;
     using Base::Base;
+    using typename Base::Derivative;
 
     [[nodiscard]] auto _valueImpl() -> decltype(auto)
     {
@@ -106,9 +115,9 @@ public:
         if constexpr (!Base::hasOperandX) {
             return Base::xValue() * Base::yPushForward();
         } else if constexpr (!Base::hasOperandY) {
-            return Base::yValue().reshaped() * Base::xPushForward();
+            return xDeriv() * Base::xPushForward();
         } else {
-            return Base::yValue().reshaped() * Base::xPushForward()
+            return xDeriv() * Base::xPushForward()
                  + Base::xValue() * Base::yPushForward();
         }
     }
@@ -117,12 +126,18 @@ public:
     void _pullBackImpl(Derivative const& derivative)
     {
         if constexpr (Base::hasOperandX) {
-            Base::xPullBack(derivative * Base::yValue().reshaped());
+            Base::xPullBack(derivative * xDeriv());
         }
         if constexpr (Base::hasOperandY) {
             Base::yPullBack(derivative * Base::xValue());
         }
     }
+
+private:
+    [[nodiscard]] auto xDeriv() -> decltype(auto)
+    {
+        return promote<Derivative>(Base::yValue()).reshaped();
+    }
 };
 
 } // namespace AutoDiff::EigenAD::CWise
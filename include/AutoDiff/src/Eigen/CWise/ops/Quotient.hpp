@@ -13,6 +13,7 @@ class Quotient : public BinaryOperation<Quotient<X, Y>, X, Y> {
 public:
     using Base = BinaryOperation<Quotient<X, Y>, X, Y>;
     using Base::Base;
+    using typename Base::Derivative;
 
     [[nodiscard]] auto _valueImpl() -> decltype(auto)
     {
@@ -45,15 +46,16 @@ public:
 private:
     [[nodiscard]] auto xDeriv() -> decltype(auto)
     {
-        return Base::yValue().reshaped().asDiagonal().inverse();
+        return asDiagonal<Derivative>(promote<Derivative>(Base::yValue()))
+            .inverse();
     }
 
     [[nodiscard]] auto yDeriv() -> decltype(auto)
     {
-        return (-Base::xValue().array() / Base::yValue().array().square())
-            .matrix()
-            .reshaped()
-            .asDiagonal();
+        return asDiagonal<Derivative>(
+            (-promote<Derivative>(Base::xValue()).array()
+                / promote<Derivative>(Base::yValue()).array().square())
+                .matrix());
     }
 };
 
@@ -62,6 +64,7 @@ class QuotientScalar : public BinaryOperation<QuotientScalar<X, Y>, X, Y> {
 public:
     using Base = BinaryOperation<QuotientScalar<X, Y>, X, Y>;
     using Base::Base;
+    using typename Base::Derivative;
 
     [[nodiscard]] auto _valueImpl() -> decltype(auto)
     {
@@ -70,32 +73,34 @@ public:
 
     [[nodiscard]] auto _pushForwardImpl() -> decltype(auto)
     {
-        auto const& yValue = Base::yValue();
-
         if constexpr (!Base::hasOperandX) {
-            return (-Base::xValue().reshaped()) * Base::yPushForward()
-                 / (yValue * yValue);
+            return yDeriv() * Base::yPushForward();
         } else if constexpr (!Base::hasOperandY) {
-            return Base::xPushForward() / yValue;
+            return Base::xPushForward() / Base::yValue();
         } else {
-            return Base::xPushForward() / yValue
-                 - Base::xValue().reshaped() * Base::yPushForward()
-                       / (yValue * yValue);
+            return Base::xPushForward() / Base::yValue()
+                 + yDeriv() * Base::yPushForward();
         }
     }
 
     template <typename Derivative>
     void _pullBackImpl(Derivative const& derivative)
     {
-        auto const& yValue = Base::yValue();
         if constexpr (Base::hasOperandX) {
-            Base::xPullBack(derivative / yValue);
+            Base::xPullBack(derivative / Base::yValue());
         }
         if constexpr (Base::hasOperandY) {
-            Base::yPullBack(
-                derivative * (-Base::xValue().reshaped()) / (yValue * yValue));
+            Base::yPullBack(derivative * yDeriv());
         }
     }
+
+private:
+    [[nodiscard]] auto yDeriv() -> decltype(auto)
+    {
+        auto const& yValue = Base::yValue();
+        return -promote<Derivative>(Base::xValue()).reshaped()
+             / (yValue * yValue);
+    }
 };
 
 template <typename X, typename Y>
@@ -104,6 +109,7 @@ class QuotientScalarMatrix
 public:
     using Base = BinaryOperation<QuotientScalarMatrix<X, Y>, X, Y>;
     using Base::Base;
+    using typename Base::Derivative;
 
     [[nodiscard]] auto _valueImpl() -> decltype(auto)
     {
@@ -136,15 +142,15 @@ public:
 private:
     [[nodiscard]] auto xDeriv() -> decltype(auto)
     {
-        return Base::yValue().cwiseInverse().reshaped();
+        return promote<Derivative>(Base::yValue()).cwiseInverse().reshaped();
     }
 
     [[nodiscard]] auto yDeriv() -> decltype(auto)
     {
-        return (-Base::xValue() / Base::yValue().array().square())
-            .matrix()
-            .reshaped()
-            .asDiagonal();
+        return asDiagonal<Derivative>(
+            (-Base::xValue()
+                / promote<Derivative>(Base::yValue()).array().square())
+                .matrix());
     }
 };
 
@@ -0,0 +1,195 @@
+// Copyright (c) 2024 Matthias Krippner
+//
+// This software is released under the MIT License.
+// https://opensource.org/licenses/MIT
+
+#ifndef AUTODIFF_SRC_EIGEN_CWISE_OPS_SELECT_HPP
+#define AUTODIFF_SRC_EIGEN_CWISE_OPS_SELECT_HPP
+
+namespace AutoDiff::EigenAD::CWise {
+
+/**
+ * @brief Coefficient-wise selection of x where the condition is positive and
+ * of y elsewhere.
+ *
+ * The condition is an expression or a literal; it is not differentiated.
+ * The value is a lazy Eigen select expression of both operands.
+ * The pushforward selects the tangent rows of x or y and the pullback masks
+ * the gradient columns of each operand, without forming diagonal matrices.
+ */
+template <typename C, typename X, typename Y>
+class Select : public BinaryOperation<Select<C, X, Y>, X, Y> {
+public:
+    using Base = BinaryOperation<Select<C, X, Y>, X, Y>;
+    using typename Base::Derivative;
+    using Scalar = typename Dense_t<Derivative>::Scalar;
+
+    template <typename OperandX, typename OperandY>
+    Select(C condition, OperandX const& x, OperandY const& y)
+        : Base(x, y)
+        , mCondition{std::move(condition)}
+    {
+    }
+
+    // Expression implementation ===============================================
+
+    void _transferChildrenToImpl(internal::Node& node)
+    {
+        Base::_transferChildrenToImpl(node);
+        if constexpr (isExpression_v<C>) {
+            mCondition._transferChildrenTo(node);
+        }
+    }
+
+    void _releaseCacheImpl()
+    {
+        Base::_releaseCacheImpl();
+        if constexpr (isExpression_v<C>) {
+            mCondition._releaseCache();
+        }
+    }
+
+    [[nodiscard]] auto _valueImpl() -> decltype(auto)
+    {
+        using XValue = decltype(Base::xValue());
+        using YValue = decltype(Base::yValue());
+        using CValue = decltype(conditionValue());
+        auto&& xValue = Base::xValue();
+        auto&& yValue = Base::yValue();
+        auto&& cValue = conditionValue();
+        assert(xValue.rows() == yValue.rows() && xValue.cols() == yValue.cols()
+            && cValue.rows() == xValue.rows() && cValue.cols() == xValue.cols()
+            && "SIZES DO NOT MATCH");
+        auto value = positive(cValue.array()).select(xValue, yValue);
+        if constexpr (isTemporary_v<XValue> || isTemporary_v<YValue>
+                      || isTemporary_v<CValue>) {
+            return value.eval(); // the lazy select would dangle
+        } else {
+            return value;
+        }
+    }
+
+    [[nodiscard]] auto _pushForwardImpl()
+    {
+        auto&& cValue = conditionValue();
+        auto const mask = [&](std::ptrdiff_t cols) {
+            return positive(cValue.reshaped().array()).replicate(1, cols);
+        };
+        if constexpr (!Base::hasOperandX) {
+            return mapColumns(
+                [&](auto const& tangentY) {
+                    return mask(tangentY.cols())
+                        .select(Scalar(0), tangentY)
+                        .eval();
+                },
+                Base::yPushForward());
+        } else if constexpr (!Base::hasOperandY) {
+            return mapColumns(
+                [&](auto const& tangentX) {
+                    return mask(tangentX.cols())
+                        .select(tangentX, Scalar(0))
+                        .eval();
+                },
+                Base::xPushForward());
+        } else {
+            return mapColumns(
+                [&](auto const& tangentX, auto const& tangentY) {
+                    return mask(tangentX.cols())
+                        .select(tangentX, tangentY)
+                        .eval();
+                },
+                Base::xPushForward(), Base::yPushForward());
+        }
+    }
+
+    template <typename OtherDerivative>
+    void _pullBackImpl(OtherDerivative const& derivative)
+    {
+        auto&& cValue = conditionValue();
+        auto const mask = [&](std::ptrdiff_t rows) {
+            return positive(cValue.reshaped().transpose().array())
+                .replicate(rows, 1);
+        };
+        if constexpr (Base::hasOperandX) {
+            Base::xPullBack(mapRows(
+                [&](auto const& gradient) {
+                    return mask(gradient.rows())
+                        .select(gradient, Scalar(0))
+                        .eval();
+                },
+                derivative));
+        }
+        if constexpr (Base::hasOperandY) {
+            Base::yPullBack(mapRows(
+                [&](auto const& gradient) {
+                    return mask(gradient.rows())
+                        .select(Scalar(0), gradient)
+                        .eval();
+                },
+                derivative));
+        }
+    }
+
+private:
+    template <typename Condition>
+    [[nodiscard]] static auto positive(Condition const& condition)
+    {
+        using CScalar = typename Condition::Scalar;
+        return condition > CScalar(0);
+    }
+
+    [[nodiscard]] auto conditionValue() -> decltype(auto)
+    {
+        if constexpr (isExpression_v<C>) {
+            return mCondition._value();
+        } else {
+            return static_cast<C const&>(mCondition);
+        }
+    }
+
+    C mCondition;
+};
+
+namespace detail {
+
+    template <typename T>
+    constexpr auto isSelectOperand() -> bool
+    {
+        if constexpr (isExpression_v<T>) {
+            return hasMatrixBaseValue_v<T>;
+        } else {
+            return isMatrixBase_v<T>;
+        }
+    }
+
+} // namespace detail
+
+} // namespace AutoDiff::EigenAD::CWise
+
+namespace AutoDiff {
+
+/**
+ * @brief Coefficient-wise selection of @p x where @p condition is positive
+ * and of @p y elsewhere, e.g. for piecewise functions.
+ *
+ * The condition and one of the operands may be Eigen matrices instead of
+ * expressions. Derivatives are only propagated to the selected operand:
+ *
+ * @code{.cpp}
+ * auto leakyRelu = select(x, x, 0.01 * x);
+ * @endcode
+ */
+template <typename C, typename X, typename Y>
+auto select(C const& condition, X const& x, Y const& y)
+    -> std::enable_if_t<(isExpression_v<X> || isExpression_v<Y>)
+                            && EigenAD::CWise::detail::isSelectOperand<C>()
+                            && EigenAD::CWise::detail::isSelectOperand<X>()
+                            && EigenAD::CWise::detail::isSelectOperand<Y>(),
+        EigenAD::CWise::Select<C, X, Y>>
+{
+    return EigenAD::CWise::Select<C, X, Y>(condition, x, y);
+}
+
+} // namespace AutoDiff
+
+#endif // AUTODIFF_SRC_EIGEN_CWISE_OPS_SELECT_HPP
@@ -13,6 +13,7 @@ class Sin : public UnaryOperation<Sin<X>, X> {
 public:
     using Base = UnaryOperation<Sin<X>, X>;
     using Base::Base;
+    using typename Base::Derivative;
 
     [[nodiscard]] auto _valueImpl() -> decltype(auto)
     {
@@ -21,16 +22,20 @@ public:
 
     [[nodiscard]] auto _pushForwardImpl() -> decltype(auto)
     {
-        return Base::xValue().array().cos().matrix().reshaped().asDiagonal()
-             * Base::xPushForward();
+        return xDeriv() * Base::xPushForward();
     }
 
     template <typename Derivative>
     void _pullBackImpl(Derivative const& derivative)
     {
-        Base::xPullBack(
-            derivative
-            * Base::xValue().array().cos().matrix().reshaped().asDiagonal());
+        Base::xPullBack(derivative * xDeriv());
+    }
+
+private:
+    [[nodiscard]] auto xDeriv() -> decltype(auto)
+    {
+        return asDiagonal<Derivative>(
+            promote<Derivative>(Base::xValue()).array().cos().matrix());
     }
 };
 
@@ -13,6 +13,7 @@ class Sqrt : public UnaryOperation<Sqrt<X>, X> {
 public:
     using Base = UnaryOperation<Sqrt<X>, X>;
     using Base::Base;
+    using typename Base::Derivative;
 
     [[nodiscard]] auto _valueImpl() -> decltype(auto)
     {
@@ -33,7 +34,8 @@ public:
 private:
     [[nodiscard]] auto xDeriv() -> decltype(auto)
     {
-        return (2 * _valueImpl().reshaped().asDiagonal()).inverse();
+        return (2 * asDiagonal<Derivative>(promote<Derivative>(_valueImpl())))
+            .inverse();
     }
 };
 
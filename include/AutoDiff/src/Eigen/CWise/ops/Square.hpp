@@ -13,6 +13,7 @@ class Square : public UnaryOperation<Square<X>, X> {
 public:
     using Base = UnaryOperation<Square<X>, X>;
     using Base::Base;
+    using typename Base::Derivative;
 
     [[nodiscard]] auto _valueImpl() -> decltype(auto)
     {
@@ -22,15 +23,19 @@ public:
 
     [[nodiscard]] auto _pushForwardImpl() -> decltype(auto)
     {
-        return 2 * Base::xValue().reshaped().asDiagonal()
-             * Base::xPushForward();
+        return xDeriv() * Base::xPushForward();
     }
 
     template <typename Derivative>
     void _pullBackImpl(Derivative const& derivative)
     {
-        Base::xPullBack(
-            derivative * 2 * Base::xValue().reshaped().asDiagonal());
+        Base::xPullBack(derivative * xDeriv());
+    }
+
+private:
+    [[nodiscard]] auto xDeriv() -> decltype(auto)
+    {
+        return 2 * asDiagonal<Derivative>(promote<Derivative>(Base::xValue()));
     }
 };
 
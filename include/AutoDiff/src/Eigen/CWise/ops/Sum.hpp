@@ -57,11 +57,11 @@ public:
     {
         if constexpr (!Base::hasOperandX) {
             auto const size = Base::xValue().size();
-            return Base::yPushForward().replicate(size, 1);
+            return replicateRow(Base::yPushForward(), size);
         } else if constexpr (!Base::hasOperandY) {
             return Base::xPushForward();
         } else {
-            return Base::xPushForward().rowwise() + Base::yPushForward().row(0);
+            return addToRows(Base::xPushForward(), Base::yPushForward());
         }
     }
 
@@ -72,7 +72,7 @@ public:
             Base::xPullBack(derivative);
         }
         if constexpr (Base::hasOperandY) {
-            Base::yPullBack(derivative.rowwise().sum());
+            Base::yPullBack(sumColumns(derivative));
         }
     }
 };
@@ -94,11 +94,9 @@ public:
             return Base::yPushForward();
         } else if constexpr (!Base::hasOperandY) {
             auto const size = Base::yValue().size();
-            return Base::xPushForward().replicate(size, 1);
+            return replicateRow(Base::xPushForward(), size);
         } else {
-            auto const size = Base::yValue().size();
-            return Base::xPushForward().replicate(size, 1)
-                 + Base::yPushForward();
+            return addToRows(Base::yPushForward(), Base::xPushForward());
         }
     }
 
@@ -106,7 +104,7 @@ public:
     void _pullBackImpl(Derivative const& derivative)
     {
         if constexpr (Base::hasOperandX) {
-            Base::xPullBack(derivative.rowwise().sum());
+            Base::xPullBack(sumColumns(derivative));
         }
         if constexpr (Base::hasOperandY) {
             Base::yPullBack(derivative);
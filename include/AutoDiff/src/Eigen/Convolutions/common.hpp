@@ -0,0 +1,22 @@
+// Copyright (c) 2024 Matthias Krippner
+//
+// This software is released under the MIT License.
+// https://opensource.org/licenses/MIT
+
+#ifndef AUTODIFF_SRC_EIGEN_CONVOLUTIONS_COMMON_HPP
+#define AUTODIFF_SRC_EIGEN_CONVOLUTIONS_COMMON_HPP
+
+// included here instead of for each operation
+
+#include "../Products/factories.hpp" // binary matrix and vector operations
+
+#include "../../Core/BinaryOperation.hpp"
+#include "../../Core/Cached.hpp" // CachedValue
+#include "../../Core/UnaryOperation.hpp"
+#include "../derivatives.hpp" // Dense_t mapColumns mapRows promote
+
+#include <cassert>
+#include <cstddef> // ptrdiff
+#include <vector>
+
+#endif // AUTODIFF_SRC_EIGEN_CONVOLUTIONS_COMMON_HPP
@@ -0,0 +1,21 @@
+// Copyright (c) 2024 Matthias Krippner
+//
+// This software is released under the MIT License.
+// https://opensource.org/licenses/MIT
+
+/**
+ * @file ops.hpp
+ * @brief Includes supported convolution and pooling operations.
+ */
+
+#ifndef AUTODIFF_SRC_EIGEN_CONVOLUTIONS_OPS_HPP
+#define AUTODIFF_SRC_EIGEN_CONVOLUTIONS_OPS_HPP
+
+// avoid includes in operation headers
+#include "common.hpp"
+
+#include "ops/Convolution1d.hpp"
+#include "ops/Convolution2d.hpp"
+#include "ops/Pooling.hpp"
+
+#endif // AUTODIFF_SRC_EIGEN_CONVOLUTIONS_OPS_HPP
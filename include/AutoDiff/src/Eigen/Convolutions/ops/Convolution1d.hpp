@@ -0,0 +1,150 @@
+// Copyright (c) 2024 Matthias Krippner
+//
+// This software is released under the MIT License.
+// https://opensource.org/licenses/MIT
+
+#ifndef AUTODIFF_SRC_EIGEN_CONVOLUTIONS_OPS_CONVOLUTION_1D_HPP
+#define AUTODIFF_SRC_EIGEN_CONVOLUTIONS_OPS_CONVOLUTION_1D_HPP
+
+namespace AutoDiff::EigenAD {
+
+/**
+ * @brief Valid 1-D convolution (cross-correlation) of a signal with a kernel.
+ *
+ * y_i = sum_j x_(i + j) k_j for i < n - m + 1, with x in R^n and k in R^m.
+ */
+template <typename X, typename Y>
+class Convolution1d : public BinaryOperation<Convolution1d<X, Y>, X, Y> {
+public:
+    using Base   = BinaryOperation<Convolution1d<X, Y>, X, Y>;
+    using Scalar = typename ValueType_t<X>::Scalar;
+    using Value  = Eigen::Matrix<Scalar, -1, 1, 0, -1, 1>;
+    using Base::Base;
+    using typename Base::Derivative;
+    using DenseDerivative = Dense_t<Derivative>;
+
+    void _releaseCacheImpl()
+    {
+        Base::_releaseCacheImpl();
+        mValue.release();
+    }
+
+    [[nodiscard]] auto _valueImpl() -> Value const&
+    {
+        return mValue([&]() {
+            auto const signal = Base::xValue().eval();
+            auto const kernel = Base::yValue().eval();
+            return shiftSum(kernel, signal, outputSize(signal, kernel));
+        });
+    }
+
+    // The signal derivative is a sum of m shifted copies (direct kernel),
+    // the kernel derivative a product with the im2col matrix (one GEMM).
+
+    [[nodiscard]] auto _pushForwardImpl()
+    {
+        auto const signal = promote<Derivative>(Base::xValue()).eval();
+        auto const kernel = promote<Derivative>(Base::yValue()).eval();
+        auto const size   = outputSize(signal, kernel);
+
+        auto const pushForwardX = [&](auto const& xDerivative) {
+            return DenseDerivative(shiftSum(kernel, xDerivative, size));
+        };
+
+        if constexpr (!Base::hasOperandY) {
+            return mapColumns(pushForwardX, Base::xPushForward());
+        } else {
+            auto const columns = im2col(signal, kernel.size());
+            if constexpr (!Base::hasOperandX) {
+                return mapColumns(
+                    [&](auto const& yDerivative) {
+                        return DenseDerivative(columns * yDerivative);
+                    },
+                    Base::yPushForward());
+            } else {
+                return mapColumns(
+                    [&](auto const& xDerivative, auto const& yDerivative) {
+                        DenseDerivative deriv = pushForwardX(xDerivative);
+                        deriv.noalias() += columns * yDerivative;
+                        return deriv;
+                    },
+                    Base::xPushForward(), Base::yPushForward());
+            }
+        }
+    }
+
+    template <typename OtherDerivative>
+    void _pullBackImpl(OtherDerivative const& derivative)
+    {
+        auto const signal = promote<Derivative>(Base::xValue()).eval();
+        auto const kernel = promote<Derivative>(Base::yValue()).eval();
+        auto const size   = outputSize(signal, kernel);
+
+        if constexpr (Base::hasOperandX) {
+            Base::xPullBack(mapRows(
+                [&](auto const& gradient) {
+                    DenseDerivative deriv = DenseDerivative::Zero(
+                        gradient.rows(), signal.size());
+                    for (std::ptrdiff_t j = 0; j != kernel.size(); ++j) {
+                        deriv.middleCols(j, size) += kernel(j) * gradient;
+                    }
+                    return deriv;
+                },
+                derivative));
+        }
+        if constexpr (Base::hasOperandY) {
+            auto const columns = im2col(signal, kernel.size());
+            Base::yPullBack(mapRows(
+                [&](auto const& gradient) {
+                    return DenseDerivative(gradient * columns);
+                },
+                derivative));
+        }
+    }
+
+private:
+    template <typename Signal, typename Kernel>
+    static auto outputSize(Signal const& signal, Kernel const& kernel)
+        -> std::ptrdiff_t
+    {
+        assert(kernel.size() > 0 && kernel.size() <= signal.size()
+               && "KERNEL LARGER THAN SIGNAL");
+        return signal.size() - kernel.size() + 1;
+    }
+
+    // sum_j k_j rows(j, ..., j + size - 1) of the given matrix
+    template <typename Kernel, typename Matrix>
+    static auto shiftSum(
+        Kernel const& kernel, Matrix const& matrix, std::ptrdiff_t size)
+    {
+        auto result = (kernel(0) * matrix.topRows(size)).eval();
+        for (std::ptrdiff_t j = 1; j < kernel.size(); ++j) {
+            result += kernel(j) * matrix.middleRows(j, size);
+        }
+        return result;
+    }
+
+    // the matrix P with P_ij = x_(i + j), such that y = P k
+    template <typename Signal>
+    static auto im2col(Signal const& signal, std::ptrdiff_t kernelSize)
+    {
+        auto const size = signal.size() - kernelSize + 1;
+        auto columns    = DenseDerivative(size, kernelSize);
+        for (std::ptrdiff_t j = 0; j != kernelSize; ++j) {
+            columns.col(j) = signal.segment(j, size);
+        }
+        return columns;
+    }
+
+    internal::CachedValue<Value> mValue;
+};
+
+} // namespace AutoDiff::EigenAD
+
+namespace AutoDiff {
+
+AUTODIFF_MAKE_COLVECTOR_BINARY_OP(conv1d, EigenAD::Convolution1d);
+
+} // namespace AutoDiff
+
+#endif // AUTODIFF_SRC_EIGEN_CONVOLUTIONS_OPS_CONVOLUTION_1D_HPP
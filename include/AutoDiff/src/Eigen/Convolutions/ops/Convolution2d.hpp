@@ -0,0 +1,187 @@
+// Copyright (c) 2024 Matthias Krippner
+//
+// This software is released under the MIT License.
+// https://opensource.org/licenses/MIT
+
+#ifndef AUTODIFF_SRC_EIGEN_CONVOLUTIONS_OPS_CONVOLUTION_2D_HPP
+#define AUTODIFF_SRC_EIGEN_CONVOLUTIONS_OPS_CONVOLUTION_2D_HPP
+
+namespace AutoDiff::EigenAD {
+
+/**
+ * @brief Valid 2-D convolution (cross-correlation) of an image with a kernel.
+ *
+ * Y_ab = sum_pq X_(a + p, b + q) K_pq, so Y has R - r + 1 rows and
+ * C - c + 1 columns for X in R^(RxC) and K in R^(rxc).
+ */
+template <typename X, typename Y>
+class Convolution2d : public BinaryOperation<Convolution2d<X, Y>, X, Y> {
+public:
+    using Base  = BinaryOperation<Convolution2d<X, Y>, X, Y>;
+    using Value = detail::DenseMatrix<typename ValueType_t<X>::Scalar>;
+    using Base::Base;
+    using typename Base::Derivative;
+    using DenseDerivative = Dense_t<Derivative>;
+
+    void _releaseCacheImpl()
+    {
+        Base::_releaseCacheImpl();
+        mValue.release();
+    }
+
+    [[nodiscard]] auto _valueImpl() -> Value const&
+    {
+        return mValue([&]() { return convolve(); });
+    }
+
+    // The image derivative is a sum of shifted copies (direct kernel on
+    // contiguous blocks of rows or columns), the kernel derivative a product
+    // with the im2col matrix (one GEMM).
+
+    [[nodiscard]] auto _pushForwardImpl()
+    {
+        auto const image  = promote<Derivative>(Base::xValue()).eval();
+        auto const kernel = promote<Derivative>(Base::yValue()).eval();
+        auto const rows   = outputRows(image, kernel);
+        auto const cols   = outputCols(image, kernel);
+
+        // each column of the output reads a contiguous block of the image
+        auto const pushForwardX = [&](auto const& xDerivative) {
+            DenseDerivative deriv
+                = DenseDerivative::Zero(rows * cols, xDerivative.cols());
+            for (std::ptrdiff_t q = 0; q != kernel.cols(); ++q) {
+                for (std::ptrdiff_t p = 0; p != kernel.rows(); ++p) {
+                    for (std::ptrdiff_t b = 0; b != cols; ++b) {
+                        deriv.middleRows(b * rows, rows) += kernel(p, q)
+                            * xDerivative.middleRows(
+                                p + (b + q) * image.rows(), rows);
+                    }
+                }
+            }
+            return deriv;
+        };
+
+        if constexpr (!Base::hasOperandY) {
+            return mapColumns(pushForwardX, Base::xPushForward());
+        } else {
+            auto const columns = im2col(image, kernel);
+            if constexpr (!Base::hasOperandX) {
+                return mapColumns(
+                    [&](auto const& yDerivative) {
+                        return DenseDerivative(columns * yDerivative);
+                    },
+                    Base::yPushForward());
+            } else {
+                return mapColumns(
+                    [&](auto const& xDerivative, auto const& yDerivative) {
+                        DenseDerivative deriv = pushForwardX(xDerivative);
+                        deriv.noalias() += columns * yDerivative;
+                        return deriv;
+                    },
+                    Base::xPushForward(), Base::yPushForward());
+            }
+        }
+    }
+
+    template <typename OtherDerivative>
+    void _pullBackImpl(OtherDerivative const& derivative)
+    {
+        auto const image  = promote<Derivative>(Base::xValue()).eval();
+        auto const kernel = promote<Derivative>(Base::yValue()).eval();
+        auto const rows   = outputRows(image, kernel);
+        auto const cols   = outputCols(image, kernel);
+
+        if constexpr (Base::hasOperandX) {
+            Base::xPullBack(mapRows(
+                [&](auto const& gradient) {
+                    DenseDerivative deriv = DenseDerivative::Zero(
+                        gradient.rows(), image.size());
+                    for (std::ptrdiff_t q = 0; q != kernel.cols(); ++q) {
+                        for (std::ptrdiff_t p = 0; p != kernel.rows(); ++p) {
+                            for (std::ptrdiff_t b = 0; b != cols; ++b) {
+                                deriv.middleCols(
+                                    p + (b + q) * image.rows(), rows)
+                                    += kernel(p, q)
+                                     * gradient.middleCols(b * rows, rows);
+                            }
+                        }
+                    }
+                    return deriv;
+                },
+                derivative));
+        }
+        if constexpr (Base::hasOperandY) {
+            auto const columns = im2col(image, kernel);
+            Base::yPullBack(mapRows(
+                [&](auto const& gradient) {
+                    return DenseDerivative(gradient * columns);
+                },
+                derivative));
+        }
+    }
+
+private:
+    [[nodiscard]] auto convolve() -> Value
+    {
+        auto const image  = Base::xValue().eval();
+        auto const kernel = Base::yValue().eval();
+        auto const rows   = outputRows(image, kernel);
+        auto const cols   = outputCols(image, kernel);
+
+        Value result = kernel(0, 0) * image.topLeftCorner(rows, cols);
+        for (std::ptrdiff_t q = 0; q != kernel.cols(); ++q) {
+            for (std::ptrdiff_t p = q == 0 ? 1 : 0; p < kernel.rows(); ++p) {
+                result += kernel(p, q) * image.block(p, q, rows, cols);
+            }
+        }
+        return result;
+    }
+
+    template <typename Image, typename Kernel>
+    static auto outputRows(Image const& image, Kernel const& kernel)
+        -> std::ptrdiff_t
+    {
+        assert(kernel.rows() > 0 && kernel.rows() <= image.rows()
+               && "KERNEL LARGER THAN IMAGE");
+        return image.rows() - kernel.rows() + 1;
+    }
+
+    template <typename Image, typename Kernel>
+    static auto outputCols(Image const& image, Kernel const& kernel)
+        -> std::ptrdiff_t
+    {
+        assert(kernel.cols() > 0 && kernel.cols() <= image.cols()
+               && "KERNEL LARGER THAN IMAGE");
+        return image.cols() - kernel.cols() + 1;
+    }
+
+    // the matrix P with columns vec(X_(p:, q:)), such that vec(Y) = P vec(K)
+    template <typename Image, typename Kernel>
+    static auto im2col(Image const& image, Kernel const& kernel)
+    {
+        auto const kernelRows = kernel.rows();
+        auto const kernelCols = kernel.cols();
+        auto const rows = image.rows() - kernelRows + 1;
+        auto const cols = image.cols() - kernelCols + 1;
+        auto columns    = DenseDerivative(rows * cols, kernelRows * kernelCols);
+        for (std::ptrdiff_t q = 0; q != kernelCols; ++q) {
+            for (std::ptrdiff_t p = 0; p != kernelRows; ++p) {
+                columns.col(p + q * kernelRows).reshaped(rows, cols)
+                    = image.block(p, q, rows, cols);
+            }
+        }
+        return columns;
+    }
+
+    internal::CachedValue<Value> mValue;
+};
+
+} // namespace AutoDiff::EigenAD
+
+namespace AutoDiff {
+
+AUTODIFF_MAKE_MATRIX_BINARY_OP(conv2d, EigenAD::Convolution2d);
+
+} // namespace AutoDiff
+
+#endif // AUTODIFF_SRC_EIGEN_CONVOLUTIONS_OPS_CONVOLUTION_2D_HPP
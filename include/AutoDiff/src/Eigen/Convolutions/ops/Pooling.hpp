@@ -0,0 +1,214 @@
+// Copyright (c) 2024 Matthias Krippner
+//
+// This software is released under the MIT License.
+// https://opensource.org/licenses/MIT
+
+#ifndef AUTODIFF_SRC_EIGEN_CONVOLUTIONS_OPS_POOLING_HPP
+#define AUTODIFF_SRC_EIGEN_CONVOLUTIONS_OPS_POOLING_HPP
+
+namespace AutoDiff::EigenAD {
+
+/**
+ * @brief Max or average pooling over non-overlapping windows of a matrix.
+ *
+ * Trailing rows and columns that do not fill a window are dropped.
+ * The derivatives select (max) or average (mean) rows of the tangent and
+ * scatter the gradient columns back, without forming the Jacobian.
+ */
+template <typename X, bool IsMax>
+class Pooling : public UnaryOperation<Pooling<X, IsMax>, X> {
+public:
+    using Base  = UnaryOperation<Pooling<X, IsMax>, X>;
+    using Value = detail::DenseMatrix<typename ValueType_t<X>::Scalar>;
+    using typename Base::Derivative;
+    using DenseDerivative = Dense_t<Derivative>;
+
+    Pooling(Expression<X> const& x, std::ptrdiff_t rows, std::ptrdiff_t cols)
+        : Base(x), mRows{rows}, mCols{cols}
+    {
+        assert(rows > 0 && cols > 0 && "EMPTY POOLING WINDOW");
+    }
+
+    void _releaseCacheImpl()
+    {
+        Base::_releaseCacheImpl();
+        mValue.release();
+    }
+
+    [[nodiscard]] auto _valueImpl() -> Value const&
+    {
+        return mValue([&]() { return pool(); });
+    }
+
+    [[nodiscard]] auto _pushForwardImpl()
+    {
+        auto const xValue = Base::xValue().eval();
+        if constexpr (IsMax) {
+            auto const sources = argmax(xValue);
+            return mapColumns(
+                [&](auto const& tangent) {
+                    auto deriv = DenseDerivative(
+                        static_cast<std::ptrdiff_t>(sources.size()),
+                        tangent.cols());
+                    for (std::size_t i = 0; i != sources.size(); ++i) {
+                        deriv.row(static_cast<std::ptrdiff_t>(i))
+                            = tangent.row(sources[i]);
+                    }
+                    return deriv;
+                },
+                Base::xPushForward());
+        } else {
+            auto const rows  = xValue.rows() / mRows;
+            auto const cols  = xValue.cols() / mCols;
+            auto const scale = windowScale();
+            return mapColumns(
+                [&](auto const& tangent) {
+                    DenseDerivative deriv
+                        = DenseDerivative::Zero(rows * cols, tangent.cols());
+                    forEachWindow(xValue.rows(), rows, cols,
+                        [&](std::ptrdiff_t target, std::ptrdiff_t source) {
+                            deriv.row(target) += scale * tangent.row(source);
+                        });
+                    return deriv;
+                },
+                Base::xPushForward());
+        }
+    }
+
+    template <typename OtherDerivative>
+    void _pullBackImpl(OtherDerivative const& derivative)
+    {
+        auto const xValue = Base::xValue().eval();
+        auto const size   = xValue.size();
+        if constexpr (IsMax) {
+            auto const sources = argmax(xValue);
+            Base::xPullBack(mapRows(
+                [&](auto const& gradient) {
+                    DenseDerivative deriv
+                        = DenseDerivative::Zero(gradient.rows(), size);
+                    for (std::size_t i = 0; i != sources.size(); ++i) {
+                        deriv.col(sources[i])
+                            += gradient.col(static_cast<std::ptrdiff_t>(i));
+                    }
+                    return deriv;
+                },
+                derivative));
+        } else {
+            auto const rows  = xValue.rows() / mRows;
+            auto const cols  = xValue.cols() / mCols;
+            auto const scale = windowScale();
+            Base::xPullBack(mapRows(
+                [&](auto const& gradient) {
+                    DenseDerivative deriv
+                        = DenseDerivative::Zero(gradient.rows(), size);
+                    forEachWindow(xValue.rows(), rows, cols,
+                        [&](std::ptrdiff_t target, std::ptrdiff_t source) {
+                            deriv.col(source) = scale * gradient.col(target);
+                        });
+                    return deriv;
+                },
+                derivative));
+        }
+    }
+
+private:
+    [[nodiscard]] auto pool() -> Value
+    {
+        auto const xValue = Base::xValue().eval();
+        auto const rows   = xValue.rows() / mRows;
+        auto const cols   = xValue.cols() / mCols;
+
+        auto result = Value(rows, cols);
+        for (std::ptrdiff_t b = 0; b != cols; ++b) {
+            for (std::ptrdiff_t a = 0; a != rows; ++a) {
+                auto const window
+                    = xValue.block(a * mRows, b * mCols, mRows, mCols);
+                if constexpr (IsMax) {
+                    result(a, b) = window.maxCoeff();
+                } else {
+                    result(a, b) = window.mean();
+                }
+            }
+        }
+        return result;
+    }
+
+    [[nodiscard]] auto windowScale() const
+    {
+        using Scalar = typename DenseDerivative::Scalar;
+        return Scalar(1) / static_cast<Scalar>(mRows * mCols);
+    }
+
+    // calls f(target, source) with the flat indices of each output
+    // coefficient and the input coefficients of its window
+    template <typename Function>
+    void forEachWindow(std::ptrdiff_t inputRows, std::ptrdiff_t rows,
+        std::ptrdiff_t cols, Function const& f) const
+    {
+        for (std::ptrdiff_t b = 0; b != cols; ++b) {
+            for (std::ptrdiff_t a = 0; a != rows; ++a) {
+                for (std::ptrdiff_t q = 0; q != mCols; ++q) {
+                    for (std::ptrdiff_t p = 0; p != mRows; ++p) {
+                        f(a + b * rows,
+                            a * mRows + p + (b * mCols + q) * inputRows);
+                    }
+                }
+            }
+        }
+    }
+
+    // the flat index of the maximum of each window
+    template <typename Matrix>
+    auto argmax(Matrix const& matrix) const -> std::vector<std::ptrdiff_t>
+    {
+        auto const rows = matrix.rows() / mRows;
+        auto const cols = matrix.cols() / mCols;
+        auto sources    = std::vector<std::ptrdiff_t>(
+            static_cast<std::size_t>(rows * cols));
+        for (std::ptrdiff_t b = 0; b != cols; ++b) {
+            for (std::ptrdiff_t a = 0; a != rows; ++a) {
+                std::ptrdiff_t p = 0;
+                std::ptrdiff_t q = 0;
+                matrix.block(a * mRows, b * mCols, mRows, mCols)
+                    .maxCoeff(&p, &q);
+                sources[static_cast<std::size_t>(a + b * rows)]
+                    = a * mRows + p + (b * mCols + q) * matrix.rows();
+            }
+        }
+        return sources;
+    }
+
+    std::ptrdiff_t mRows;
+    std::ptrdiff_t mCols;
+    internal::CachedValue<Value> mValue;
+};
+
+} // namespace AutoDiff::EigenAD
+
+namespace AutoDiff {
+
+/**
+ * @brief Maximum over non-overlapping windows with the given size.
+ */
+template <typename X>
+auto maxPool(Expression<X> const& x, std::ptrdiff_t rows, std::ptrdiff_t cols)
+    -> std::enable_if_t<EigenAD::hasMatrixBaseValue_v<X>,
+        EigenAD::Pooling<X, true>>
+{
+    return EigenAD::Pooling<X, true>(x, rows, cols);
+}
+
+/**
+ * @brief Mean over non-overlapping windows with the given size.
+ */
+template <typename X>
+auto avgPool(Expression<X> const& x, std::ptrdiff_t rows, std::ptrdiff_t cols)
+    -> std::enable_if_t<EigenAD::hasMatrixBaseValue_v<X>,
+        EigenAD::Pooling<X, false>>
+{
+    return EigenAD::Pooling<X, false>(x, rows, cols);
+}
+
+} // namespace AutoDiff
+
+#endif // AUTODIFF_SRC_EIGEN_CONVOLUTIONS_OPS_POOLING_HPP
@@ -0,0 +1,26 @@
+// Copyright (c) 2024 Matthias Krippner
+//
+// This software is released under the MIT License.
+// https://opensource.org/licenses/MIT
+
+#ifndef AUTODIFF_SRC_EIGEN_FUSED_COMMON_HPP
+#define AUTODIFF_SRC_EIGEN_FUSED_COMMON_HPP
+
+// included here instead of for each operation
+
+#include "../Products/factories.hpp"   // binary matrix operations
+#include "../Reductions/factories.hpp" // unary matrix operations
+
+#include "../../Core/BinaryOperation.hpp"
+#include "../../Core/Cached.hpp" // CachedValue
+#include "../../Core/UnaryOperation.hpp"
+#include "../LinearAlgebra/decompositions.hpp" // CachedDecomposition
+#include "../derivatives.hpp" // Dense_t mapColumns mapRows promote
+#include "kernels.hpp"
+
+#include <cassert>
+#include <cstddef>     // ptrdiff_t
+#include <type_traits> // is_same
+#include <utility>     // move
+
+#endif // AUTODIFF_SRC_EIGEN_FUSED_COMMON_HPP
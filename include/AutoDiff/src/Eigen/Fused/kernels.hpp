@@ -0,0 +1,171 @@
+// Copyright (c) 2024 Matthias Krippner
+//
+// This software is released under the MIT License.
+// https://opensource.org/licenses/MIT
+
+/**
+ * @file kernels.hpp
+ * @brief Numerically stable kernels shared by the fused operations.
+ *
+ * The columns of a matrix are independent samples.
+ */
+
+#ifndef AUTODIFF_SRC_EIGEN_FUSED_KERNELS_HPP
+#define AUTODIFF_SRC_EIGEN_FUSED_KERNELS_HPP
+
+#include <cmath>   // exp log sqrt
+#include <cstddef> // ptrdiff_t
+#include <utility> // make_pair
+
+namespace AutoDiff::EigenAD::Fused {
+
+/**
+ * @brief The log-sum-exp of each column, as row.
+ *
+ * Computed in one pass over the coefficients: the running sum is rescaled
+ * whenever the running maximum increases, so no exponent is positive.
+ */
+template <typename Matrix>
+auto logSumExpColumns(Matrix const& matrix)
+{
+    using std::exp;
+    using std::log;
+    using Scalar = typename Matrix::Scalar;
+    auto result  = matrix.row(0).eval();
+    for (std::ptrdiff_t j = 0; j != matrix.cols(); ++j) {
+        auto max = matrix(0, j);
+        auto sum = Scalar(1);
+        for (std::ptrdiff_t i = 1; i < matrix.rows(); ++i) {
+            auto const coeff = matrix(i, j);
+            if (coeff > max) {
+                sum = sum * exp(max - coeff) + Scalar(1);
+                max = coeff;
+            } else {
+                sum += exp(coeff - max);
+            }
+        }
+        result(j) = max + log(sum);
+    }
+    return result;
+}
+
+/**
+ * @brief The logarithm of the softmax of each column.
+ */
+template <typename Matrix>
+auto logSoftmaxColumns(Matrix const& matrix)
+{
+    return (matrix.rowwise() - logSumExpColumns(matrix)).eval();
+}
+
+/**
+ * @brief The softmax of each column.
+ */
+template <typename Matrix>
+auto softmaxColumns(Matrix const& matrix)
+{
+    auto result = logSoftmaxColumns(matrix);
+    result      = result.array().exp().matrix();
+    return result;
+}
+
+/**
+ * @brief Normalizes each column to zero mean and unit variance.
+ *
+ * The mean and the (biased) variance are accumulated in one pass over the
+ * coefficients (Welford's algorithm).
+ *
+ * @return the normalized matrix and the reciprocal standard deviation of
+ * each column, as row
+ */
+template <typename Matrix>
+auto normalizeColumns(Matrix const& matrix, double epsilon)
+{
+    using std::sqrt;
+    using Scalar    = typename Matrix::Scalar;
+    auto normalized = matrix.eval();
+    auto invStd     = matrix.row(0).eval();
+    for (std::ptrdiff_t j = 0; j != matrix.cols(); ++j) {
+        auto mean  = Scalar(0);
+        auto sumSq = Scalar(0);
+        for (std::ptrdiff_t i = 0; i != matrix.rows(); ++i) {
+            auto const coeff = matrix(i, j);
+            auto const delta = coeff - mean;
+            mean += delta / Scalar(i + 1);
+            sumSq += delta * (coeff - mean);
+        }
+        auto const variance = sumSq / Scalar(matrix.rows());
+        invStd(j) = Scalar(1) / sqrt(variance + Scalar(epsilon));
+        normalized.col(j).array() -= mean;
+        normalized.col(j) *= invStd(j);
+    }
+    return std::make_pair(normalized, invStd);
+}
+
+/**
+ * @brief Normalizes each row to zero mean and unit variance.
+ *
+ * Like normalizeColumns, but the running statistics are updated with one
+ * column at a time to traverse the coefficients in storage order.
+ *
+ * @return the normalized matrix and the reciprocal standard deviation of
+ * each row, as column
+ */
+template <typename Matrix>
+auto normalizeRows(Matrix const& matrix, double epsilon)
+{
+    using Scalar = typename Matrix::Scalar;
+    auto mean    = matrix.col(0).eval();
+    auto sumSq   = matrix.col(0).eval();
+    mean.setZero();
+    sumSq.setZero();
+    for (std::ptrdiff_t j = 0; j != matrix.cols(); ++j) {
+        auto const delta = (matrix.col(j) - mean).eval();
+        mean += delta / Scalar(j + 1);
+        sumSq += delta.cwiseProduct(matrix.col(j) - mean);
+    }
+    auto const invStd = ((sumSq / Scalar(matrix.cols())).array()
+                         + Scalar(epsilon))
+                            .sqrt()
+                            .inverse()
+                            .matrix()
+                            .eval();
+    auto normalized = (invStd.asDiagonal() * (matrix.colwise() - mean)).eval();
+    return std::make_pair(normalized, invStd);
+}
+
+/**
+ * @brief Applies the Jacobian of normalizeColumns to a matrix of the same
+ * shape.
+ *
+ * The Jacobian of each column is symmetric, so this is both the pushforward
+ * of a tangent and the pullback of a gradient.
+ */
+template <typename Matrix, typename Normalized, typename InvStd>
+auto normalizeColumnsJacobian(Matrix const& matrix,
+    Normalized const& normalized, InvStd const& invStd)
+{
+    auto const projection = matrix.cwiseProduct(normalized).colwise().mean();
+    return (((matrix.rowwise() - matrix.colwise().mean())
+                - normalized * projection.asDiagonal())
+            * invStd.asDiagonal())
+        .eval();
+}
+
+/**
+ * @brief Applies the Jacobian of normalizeRows to a matrix of the same shape.
+ */
+template <typename Matrix, typename Normalized, typename InvStd>
+auto normalizeRowsJacobian(Matrix const& matrix, Normalized const& normalized,
+    InvStd const& invStd)
+{
+    auto const projection = matrix.cwiseProduct(normalized).rowwise().mean();
+    return (invStd.asDiagonal()
+            * ((matrix.colwise() - matrix.rowwise().mean())
+                - projection.asDiagonal() * normalized))
+        .eval();
+}
+
+} // namespace AutoDiff::EigenAD::Fused
+
+#endif // AUTODIFF_SRC_EIGEN_FUSED_KERNELS_HPP
@@ -0,0 +1,26 @@
+// Copyright (c) 2024 Matthias Krippner
+//
+// This software is released under the MIT License.
+// https://opensource.org/licenses/MIT
+
+/**
+ * @file ops.hpp
+ * @brief Includes supported fused operations.
+ */
+
+#ifndef AUTODIFF_SRC_EIGEN_FUSED_OPS_HPP
+#define AUTODIFF_SRC_EIGEN_FUSED_OPS_HPP
+
+// avoid includes in operation headers
+#include "common.hpp"
+
+#include "ops/Affine.hpp"
+#include "ops/CrossEntropy.hpp"
+#include "ops/GaussianForm.hpp"
+#include "ops/LogDeterminantSPD.hpp"
+#include "ops/LogSoftmax.hpp"
+#include "ops/LogSumExp.hpp"
+#include "ops/Normalization.hpp"
+#include "ops/Softmax.hpp"
+
+#endif // AUTODIFF_SRC_EIGEN_FUSED_OPS_HPP
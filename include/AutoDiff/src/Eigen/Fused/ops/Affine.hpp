@@ -0,0 +1,265 @@
+// Copyright (c) 2024 Matthias Krippner
+//
+// This software is released under the MIT License.
+// https://opensource.org/licenses/MIT
+
+#ifndef AUTODIFF_SRC_EIGEN_FUSED_OPS_AFFINE_HPP
+#define AUTODIFF_SRC_EIGEN_FUSED_OPS_AFFINE_HPP
+
+namespace AutoDiff {
+
+/**
+ * @brief Activation functions of the fused affine operation.
+ */
+enum class Activation { Identity, Sigmoid, Tanh, ReLU };
+
+} // namespace AutoDiff
+
+namespace AutoDiff::EigenAD::Fused {
+
+/**
+ * @brief Dense layer act(W x + b) of a neural network.
+ *
+ * The columns of x are samples, the bias b is added to each of them.
+ * The weights W and the input x are the first and second operand of the
+ * base class; the bias is a third operand (expression or literal).
+ *
+ * The slope of the activation is computed once as a buffer. The pullback
+ * scales the gradient by it and then maps it to dW, dx and db with GEMMs.
+ */
+template <typename W, typename X, typename B>
+class Affine : public BinaryOperation<Affine<W, X, B>, W, X> {
+public:
+    using Base  = BinaryOperation<Affine<W, X, B>, W, X>;
+    using Value = std::decay_t<decltype(
+        (std::declval<ValueType_t<W>>() * std::declval<ValueType_t<X>>())
+            .eval())>;
+    using typename Base::Derivative;
+    using DenseDerivative = Dense_t<Derivative>;
+
+    Affine(W const& weights, X const& input, B bias, Activation activation)
+        : Base(weights, input)
+        , mBias{std::move(bias)}
+        , mActivation{activation}
+    {
+        if constexpr (hasBias) {
+            static_assert(std::is_same_v<Derivative, typename B::Derivative>,
+                "OPERANDS MUST HAVE THE SAME DERIVATIVE TYPE");
+        }
+    }
+
+    // Expression implementation ===============================================
+
+    void _transferChildrenToImpl(internal::Node& node)
+    {
+        Base::_transferChildrenToImpl(node);
+        if constexpr (hasBias) {
+            mBias._transferChildrenTo(node);
+        }
+    }
+
+    void _releaseCacheImpl()
+    {
+        Base::_releaseCacheImpl();
+        if constexpr (hasBias) {
+            mBias._releaseCache();
+        }
+        mValue.release();
+    }
+
+    [[nodiscard]] auto _valueImpl() -> Value const&
+    {
+        return mValue([&]() {
+            return forward(Base::xValue(), Base::yValue(), biasValue());
+        });
+    }
+
+    [[nodiscard]] auto _pushForwardImpl()
+    {
+        auto const wValue = promote<Derivative>(Base::xValue()).eval();
+        auto const xValue = promote<Derivative>(Base::yValue()).eval();
+        auto const rows   = wValue.rows();
+        auto const inner  = wValue.cols();
+        auto const cols   = xValue.cols();
+
+        // as for the matrix product, see MatrixProduct
+        auto const pushForwardW = [&](auto const& wDerivative) {
+            auto const derivCols = wDerivative.cols();
+            auto deriv = DenseDerivative(rows * cols, derivCols);
+            for (std::ptrdiff_t j = 0; j != derivCols; ++j) {
+                deriv.col(j).reshaped(rows, cols).noalias()
+                    = wDerivative.col(j).reshaped(rows, inner) * xValue;
+            }
+            return deriv;
+        };
+        auto const pushForwardX = [&](auto const& xDerivative) {
+            auto const derivCols = xDerivative.cols();
+            auto deriv = DenseDerivative(rows * cols, derivCols);
+            deriv.reshaped(rows, cols * derivCols).noalias()
+                = wValue * xDerivative.reshaped(inner, cols * derivCols);
+            return deriv;
+        };
+
+        DenseDerivative deriv = [&] {
+            if constexpr (!Base::hasOperandX) {
+                return mapColumns(pushForwardX, Base::yPushForward());
+            } else if constexpr (!Base::hasOperandY) {
+                return mapColumns(pushForwardW, Base::xPushForward());
+            } else {
+                return mapColumns(
+                    [&](auto const& wDerivative, auto const& xDerivative) {
+                        DenseDerivative sum = pushForwardW(wDerivative);
+                        sum += pushForwardX(xDerivative);
+                        return sum;
+                    },
+                    Base::xPushForward(), Base::yPushForward());
+            }
+        }();
+        if constexpr (hasBias) {
+            // the bias tangent is replicated for each sample
+            auto const bDerivative = densify(mBias._pushForward());
+            for (std::ptrdiff_t j = 0; j != cols; ++j) {
+                deriv.middleRows(j * rows, rows) += bDerivative;
+            }
+        }
+        if (mActivation != Activation::Identity) {
+            auto const slope = activationSlope(
+                forward(wValue, xValue, promote<Derivative>(biasValue())));
+            deriv = slope.reshaped().asDiagonal() * deriv;
+        }
+        return deriv;
+    }
+
+    template <typename OtherDerivative>
+    void _pullBackImpl(OtherDerivative const& derivative)
+    {
+        auto const wValue = promote<Derivative>(Base::xValue()).eval();
+        auto const xValue = promote<Derivative>(Base::yValue()).eval();
+        auto const rows   = wValue.rows();
+        auto const inner  = wValue.cols();
+        auto const cols   = xValue.cols();
+
+        // the gradient by the pre-activation, shared by all operands
+        DenseDerivative gradient = densify(derivative);
+        if (mActivation != Activation::Identity) {
+            auto const slope = activationSlope(
+                forward(wValue, xValue, promote<Derivative>(biasValue())));
+            gradient = gradient * slope.reshaped().asDiagonal();
+        }
+        auto const derivRows = gradient.rows();
+
+        if constexpr (Base::hasOperandX) {
+            // the gradient rows stacked on top of each other, one GEMM
+            auto deriv = DenseDerivative(derivRows, rows * inner);
+            deriv.reshaped(derivRows * rows, inner).noalias()
+                = gradient.reshaped(derivRows * rows, cols)
+                * xValue.transpose();
+            Base::xPullBack(deriv);
+        }
+        if constexpr (Base::hasOperandY) {
+            // one GEMM for each sample
+            auto deriv = DenseDerivative(derivRows, inner * cols);
+            for (std::ptrdiff_t j = 0; j != cols; ++j) {
+                deriv.middleCols(j * inner, inner).noalias()
+                    = gradient.middleCols(j * rows, rows) * wValue;
+            }
+            Base::yPullBack(deriv);
+        }
+        if constexpr (hasBias) {
+            // sum over the samples
+            mBias._pullBack(DenseDerivative(
+                gradient.reshaped(derivRows * rows, cols)
+                    .rowwise()
+                    .sum()
+                    .reshaped(derivRows, rows)));
+        }
+    }
+
+private:
+    static constexpr bool hasBias = isExpression_v<B>;
+
+    auto biasValue() -> decltype(auto)
+    {
+        if constexpr (hasBias) {
+            return mBias._value();
+        } else {
+            return (mBias);
+        }
+    }
+
+    template <typename WValue, typename XValue, typename BValue>
+    [[nodiscard]] auto forward(WValue const& weights, XValue const& input,
+        BValue const& bias) const
+    {
+        auto result  = (weights * input).eval();
+        using Scalar = typename decltype(result)::Scalar;
+        result.colwise() += bias;
+        switch (mActivation) {
+        case Activation::Identity:
+            break;
+        case Activation::Sigmoid:
+            result = (Scalar(1) + (-result.array()).exp()).inverse().matrix();
+            break;
+        case Activation::Tanh:
+            result = result.array().tanh().matrix();
+            break;
+        case Activation::ReLU:
+            result = result.cwiseMax(Scalar(0));
+            break;
+        }
+        return result;
+    }
+
+    // the derivative of the activation, in terms of its value
+    template <typename Value>
+    [[nodiscard]] auto activationSlope(Value const& value) const
+    {
+        using Scalar = typename Value::Scalar;
+        auto slope   = Value(value.rows(), value.cols());
+        switch (mActivation) {
+        case Activation::Identity:
+            slope.setOnes();
+            break;
+        case Activation::Sigmoid:
+            slope = value.array() * (Scalar(1) - value.array());
+            break;
+        case Activation::Tanh:
+            slope = Scalar(1) - value.array().square();
+            break;
+        case Activation::ReLU:
+            slope = (value.array() > Scalar(0)).template cast<Scalar>();
+            break;
+        }
+        return slope;
+    }
+
+    B mBias;
+    Activation mActivation;
+    internal::CachedValue<Value> mValue;
+};
+
+} // namespace AutoDiff::EigenAD::Fused
+
+namespace AutoDiff {
+
+/**
+ * @brief Dense layer act(W x + b), with the samples as columns of x.
+ *
+ * The weights, input and bias may be expressions or literals, but
+ * the weights or the input must be an expression.
+ */
+template <typename W, typename X, typename B>
+auto affine(W const& weights, X const& input, B const& bias,
+    Activation activation = Activation::Identity)
+    -> std::enable_if_t<(isExpression_v<W> || isExpression_v<X>)
+                            && EigenAD::hasMatrixBaseValue_v<W>
+                            && EigenAD::hasMatrixBaseValue_v<X>
+                            && EigenAD::hasColVectorValue_v<B>,
+        EigenAD::Fused::Affine<W, X, B>>
+{
+    return EigenAD::Fused::Affine<W, X, B>(weights, input, bias, activation);
+}
+
+} // namespace AutoDiff
+
+#endif // AUTODIFF_SRC_EIGEN_FUSED_OPS_AFFINE_HPP
@@ -0,0 +1,112 @@
+// Copyright (c) 2024 Matthias Krippner
+//
+// This software is released under the MIT License.
+// https://opensource.org/licenses/MIT
+
+#ifndef AUTODIFF_SRC_EIGEN_FUSED_OPS_CROSS_ENTROPY_HPP
+#define AUTODIFF_SRC_EIGEN_FUSED_OPS_CROSS_ENTROPY_HPP
+
+namespace AutoDiff::EigenAD::Fused {
+
+/**
+ * @brief Cross-entropy of target probabilities and the softmax of logits.
+ *
+ * -sum_j t_j^T log(softmax(z_j)), summed over the columns (samples).
+ * The gradient by the logits is s_j (1^T t_j) - t_j, i.e., s - t for
+ * normalized targets; the gradient by the targets is -log(softmax(z)).
+ */
+template <typename X, typename Y>
+class CrossEntropy : public BinaryOperation<CrossEntropy<X, Y>, X, Y> {
+public:
+    using Base  = BinaryOperation<CrossEntropy<X, Y>, X, Y>;
+    using Value = typename ValueType_t<X>::Scalar;
+    using Base::Base;
+    using typename Base::Derivative;
+    using DenseDerivative = Dense_t<Derivative>;
+
+    void _releaseCacheImpl()
+    {
+        Base::_releaseCacheImpl();
+        mValue.release();
+    }
+
+    [[nodiscard]] auto _valueImpl() -> Value const&
+    {
+        return mValue([&]() {
+            auto const logits  = Base::xValue().eval();
+            auto const targets = Base::yValue().eval();
+            return -targets.cwiseProduct(logSoftmaxColumns(logits)).sum();
+        });
+    }
+
+    [[nodiscard]] auto _pushForwardImpl()
+    {
+        if constexpr (!Base::hasOperandX) {
+            auto const yDeriv = this->yDeriv();
+            return mapColumns(
+                [&](auto const& tangent) {
+                    return DenseDerivative(yDeriv * tangent);
+                },
+                Base::yPushForward());
+        } else if constexpr (!Base::hasOperandY) {
+            auto const xDeriv = this->xDeriv();
+            return mapColumns(
+                [&](auto const& tangent) {
+                    return DenseDerivative(xDeriv * tangent);
+                },
+                Base::xPushForward());
+        } else {
+            auto const xDeriv = this->xDeriv();
+            auto const yDeriv = this->yDeriv();
+            return mapColumns(
+                [&](auto const& xTangent, auto const& yTangent) {
+                    return DenseDerivative(
+                        xDeriv * xTangent + yDeriv * yTangent);
+                },
+                Base::xPushForward(), Base::yPushForward());
+        }
+    }
+
+    template <typename OtherDerivative>
+    void _pullBackImpl(OtherDerivative const& derivative)
+    {
+        if constexpr (Base::hasOperandX) {
+            auto const xDeriv = this->xDeriv();
+            Base::xPullBack(derivative * xDeriv);
+        }
+        if constexpr (Base::hasOperandY) {
+            auto const yDeriv = this->yDeriv();
+            Base::yPullBack(derivative * yDeriv);
+        }
+    }
+
+private:
+    // the gradients as rows of the flattened coefficients
+
+    [[nodiscard]] auto xDeriv()
+    {
+        auto const targets = promote<Derivative>(Base::yValue()).eval();
+        auto deriv = softmaxColumns(promote<Derivative>(Base::xValue()).eval());
+        deriv.array().rowwise() *= targets.colwise().sum().array();
+        deriv -= targets;
+        return deriv.reshaped().transpose().eval();
+    }
+
+    [[nodiscard]] auto yDeriv()
+    {
+        auto const logits = promote<Derivative>(Base::xValue()).eval();
+        return (-logSoftmaxColumns(logits)).reshaped().transpose().eval();
+    }
+
+    internal::CachedValue<Value> mValue;
+};
+
+} // namespace AutoDiff::EigenAD::Fused
+
+namespace AutoDiff {
+
+AUTODIFF_MAKE_MATRIXBASE_BINARY_OP(crossEntropy, EigenAD::Fused::CrossEntropy)
+
+} // namespace AutoDiff
+
+#endif // AUTODIFF_SRC_EIGEN_FUSED_OPS_CROSS_ENTROPY_HPP
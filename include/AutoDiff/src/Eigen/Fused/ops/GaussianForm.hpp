@@ -0,0 +1,190 @@
+// Copyright (c) 2024 Matthias Krippner
+//
+// This software is released under the MIT License.
+// https://opensource.org/licenses/MIT
+
+#ifndef AUTODIFF_SRC_EIGEN_FUSED_OPS_GAUSSIAN_FORM_HPP
+#define AUTODIFF_SRC_EIGEN_FUSED_OPS_GAUSSIAN_FORM_HPP
+
+namespace AutoDiff::EigenAD::Fused {
+
+/**
+ * @brief Quadratic form x^T S^-1 x, or Gaussian log-likelihood of x,
+ * with a symmetric positive definite matrix S.
+ *
+ * The forms of the columns (samples) of x are summed. The log-likelihood of
+ * k zero-mean samples of dimension n with covariance S is
+ *   -(x^T S^-1 x + k log det S + n k log 2 pi) / 2.
+ * Both are computed from the Cholesky decomposition S = L L^T, which is
+ * computed once per evaluation, as x^T S^-1 x = ||L^-1 x||^2.
+ * The gradients follow from a = S^-1 x with triangular solves,
+ *   quadratic form:   S' = -a a^T,                 x' = 2 a,
+ *   log-likelihood:   S' = (a a^T - k S^-1) / 2,   x' = -a,
+ * where the symmetric matrices are computed in one triangle.
+ */
+template <typename S, typename X, bool IsLogLikelihood>
+class GaussianForm
+    : public BinaryOperation<GaussianForm<S, X, IsLogLikelihood>, S, X> {
+public:
+    using Base  = BinaryOperation<GaussianForm<S, X, IsLogLikelihood>, S, X>;
+    using Value = typename ValueType_t<X>::Scalar;
+    using Base::Base;
+    using typename Base::Derivative;
+    using DenseDerivative = Dense_t<Derivative>;
+
+    // Expression implementation ===============================================
+
+    void _releaseCacheImpl()
+    {
+        Base::_releaseCacheImpl();
+        mDecomposition.release();
+        mValue.release();
+    }
+
+    [[nodiscard]] auto _valueImpl() -> Value const&
+    {
+        return mValue([&]() {
+            using Scalar = typename Derivative::Scalar;
+            auto const& cholesky = this->cholesky();
+            auto const x         = promote<Derivative>(Base::yValue()).eval();
+            auto value = cholesky.matrixL().solve(x).squaredNorm();
+            if constexpr (IsLogLikelihood) {
+                auto const samples = Scalar(x.cols());
+                value += samples * logDeterminantFromCholesky(cholesky)
+                       + samples * Scalar(x.rows()) * Scalar(logTwoPi);
+                value /= Scalar(-2);
+            }
+            return static_cast<Value>(value);
+        });
+    }
+
+    [[nodiscard]] auto _pushForwardImpl()
+    {
+        auto const solution = this->solution();
+        if constexpr (!Base::hasOperandX) {
+            auto const xDeriv = this->xDeriv(solution);
+            return mapColumns(
+                [&](auto const& tangent) {
+                    return DenseDerivative(xDeriv * tangent);
+                },
+                Base::yPushForward());
+        } else if constexpr (!Base::hasOperandY) {
+            auto const sDeriv = this->sDeriv(solution);
+            return mapColumns(
+                [&](auto const& tangent) {
+                    return DenseDerivative(sDeriv * tangent);
+                },
+                Base::xPushForward());
+        } else {
+            auto const sDeriv = this->sDeriv(solution);
+            auto const xDeriv = this->xDeriv(solution);
+            return mapColumns(
+                [&](auto const& sTangent, auto const& xTangent) {
+                    return DenseDerivative(
+                        sDeriv * sTangent + xDeriv * xTangent);
+                },
+                Base::xPushForward(), Base::yPushForward());
+        }
+    }
+
+    template <typename OtherDerivative>
+    void _pullBackImpl(OtherDerivative const& derivative)
+    {
+        auto const solution = this->solution();
+        if constexpr (Base::hasOperandX) {
+            auto const sDeriv = this->sDeriv(solution);
+            Base::xPullBack(derivative * sDeriv);
+        }
+        if constexpr (Base::hasOperandY) {
+            auto const xDeriv = this->xDeriv(solution);
+            Base::yPullBack(derivative * xDeriv);
+        }
+    }
+
+private:
+    static constexpr double logTwoPi = 1.83787706640934548356;
+
+    [[nodiscard]] auto cholesky() -> decltype(auto)
+    {
+        auto const& cholesky = mDecomposition([&]() -> decltype(auto) {
+            return promote<Derivative>(Base::xValue());
+        });
+        assert(succeeded(cholesky) && "MATRIX NOT POSITIVE DEFINITE");
+        return cholesky;
+    }
+
+    // a = S^-1 x, in derivative precision
+    [[nodiscard]] auto solution()
+    {
+        return cholesky().solve(promote<Derivative>(Base::yValue())).eval();
+    }
+
+    // the gradients as rows of the flattened coefficients
+
+    template <typename Solution>
+    [[nodiscard]] auto sDeriv(Solution const& solution)
+    {
+        auto const& cholesky = this->cholesky();
+        using Cholesky       = std::decay_t<decltype(cholesky)>;
+        using Matrix         = typename Cholesky::MatrixType;
+        using Scalar         = typename Matrix::Scalar;
+        auto const size      = cholesky.rows();
+        Matrix deriv;
+        if constexpr (IsLogLikelihood) {
+            deriv = Scalar(-0.5 * solution.cols()) * inverseSPD(cholesky);
+            deriv.template selfadjointView<Cholesky::UpLo>().rankUpdate(
+                solution, Scalar(0.5));
+        } else {
+            deriv = Matrix::Zero(size, size);
+            deriv.template selfadjointView<Cholesky::UpLo>().rankUpdate(
+                solution, Scalar(-1));
+        }
+        // copy the computed triangle to the other one
+        deriv = deriv.template selfadjointView<Cholesky::UpLo>();
+        return deriv.reshaped().transpose().eval();
+    }
+
+    template <typename Solution>
+    [[nodiscard]] static auto xDeriv(Solution const& solution)
+    {
+        using Scalar = typename Solution::Scalar;
+        auto const factor = IsLogLikelihood ? Scalar(-1) : Scalar(2);
+        return (factor * solution.reshaped().transpose()).eval();
+    }
+
+    CholeskyDecomposition<Derivative> mDecomposition;
+    internal::CachedValue<Value> mValue;
+};
+
+template <typename S, typename X>
+using InverseQuadraticForm = GaussianForm<S, X, false>;
+template <typename S, typename X>
+using GaussianLogLikelihood = GaussianForm<S, X, true>;
+
+} // namespace AutoDiff::EigenAD::Fused
+
+namespace AutoDiff {
+
+/**
+ * @brief Quadratic form x^T S^-1 x with a symmetric positive definite S,
+ * summed over the columns of x.
+ *
+ * Only the lower triangle of S is read.
+ * Requires including @c <Eigen/Cholesky>.
+ */
+AUTODIFF_MAKE_MATRIXBASE_BINARY_OP(
+    inverseQuadraticForm, EigenAD::Fused::InverseQuadraticForm)
+
+/**
+ * @brief Log-likelihood of zero-mean Gaussian samples (columns of x)
+ * with symmetric positive definite covariance S.
+ *
+ * Only the lower triangle of S is read.
+ * Requires including @c <Eigen/Cholesky>.
+ */
+AUTODIFF_MAKE_MATRIXBASE_BINARY_OP(
+    gaussianLogLikelihood, EigenAD::Fused::GaussianLogLikelihood)
+
+} // namespace AutoDiff
+
+#endif // AUTODIFF_SRC_EIGEN_FUSED_OPS_GAUSSIAN_FORM_HPP
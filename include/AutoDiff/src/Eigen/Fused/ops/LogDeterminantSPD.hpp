@@ -0,0 +1,95 @@
+// Copyright (c) 2024 Matthias Krippner
+//
+// This software is released under the MIT License.
+// https://opensource.org/licenses/MIT
+
+#ifndef AUTODIFF_SRC_EIGEN_FUSED_OPS_LOG_DETERMINANT_SPD_HPP
+#define AUTODIFF_SRC_EIGEN_FUSED_OPS_LOG_DETERMINANT_SPD_HPP
+
+namespace AutoDiff::EigenAD::Fused {
+
+/**
+ * @brief Log-determinant of a symmetric positive definite matrix S.
+ *
+ * Computed as 2 sum_i log L_ii from the Cholesky decomposition S = L L^T,
+ * which is computed once per evaluation and takes half the flops of an
+ * LU decomposition. The gradient S^-1 = L^-T L^-1 is formed from the
+ * triangular inverse, computing only one triangle.
+ */
+template <typename S>
+class LogDeterminantSPD : public UnaryOperation<LogDeterminantSPD<S>, S> {
+public:
+    using Base  = UnaryOperation<LogDeterminantSPD<S>, S>;
+    using Value = typename ValueType_t<S>::Scalar;
+    using Base::Base;
+    using typename Base::Derivative;
+    using DenseDerivative = Dense_t<Derivative>;
+
+    // Expression implementation ===============================================
+
+    void _releaseCacheImpl()
+    {
+        Base::_releaseCacheImpl();
+        mDecomposition.release();
+        mValue.release();
+    }
+
+    [[nodiscard]] auto _valueImpl() -> Value const&
+    {
+        return mValue([&]() {
+            return static_cast<Value>(logDeterminantFromCholesky(cholesky()));
+        });
+    }
+
+    [[nodiscard]] auto _pushForwardImpl()
+    {
+        auto const xDeriv = this->xDeriv();
+        return mapColumns(
+            [&](auto const& tangent) {
+                return DenseDerivative(xDeriv * tangent);
+            },
+            Base::xPushForward());
+    }
+
+    template <typename OtherDerivative>
+    void _pullBackImpl(OtherDerivative const& derivative)
+    {
+        auto const xDeriv = this->xDeriv();
+        Base::xPullBack(derivative * xDeriv);
+    }
+
+private:
+    [[nodiscard]] auto cholesky() -> decltype(auto)
+    {
+        auto const& cholesky = mDecomposition([&]() -> decltype(auto) {
+            return promote<Derivative>(Base::xValue());
+        });
+        assert(succeeded(cholesky) && "MATRIX NOT POSITIVE DEFINITE");
+        return cholesky;
+    }
+
+    [[nodiscard]] auto xDeriv()
+    {
+        return inverseSPD(cholesky()).reshaped().transpose().eval();
+    }
+
+    CholeskyDecomposition<Derivative> mDecomposition;
+    internal::CachedValue<Value> mValue;
+};
+
+} // namespace AutoDiff::EigenAD::Fused
+
+namespace AutoDiff {
+
+/**
+ * @brief Log-determinant of a symmetric positive definite matrix.
+ *
+ * Only the lower triangle is read.
+ * Requires including @c <Eigen/Cholesky>.
+ */
+AUTODIFF_MAKE_MATRIXBASE_UNARY_OP(
+    logDeterminantSPD, EigenAD::Fused::LogDeterminantSPD)
+
+} // namespace AutoDiff
+
+#endif // AUTODIFF_SRC_EIGEN_FUSED_OPS_LOG_DETERMINANT_SPD_HPP
@@ -0,0 +1,91 @@
+// Copyright (c) 2024 Matthias Krippner
+//
+// This software is released under the MIT License.
+// https://opensource.org/licenses/MIT
+
+#ifndef AUTODIFF_SRC_EIGEN_FUSED_OPS_LOG_SOFTMAX_HPP
+#define AUTODIFF_SRC_EIGEN_FUSED_OPS_LOG_SOFTMAX_HPP
+
+namespace AutoDiff::EigenAD::Fused {
+
+/**
+ * @brief Logarithm of the softmax of each column.
+ *
+ * The Jacobian of each column is I - 1 s^T with the softmax s.
+ */
+template <typename X>
+class LogSoftmax : public UnaryOperation<LogSoftmax<X>, X> {
+public:
+    using Base  = UnaryOperation<LogSoftmax<X>, X>;
+    using Value = internal::Evaluated_t<ValueType_t<X>>;
+    using Base::Base;
+    using typename Base::Derivative;
+    using DenseDerivative = Dense_t<Derivative>;
+
+    void _releaseCacheImpl()
+    {
+        Base::_releaseCacheImpl();
+        mValue.release();
+    }
+
+    [[nodiscard]] auto _valueImpl() -> Value const&
+    {
+        return mValue(
+            [&]() { return logSoftmaxColumns(Base::xValue().eval()); });
+    }
+
+    [[nodiscard]] auto _pushForwardImpl()
+    {
+        auto const softmax = xSoftmax();
+        auto const rows    = softmax.rows();
+        return mapColumns(
+            [&](auto const& tangent) {
+                auto deriv = DenseDerivative(tangent.rows(), tangent.cols());
+                for (std::ptrdiff_t j = 0; j != softmax.cols(); ++j) {
+                    auto const block   = tangent.middleRows(j * rows, rows);
+                    auto const weights = (softmax.col(j).transpose() * block)
+                                             .eval();
+                    deriv.middleRows(j * rows, rows)
+                        = block.rowwise() - weights;
+                }
+                return deriv;
+            },
+            Base::xPushForward());
+    }
+
+    template <typename OtherDerivative>
+    void _pullBackImpl(OtherDerivative const& derivative)
+    {
+        auto const softmax = xSoftmax();
+        auto const rows    = softmax.rows();
+        Base::xPullBack(mapRows(
+            [&](auto const& gradient) {
+                auto deriv = DenseDerivative(gradient.rows(), gradient.cols());
+                for (std::ptrdiff_t j = 0; j != softmax.cols(); ++j) {
+                    auto const block = gradient.middleCols(j * rows, rows);
+                    deriv.middleCols(j * rows, rows) = block
+                        - block.rowwise().sum() * softmax.col(j).transpose();
+                }
+                return deriv;
+            },
+            derivative));
+    }
+
+private:
+    [[nodiscard]] auto xSoftmax()
+    {
+        return softmaxColumns(promote<Derivative>(Base::xValue()).eval());
+    }
+
+    internal::CachedValue<Value> mValue;
+};
+
+} // namespace AutoDiff::EigenAD::Fused
+
+namespace AutoDiff {
+
+AUTODIFF_MAKE_MATRIXBASE_UNARY_OP(logSoftmax, EigenAD::Fused::LogSoftmax)
+
+} // namespace AutoDiff
+
+#endif // AUTODIFF_SRC_EIGEN_FUSED_OPS_LOG_SOFTMAX_HPP
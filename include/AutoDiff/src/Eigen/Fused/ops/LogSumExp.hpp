@@ -0,0 +1,74 @@
+// Copyright (c) 2024 Matthias Krippner
+//
+// This software is released under the MIT License.
+// https://opensource.org/licenses/MIT
+
+#ifndef AUTODIFF_SRC_EIGEN_FUSED_OPS_LOG_SUM_EXP_HPP
+#define AUTODIFF_SRC_EIGEN_FUSED_OPS_LOG_SUM_EXP_HPP
+
+namespace AutoDiff::EigenAD::Fused {
+
+/**
+ * @brief Log-sum-exp of all coefficients.
+ *
+ * The gradient is the softmax of all coefficients.
+ */
+template <typename X>
+class LogSumExp : public UnaryOperation<LogSumExp<X>, X> {
+public:
+    using Base  = UnaryOperation<LogSumExp<X>, X>;
+    using Value = typename ValueType_t<X>::Scalar;
+    using Base::Base;
+    using typename Base::Derivative;
+    using DenseDerivative = Dense_t<Derivative>;
+
+    void _releaseCacheImpl()
+    {
+        Base::_releaseCacheImpl();
+        mValue.release();
+    }
+
+    [[nodiscard]] auto _valueImpl() -> Value const&
+    {
+        return mValue(
+            [&]() { return logSumExpColumns(Base::xValue().reshaped())(0); });
+    }
+
+    [[nodiscard]] auto _pushForwardImpl()
+    {
+        auto const xDeriv = this->xDeriv();
+        return mapColumns(
+            [&](auto const& tangent) {
+                return DenseDerivative(xDeriv * tangent);
+            },
+            Base::xPushForward());
+    }
+
+    template <typename OtherDerivative>
+    void _pullBackImpl(OtherDerivative const& derivative)
+    {
+        auto const xDeriv = this->xDeriv();
+        Base::xPullBack(derivative * xDeriv);
+    }
+
+private:
+    [[nodiscard]] auto xDeriv()
+    {
+        return softmaxColumns(
+            promote<Derivative>(Base::xValue()).reshaped().eval())
+            .transpose()
+            .eval();
+    }
+
+    internal::CachedValue<Value> mValue;
+};
+
+} // namespace AutoDiff::EigenAD::Fused
+
+namespace AutoDiff {
+
+AUTODIFF_MAKE_MATRIXBASE_UNARY_OP(logSumExp, EigenAD::Fused::LogSumExp)
+
+} // namespace AutoDiff
+
+#endif // AUTODIFF_SRC_EIGEN_FUSED_OPS_LOG_SUM_EXP_HPP
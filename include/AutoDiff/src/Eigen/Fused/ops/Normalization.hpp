@@ -0,0 +1,142 @@
+// Copyright (c) 2024 Matthias Krippner
+//
+// This software is released under the MIT License.
+// https://opensource.org/licenses/MIT
+
+#ifndef AUTODIFF_SRC_EIGEN_FUSED_OPS_NORMALIZATION_HPP
+#define AUTODIFF_SRC_EIGEN_FUSED_OPS_NORMALIZATION_HPP
+
+namespace AutoDiff::EigenAD::Fused {
+
+/**
+ * @brief Layer or batch normalization of a matrix whose columns are samples.
+ *
+ * Layer normalization normalizes each column (over the features), batch
+ * normalization each row (over the samples), to zero mean and unit variance.
+ * The derivatives use the compact formula
+ * r (d - mean(d) - y mean(d .* y)) with the normalized values y and the
+ * reciprocal standard deviation r of each group, without forming the Jacobian.
+ */
+template <typename X, bool IsBatch>
+class Normalization : public UnaryOperation<Normalization<X, IsBatch>, X> {
+public:
+    using Base  = UnaryOperation<Normalization<X, IsBatch>, X>;
+    using Value = internal::Evaluated_t<ValueType_t<X>>;
+    using typename Base::Derivative;
+    using DenseDerivative = Dense_t<Derivative>;
+
+    Normalization(Expression<X> const& x, double epsilon)
+        : Base(x), mEpsilon{epsilon}
+    {
+        assert(epsilon >= 0 && "NEGATIVE EPSILON");
+    }
+
+    void _releaseCacheImpl()
+    {
+        Base::_releaseCacheImpl();
+        mValue.release();
+    }
+
+    [[nodiscard]] auto _valueImpl() -> Value const&
+    {
+        return mValue(
+            [&]() { return normalize(Base::xValue().eval()).first; });
+    }
+
+    [[nodiscard]] auto _pushForwardImpl()
+    {
+        auto const normalization
+            = normalize(promote<Derivative>(Base::xValue()).eval());
+        return mapColumns(
+            [&](auto const& tangent) {
+                return applyJacobian(DenseDerivative(tangent), normalization);
+            },
+            Base::xPushForward());
+    }
+
+    template <typename OtherDerivative>
+    void _pullBackImpl(OtherDerivative const& derivative)
+    {
+        // the Jacobian is symmetric
+        auto const normalization
+            = normalize(promote<Derivative>(Base::xValue()).eval());
+        Base::xPullBack(mapRows(
+            [&](auto const& gradient) {
+                auto const columns = DenseDerivative(gradient.transpose());
+                return DenseDerivative(
+                    applyJacobian(columns, normalization).transpose());
+            },
+            derivative));
+    }
+
+private:
+    template <typename Matrix>
+    [[nodiscard]] auto normalize(Matrix const& matrix) const
+    {
+        if constexpr (IsBatch) {
+            return normalizeRows(matrix, mEpsilon);
+        } else {
+            return normalizeColumns(matrix, mEpsilon);
+        }
+    }
+
+    // applies the Jacobian to each column of the flattened coefficients
+    template <typename Normalization>
+    [[nodiscard]] static auto applyJacobian(
+        DenseDerivative const& columns, Normalization const& normalization)
+    {
+        auto const& [normalized, invStd] = normalization;
+        auto const rows = normalized.rows();
+        auto const cols = normalized.cols();
+        auto deriv      = DenseDerivative(columns.rows(), columns.cols());
+        for (std::ptrdiff_t c = 0; c != columns.cols(); ++c) {
+            auto const column = columns.col(c).reshaped(rows, cols);
+            if constexpr (IsBatch) {
+                deriv.col(c).reshaped(rows, cols)
+                    = normalizeRowsJacobian(column, normalized, invStd);
+            } else {
+                deriv.col(c).reshaped(rows, cols)
+                    = normalizeColumnsJacobian(column, normalized, invStd);
+            }
+        }
+        return deriv;
+    }
+
+    double mEpsilon;
+    internal::CachedValue<Value> mValue;
+};
+
+} // namespace AutoDiff::EigenAD::Fused
+
+namespace AutoDiff {
+
+/**
+ * @brief Normalizes each column (sample) to zero mean and unit variance.
+ *
+ * @param epsilon added to the variance for numerical stability
+ */
+template <typename X>
+auto layerNorm(Expression<X> const& x, double epsilon = 1e-5)
+    -> std::enable_if_t<EigenAD::hasMatrixBaseValue_v<X>,
+        EigenAD::Fused::Normalization<X, false>>
+{
+    return EigenAD::Fused::Normalization<X, false>(x, epsilon);
+}
+
+/**
+ * @brief Normalizes each row (feature) to zero mean and unit variance over
+ * the columns (samples).
+ *
+ * @param epsilon added to the variance for numerical stability
+ */
+template <typename X>
+auto batchNorm(Expression<X> const& x, double epsilon = 1e-5)
+    -> std::enable_if_t<EigenAD::hasMatrixBaseValue_v<X>,
+        EigenAD::Fused::Normalization<X, true>>
+{
+    return EigenAD::Fused::Normalization<X, true>(x, epsilon);
+}
+
+} // namespace AutoDiff
+
+#endif // AUTODIFF_SRC_EIGEN_FUSED_OPS_NORMALIZATION_HPP
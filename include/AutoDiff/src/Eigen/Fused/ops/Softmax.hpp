@@ -0,0 +1,93 @@
+// Copyright (c) 2024 Matthias Krippner
+//
+// This software is released under the MIT License.
+// https://opensource.org/licenses/MIT
+
+#ifndef AUTODIFF_SRC_EIGEN_FUSED_OPS_SOFTMAX_HPP
+#define AUTODIFF_SRC_EIGEN_FUSED_OPS_SOFTMAX_HPP
+
+namespace AutoDiff::EigenAD::Fused {
+
+/**
+ * @brief Softmax of each column.
+ *
+ * The Jacobian of each column is diag(s) - s s^T, applied in O(n) per
+ * tangent column or gradient row without forming it.
+ */
+template <typename X>
+class Softmax : public UnaryOperation<Softmax<X>, X> {
+public:
+    using Base  = UnaryOperation<Softmax<X>, X>;
+    using Value = internal::Evaluated_t<ValueType_t<X>>;
+    using Base::Base;
+    using typename Base::Derivative;
+    using DenseDerivative = Dense_t<Derivative>;
+
+    void _releaseCacheImpl()
+    {
+        Base::_releaseCacheImpl();
+        mValue.release();
+    }
+
+    [[nodiscard]] auto _valueImpl() -> Value const&
+    {
+        return mValue([&]() { return softmaxColumns(Base::xValue().eval()); });
+    }
+
+    [[nodiscard]] auto _pushForwardImpl()
+    {
+        auto const softmax = xSoftmax();
+        auto const rows    = softmax.rows();
+        return mapColumns(
+            [&](auto const& tangent) {
+                auto deriv = DenseDerivative(tangent.rows(), tangent.cols());
+                for (std::ptrdiff_t j = 0; j != softmax.cols(); ++j) {
+                    auto const s       = softmax.col(j);
+                    auto const block   = tangent.middleRows(j * rows, rows);
+                    auto const weights = (s.transpose() * block).eval();
+                    deriv.middleRows(j * rows, rows)
+                        = s.asDiagonal() * (block.rowwise() - weights);
+                }
+                return deriv;
+            },
+            Base::xPushForward());
+    }
+
+    template <typename OtherDerivative>
+    void _pullBackImpl(OtherDerivative const& derivative)
+    {
+        auto const softmax = xSoftmax();
+        auto const rows    = softmax.rows();
+        Base::xPullBack(mapRows(
+            [&](auto const& gradient) {
+                auto deriv = DenseDerivative(gradient.rows(), gradient.cols());
+                for (std::ptrdiff_t j = 0; j != softmax.cols(); ++j) {
+                    auto const s       = softmax.col(j);
+                    auto const block   = gradient.middleCols(j * rows, rows);
+                    auto const weights = (block * s).eval();
+                    deriv.middleCols(j * rows, rows)
+                        = (block.colwise() - weights) * s.asDiagonal();
+                }
+                return deriv;
+            },
+            derivative));
+    }
+
+private:
+    [[nodiscard]] auto xSoftmax()
+    {
+        return softmaxColumns(promote<Derivative>(Base::xValue()).eval());
+    }
+
+    internal::CachedValue<Value> mValue;
+};
+
+} // namespace AutoDiff::EigenAD::Fused
+
+namespace AutoDiff {
+
+AUTODIFF_MAKE_MATRIXBASE_UNARY_OP(softmax, EigenAD::Fused::Softmax)
+
+} // namespace AutoDiff
+
+#endif // AUTODIFF_SRC_EIGEN_FUSED_OPS_SOFTMAX_HPP
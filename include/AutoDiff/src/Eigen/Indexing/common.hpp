@@ -0,0 +1,25 @@
+// Copyright (c) 2024 Matthias Krippner
+//
+// This software is released under the MIT License.
+// https://opensource.org/licenses/MIT
+
+#ifndef AUTODIFF_SRC_EIGEN_INDEXING_COMMON_HPP
+#define AUTODIFF_SRC_EIGEN_INDEXING_COMMON_HPP
+
+// included here instead of for each operation
+
+#include "../../Core/Cached.hpp" // CachedValue
+#include "../../Core/NaryOperation.hpp"
+#include "../../Core/UnaryOperation.hpp"
+#include "../derivatives.hpp" // Dense_t gatherRows mapColumns mapRows
+#include "../traits.hpp"      // hasMatrixBaseValue isPlain
+
+#include <array>
+#include <cassert>
+#include <cstddef> // ptrdiff_t
+#include <tuple>   // apply get tie tuple_element
+#include <type_traits>
+#include <utility> // index_sequence move
+#include <vector>
+
+#endif // AUTODIFF_SRC_EIGEN_INDEXING_COMMON_HPP
@@ -0,0 +1,24 @@
+// Copyright (c) 2024 Matthias Krippner
+//
+// This software is released under the MIT License.
+// https://opensource.org/licenses/MIT
+
+/**
+ * @file ops.hpp
+ * @brief Includes supported indexing operations.
+ */
+
+#ifndef AUTODIFF_SRC_EIGEN_INDEXING_OPS_HPP
+#define AUTODIFF_SRC_EIGEN_INDEXING_OPS_HPP
+
+// avoid includes in operation headers
+#include "common.hpp"
+
+#include "ops/Block.hpp"
+#include "ops/Concatenation.hpp"
+#include "ops/Gather.hpp"
+#include "ops/Reshaped.hpp"
+#include "ops/ScatterAdd.hpp"
+#include "ops/Transpose.hpp"
+
+#endif // AUTODIFF_SRC_EIGEN_INDEXING_OPS_HPP
@@ -0,0 +1,171 @@
+// Copyright (c) 2024 Matthias Krippner
+//
+// This software is released under the MIT License.
+// https://opensource.org/licenses/MIT
+
+#ifndef AUTODIFF_SRC_EIGEN_INDEXING_OPS_BLOCK_HPP
+#define AUTODIFF_SRC_EIGEN_INDEXING_OPS_BLOCK_HPP
+
+namespace AutoDiff::EigenAD {
+
+/**
+ * @brief Block of a matrix, a view of its coefficients.
+ *
+ * @p Rows and @p Cols are the block sizes at compile time (-1 if dynamic),
+ * such that rows, columns and segments of vectors are vectors.
+ * The value is an Eigen block of the operand's value, which is not copied
+ * (unless the operand is a temporary matrix).
+ * The pushforward gathers the tangent rows of the block coefficients,
+ * the pullback scatters the gradient into the columns of these coefficients,
+ * one contiguous range per block column, without a selection matrix.
+ * Gradients are never padded to the size of the operand per block:
+ * sparse gradients are scattered like those of Gather, and dense ones
+ * are accumulated into the block columns only (see scatterBlock).
+ */
+template <typename X, int Rows = -1, int Cols = -1>
+class Block : public UnaryOperation<Block<X, Rows, Cols>, X> {
+public:
+    using Base = UnaryOperation<Block<X, Rows, Cols>, X>;
+    using typename Base::Derivative;
+    using DenseDerivative = Dense_t<Derivative>;
+
+    // block size extending to the last row or column of the operand
+    static constexpr std::ptrdiff_t all = -1;
+
+    Block(Expression<X> const& x, std::ptrdiff_t startRow,
+        std::ptrdiff_t startCol, std::ptrdiff_t rows, std::ptrdiff_t cols)
+        : Base(x)
+        , mStartRow{startRow}
+        , mStartCol{startCol}
+        , mRows{rows}
+        , mCols{cols}
+    {
+        assert(startRow >= 0 && startCol >= 0 && "NEGATIVE BLOCK START");
+        assert(rows >= all && cols >= all && "NEGATIVE BLOCK SIZE");
+    }
+
+    [[nodiscard]] auto _valueImpl() -> decltype(auto)
+    {
+        using XValue  = decltype(Base::xValue());
+        auto&& xValue = Base::xValue();
+        auto view     = xValue.template block<Rows, Cols>(mStartRow, mStartCol,
+            blockRows(xValue.rows()), blockCols(xValue.cols()));
+        if constexpr (isTemporary_v<XValue>) {
+            return view.eval(); // a view of the temporary would dangle
+        } else {
+            return view;
+        }
+    }
+
+    [[nodiscard]] auto _pushForwardImpl()
+    {
+        auto&& xValue        = Base::xValue();
+        auto const outerRows = xValue.rows();
+        auto const rows      = blockRows(outerRows);
+        auto const cols      = blockCols(xValue.cols());
+        return mapColumns(
+            [&](auto const& tangent) {
+                auto deriv = DenseDerivative(rows * cols, tangent.cols());
+                for (std::ptrdiff_t j = 0; j != cols; ++j) {
+                    deriv.middleRows(j * rows, rows) = tangent.middleRows(
+                        mStartRow + (mStartCol + j) * outerRows, rows);
+                }
+                return deriv;
+            },
+            Base::xPushForward());
+    }
+
+    template <typename OtherDerivative>
+    void _pullBackImpl(OtherDerivative const& derivative)
+    {
+        auto&& xValue        = Base::xValue();
+        auto const outerRows = xValue.rows();
+        auto const start     = mStartRow + mStartCol * outerRows;
+        Base::xPullBack(scatterBlock<Derivative>(
+            derivative, start, outerRows, blockRows(outerRows), xValue.size()));
+    }
+
+private:
+    [[nodiscard]] auto blockRows(std::ptrdiff_t outerRows) const
+        -> std::ptrdiff_t
+    {
+        return mRows == all ? outerRows - mStartRow : mRows;
+    }
+
+    [[nodiscard]] auto blockCols(std::ptrdiff_t outerCols) const
+        -> std::ptrdiff_t
+    {
+        return mCols == all ? outerCols - mStartCol : mCols;
+    }
+
+    std::ptrdiff_t mStartRow;
+    std::ptrdiff_t mStartCol;
+    std::ptrdiff_t mRows;
+    std::ptrdiff_t mCols;
+};
+
+} // namespace AutoDiff::EigenAD
+
+namespace AutoDiff {
+
+/**
+ * @brief The block of @p rows x @p cols coefficients of a matrix starting at
+ * (@p startRow, @p startCol).
+ *
+ * The block is a view of the matrix, like Eigen's @c block.
+ */
+template <typename X>
+auto block(Expression<X> const& x, std::ptrdiff_t startRow,
+    std::ptrdiff_t startCol, std::ptrdiff_t rows, std::ptrdiff_t cols)
+    -> std::enable_if_t<EigenAD::hasMatrixBaseValue_v<X>, EigenAD::Block<X>>
+{
+    assert(rows >= 0 && cols >= 0 && "NEGATIVE BLOCK SIZE");
+    return EigenAD::Block<X>(x, startRow, startCol, rows, cols);
+}
+
+/**
+ * @brief The @p size coefficients of a (column or row) vector starting at
+ * @p start.
+ */
+template <typename X>
+auto segment(Expression<X> const& x, std::ptrdiff_t start, std::ptrdiff_t size)
+    -> std::enable_if_t<EigenAD::hasColVectorValue_v<X>
+                            || EigenAD::hasRowVectorValue_v<X>,
+        EigenAD::Block<X, EigenAD::hasColVectorValue_v<X> ? -1 : 1,
+            EigenAD::hasColVectorValue_v<X> ? 1 : -1>>
+{
+    assert(size >= 0 && "NEGATIVE SEGMENT SIZE");
+    if constexpr (EigenAD::hasColVectorValue_v<X>) {
+        return EigenAD::Block<X, -1, 1>(x, start, 0, size, 1);
+    } else {
+        return EigenAD::Block<X, 1, -1>(x, 0, start, 1, size);
+    }
+}
+
+/**
+ * @brief The row @p index of a matrix, as row vector.
+ */
+template <typename X>
+auto row(Expression<X> const& x, std::ptrdiff_t index)
+    -> std::enable_if_t<EigenAD::hasMatrixBaseValue_v<X>,
+        EigenAD::Block<X, 1, -1>>
+{
+    return EigenAD::Block<X, 1, -1>(
+        x, index, 0, 1, EigenAD::Block<X, 1, -1>::all);
+}
+
+/**
+ * @brief The column @p index of a matrix, as column vector.
+ */
+template <typename X>
+auto col(Expression<X> const& x, std::ptrdiff_t index)
+    -> std::enable_if_t<EigenAD::hasMatrixBaseValue_v<X>,
+        EigenAD::Block<X, -1, 1>>
+{
+    return EigenAD::Block<X, -1, 1>(
+        x, 0, index, EigenAD::Block<X, -1, 1>::all, 1);
+}
+
+} // namespace AutoDiff
+
+#endif // AUTODIFF_SRC_EIGEN_INDEXING_OPS_BLOCK_HPP
@@ -0,0 +1,243 @@
+// Copyright (c) 2024 Matthias Krippner
+//
+// This software is released under the MIT License.
+// https://opensource.org/licenses/MIT
+
+#ifndef AUTODIFF_SRC_EIGEN_INDEXING_OPS_CONCATENATION_HPP
+#define AUTODIFF_SRC_EIGEN_INDEXING_OPS_CONCATENATION_HPP
+
+namespace AutoDiff::EigenAD {
+
+/**
+ * @brief Concatenation of matrices, stacking their rows if @p Vertical and
+ * their columns otherwise.
+ *
+ * Concatenating column vectors vertically or row vectors horizontally
+ * yields a vector.
+ * The value of each operand is written directly into its block of the result.
+ * The pushforward copies the tangent rows of each operand into their range,
+ * the pullback passes a view of the gradient columns to each operand,
+ * without copies for dense derivatives.
+ */
+template <bool Vertical, typename... Xs>
+class Concatenation
+    : public NaryOperation<Concatenation<Vertical, Xs...>, Xs...> {
+public:
+    using Base = NaryOperation<Concatenation<Vertical, Xs...>, Xs...>;
+    using Base::Base;
+    using typename Base::Derivative;
+    using DenseDerivative = Dense_t<Derivative>;
+
+    using Scalar = typename ValueType_t<
+        std::tuple_element_t<0, std::tuple<Xs...>>>::Scalar;
+    static constexpr int valueRows
+        = !Vertical && (hasRowVectorValue_v<Xs> && ...) ? 1 : -1;
+    static constexpr int valueCols
+        = Vertical && (hasColVectorValue_v<Xs> && ...) ? 1 : -1;
+    using Value = Eigen::Matrix<Scalar, valueRows, valueCols,
+        valueRows == 1 && valueCols != 1 ? 1 : 0, valueRows, valueCols>;
+
+    void _releaseCacheImpl()
+    {
+        Base::_releaseCacheImpl();
+        mValue.release();
+    }
+
+    [[nodiscard]] auto _valueImpl() -> Value const&
+    {
+        return mValue([&]() {
+            auto const values = Base::operandValues();
+            auto const shape  = shapeOf(values);
+            auto result       = Value(shape.rows, shape.cols);
+            std::apply(
+                [&](auto const&... value) {
+                    std::size_t k = 0;
+                    ((part(result, shape.offsets[k], shape.extents[k]) = value,
+                         ++k),
+                        ...);
+                },
+                values);
+            return result;
+        });
+    }
+
+    [[nodiscard]] auto _pushForwardImpl()
+    {
+        auto const shape = shapeOf(Base::operandValues());
+        return pushForward(shape, std::index_sequence_for<Xs...>());
+    }
+
+    template <typename OtherDerivative>
+    void _pullBackImpl(OtherDerivative const& derivative)
+    {
+        auto const shape = shapeOf(Base::operandValues());
+        if constexpr (isSparse_v<OtherDerivative>) {
+            pullBack(derivative, shape, std::index_sequence_for<Xs...>());
+        } else {
+            pullBack(densify(derivative), shape,
+                std::index_sequence_for<Xs...>());
+        }
+    }
+
+private:
+    // the size of the result and the rows (if vertical) or columns of the
+    // operands with their offsets in the result
+    struct Shape {
+        std::ptrdiff_t rows;
+        std::ptrdiff_t cols;
+        std::array<std::ptrdiff_t, sizeof...(Xs)> offsets;
+        std::array<std::ptrdiff_t, sizeof...(Xs)> extents;
+    };
+
+    template <typename Values>
+    [[nodiscard]] static auto shapeOf(Values const& values) -> Shape
+    {
+        auto shape = Shape{};
+        std::apply(
+            [&](auto const& first, auto const&... others) {
+                shape.rows = first.rows();
+                shape.cols = first.cols();
+                shape.extents[0] = Vertical ? first.rows() : first.cols();
+                std::size_t k = 0;
+                (addExtent(shape, ++k, others.rows(), others.cols()), ...);
+            },
+            values);
+        return shape;
+    }
+
+    static void addExtent(Shape& shape, std::size_t k, std::ptrdiff_t rows,
+        std::ptrdiff_t cols)
+    {
+        if constexpr (Vertical) {
+            assert(cols == shape.cols && "COLUMN COUNTS DO NOT MATCH");
+            shape.offsets[k] = shape.rows;
+            shape.extents[k] = rows;
+            shape.rows += rows;
+        } else {
+            assert(rows == shape.rows && "ROW COUNTS DO NOT MATCH");
+            shape.offsets[k] = shape.cols;
+            shape.extents[k] = cols;
+            shape.cols += cols;
+        }
+    }
+
+    // the block of a matrix with the coefficients of an operand
+    template <typename Matrix>
+    [[nodiscard]] static auto part(
+        Matrix& matrix, std::ptrdiff_t offset, std::ptrdiff_t extent)
+    {
+        if constexpr (Vertical) {
+            return matrix.middleRows(offset, extent);
+        } else {
+            return matrix.middleCols(offset, extent);
+        }
+    }
+
+    template <std::size_t... K>
+    [[nodiscard]] auto pushForward(
+        Shape const& shape, std::index_sequence<K...> /*indices*/)
+    {
+        return mapColumns(
+            [&](auto const&... tangents) {
+                auto const cols = std::get<0>(std::tie(tangents...)).cols();
+                auto deriv = DenseDerivative(shape.rows * shape.cols, cols);
+                (writeTangent(deriv, tangents, shape, shape.offsets[K],
+                     shape.extents[K]),
+                    ...);
+                return deriv;
+            },
+            Base::template operandPushForward<K>()...);
+    }
+
+    template <typename Tangent>
+    static void writeTangent(DenseDerivative& deriv, Tangent const& tangent,
+        Shape const& shape, std::ptrdiff_t offset, std::ptrdiff_t extent)
+    {
+        if constexpr (Vertical) {
+            // one range of rows per column of the result
+            for (std::ptrdiff_t j = 0; j != shape.cols; ++j) {
+                deriv.middleRows(offset + j * shape.rows, extent)
+                    = tangent.middleRows(j * extent, extent);
+            }
+        } else {
+            // the columns of an operand are contiguous
+            deriv.middleRows(offset * shape.rows, extent * shape.rows)
+                = tangent;
+        }
+    }
+
+    template <typename Gradient, std::size_t... K>
+    void pullBack(Gradient const& gradient, Shape const& shape,
+        std::index_sequence<K...> /*indices*/)
+    {
+        (Base::template operandPullBack<K>(gradientOf(
+             gradient, shape, shape.offsets[K], shape.extents[K])),
+            ...);
+    }
+
+    template <typename Gradient>
+    [[nodiscard]] static auto gradientOf(Gradient const& gradient,
+        Shape const& shape, std::ptrdiff_t offset, std::ptrdiff_t extent)
+    {
+        if constexpr (!Vertical) {
+            // the columns of an operand are contiguous
+            return gradient.middleCols(
+                offset * shape.rows, extent * shape.rows);
+        } else if constexpr (valueCols == 1) {
+            return gradient.middleCols(offset, extent);
+        } else if constexpr (isSparse_v<Gradient>) {
+            auto rows = std::vector<std::ptrdiff_t>();
+            rows.reserve(static_cast<std::size_t>(extent));
+            for (std::ptrdiff_t i = 0; i != extent; ++i) {
+                rows.push_back(offset + i);
+            }
+            return gatherColumns(
+                gradient, rowCoefficients(rows, shape.rows, shape.cols));
+        } else {
+            // a view of the gradient rows as (rows x cols) matrices, whose
+            // blocks of the operand are contiguous after stacking the rows
+            auto const gradRows = gradient.rows();
+            return gradient.reshaped(gradRows * shape.rows, shape.cols)
+                .middleRows(gradRows * offset, gradRows * extent)
+                .reshaped(gradRows, extent * shape.cols);
+        }
+    }
+
+    internal::CachedValue<Value> mValue;
+};
+
+} // namespace AutoDiff::EigenAD
+
+namespace AutoDiff {
+
+/**
+ * @brief Vertical concatenation of matrices with equal numbers of columns,
+ * e.g. the stacking of column vectors.
+ *
+ * @code{.cpp}
+ * auto features = vcat(encoder1(x), encoder2(x), bias);
+ * @endcode
+ */
+template <typename... Xs>
+auto vcat(Expression<Xs> const&... xs)
+    -> std::enable_if_t<(EigenAD::hasMatrixBaseValue_v<Xs> && ...),
+        EigenAD::Concatenation<true, Xs...>>
+{
+    return EigenAD::Concatenation<true, Xs...>(xs...);
+}
+
+/**
+ * @brief Horizontal concatenation of matrices with equal numbers of rows,
+ * e.g. the stacking of column vectors as columns of a matrix.
+ */
+template <typename... Xs>
+auto hcat(Expression<Xs> const&... xs)
+    -> std::enable_if_t<(EigenAD::hasMatrixBaseValue_v<Xs> && ...),
+        EigenAD::Concatenation<false, Xs...>>
+{
+    return EigenAD::Concatenation<false, Xs...>(xs...);
+}
+
+} // namespace AutoDiff
+
+#endif // AUTODIFF_SRC_EIGEN_INDEXING_OPS_CONCATENATION_HPP
@@ -0,0 +1,98 @@
+// Copyright (c) 2024 Matthias Krippner
+//
+// This software is released under the MIT License.
+// https://opensource.org/licenses/MIT
+
+#ifndef AUTODIFF_SRC_EIGEN_INDEXING_OPS_GATHER_HPP
+#define AUTODIFF_SRC_EIGEN_INDEXING_OPS_GATHER_HPP
+
+namespace AutoDiff::EigenAD {
+
+/**
+ * @brief The rows of a matrix (table) at the given indices, e.g.,
+ * an embedding lookup.
+ *
+ * Indices may repeat. The pushforward gathers the tangent rows of the
+ * selected coefficients; the pullback sums the gradient columns into the
+ * columns of these coefficients.
+ * With sparse derivatives, the gradient only has nonzeros in the columns of
+ * the gathered rows, regardless of the size of the table.
+ */
+template <typename X>
+class Gather : public UnaryOperation<Gather<X>, X> {
+public:
+    using Base  = UnaryOperation<Gather<X>, X>;
+    using Value = detail::DenseMatrix<typename ValueType_t<X>::Scalar>;
+    using typename Base::Derivative;
+
+    Gather(Expression<X> const& x, std::vector<std::ptrdiff_t> indices)
+        : Base(x), mIndices{std::move(indices)}
+    {
+    }
+
+    void _releaseCacheImpl()
+    {
+        Base::_releaseCacheImpl();
+        mValue.release();
+    }
+
+    [[nodiscard]] auto _valueImpl() -> Value const&
+    {
+        return mValue([&]() {
+            auto&& xValue   = Base::xValue();
+            auto const rows = static_cast<std::ptrdiff_t>(mIndices.size());
+            auto result     = Value(rows, xValue.cols());
+            for (std::ptrdiff_t i = 0; i != rows; ++i) {
+                auto const index = mIndices[static_cast<std::size_t>(i)];
+                assert(index >= 0 && index < xValue.rows() && "INVALID INDEX");
+                result.row(i) = xValue.row(index);
+            }
+            return result;
+        });
+    }
+
+    [[nodiscard]] auto _pushForwardImpl()
+    {
+        return gatherRows(Base::xPushForward(), coefficients());
+    }
+
+    template <typename OtherDerivative>
+    void _pullBackImpl(OtherDerivative const& derivative)
+    {
+        auto const size = Base::xValue().size();
+        Base::xPullBack(
+            scatterColumns<Derivative>(derivative, coefficients(), size));
+    }
+
+private:
+    // the flat indices of the gathered coefficients in the table
+    [[nodiscard]] auto coefficients() -> std::vector<std::ptrdiff_t>
+    {
+        auto&& xValue = Base::xValue();
+        return rowCoefficients(mIndices, xValue.rows(), xValue.cols());
+    }
+
+    std::vector<std::ptrdiff_t> mIndices;
+    internal::CachedValue<Value> mValue;
+};
+
+} // namespace AutoDiff::EigenAD
+
+namespace AutoDiff {
+
+/**
+ * @brief The rows of a matrix at the given (possibly repeated) indices.
+ *
+ * Row @c i of the result is row @p indices[i] of @p table.
+ * Use sparse derivatives to keep the gradient of large tables sparse.
+ */
+template <typename X>
+auto gather(Expression<X> const& table, std::vector<std::ptrdiff_t> indices)
+    -> std::enable_if_t<EigenAD::hasMatrixBaseValue_v<X>, EigenAD::Gather<X>>
+{
+    return EigenAD::Gather<X>(table, std::move(indices));
+}
+
+} // namespace AutoDiff
+
+#endif // AUTODIFF_SRC_EIGEN_INDEXING_OPS_GATHER_HPP
@@ -0,0 +1,76 @@
+// Copyright (c) 2024 Matthias Krippner
+//
+// This software is released under the MIT License.
+// https://opensource.org/licenses/MIT
+
+#ifndef AUTODIFF_SRC_EIGEN_INDEXING_OPS_RESHAPED_HPP
+#define AUTODIFF_SRC_EIGEN_INDEXING_OPS_RESHAPED_HPP
+
+namespace AutoDiff::EigenAD {
+
+/**
+ * @brief Matrix of another shape with the same coefficients in column-major
+ * order, a view like Eigen's @c reshaped.
+ *
+ * The value is not copied (unless the operand is a temporary matrix).
+ * Since derivatives flatten matrices in column-major order, too,
+ * the tangent and gradient pass through unchanged.
+ */
+template <typename X>
+class Reshaped : public UnaryOperation<Reshaped<X>, X> {
+public:
+    using Base = UnaryOperation<Reshaped<X>, X>;
+
+    Reshaped(Expression<X> const& x, std::ptrdiff_t rows, std::ptrdiff_t cols)
+        : Base(x), mRows{rows}, mCols{cols}
+    {
+        assert(rows >= 0 && cols >= 0 && "NEGATIVE SIZE");
+    }
+
+    [[nodiscard]] auto _valueImpl() -> decltype(auto)
+    {
+        using XValue  = decltype(Base::xValue());
+        auto&& xValue = Base::xValue();
+        assert(xValue.size() == mRows * mCols && "SIZE MISMATCH");
+        auto view = xValue.reshaped(mRows, mCols);
+        if constexpr (isTemporary_v<XValue>) {
+            return view.eval(); // a view of the temporary would dangle
+        } else {
+            return view;
+        }
+    }
+
+    [[nodiscard]] auto _pushForwardImpl() -> decltype(auto)
+    {
+        return Base::xPushForward();
+    }
+
+    template <typename Derivative>
+    void _pullBackImpl(Derivative const& derivative)
+    {
+        Base::xPullBack(derivative);
+    }
+
+private:
+    std::ptrdiff_t mRows;
+    std::ptrdiff_t mCols;
+};
+
+} // namespace AutoDiff::EigenAD
+
+namespace AutoDiff {
+
+/**
+ * @brief The matrix of @p rows x @p cols coefficients read from a matrix
+ * of the same size in column-major order.
+ */
+template <typename X>
+auto reshaped(Expression<X> const& x, std::ptrdiff_t rows, std::ptrdiff_t cols)
+    -> std::enable_if_t<EigenAD::hasMatrixBaseValue_v<X>, EigenAD::Reshaped<X>>
+{
+    return EigenAD::Reshaped<X>(x, rows, cols);
+}
+
+} // namespace AutoDiff
+
+#endif // AUTODIFF_SRC_EIGEN_INDEXING_OPS_RESHAPED_HPP
@@ -0,0 +1,99 @@
+// Copyright (c) 2024 Matthias Krippner
+//
+// This software is released under the MIT License.
+// https://opensource.org/licenses/MIT
+
+#ifndef AUTODIFF_SRC_EIGEN_INDEXING_OPS_SCATTER_ADD_HPP
+#define AUTODIFF_SRC_EIGEN_INDEXING_OPS_SCATTER_ADD_HPP
+
+namespace AutoDiff::EigenAD {
+
+/**
+ * @brief Sums the rows of a matrix into the rows at the given indices of
+ * a zero matrix, the adjoint of @c Gather.
+ *
+ * The pushforward sums the tangent rows into the rows of the target
+ * coefficients; the pullback gathers the gradient columns of these
+ * coefficients.
+ */
+template <typename X>
+class ScatterAdd : public UnaryOperation<ScatterAdd<X>, X> {
+public:
+    using Base  = UnaryOperation<ScatterAdd<X>, X>;
+    using Value = detail::DenseMatrix<typename ValueType_t<X>::Scalar>;
+
+    ScatterAdd(Expression<X> const& x, std::vector<std::ptrdiff_t> indices,
+        std::ptrdiff_t rows)
+        : Base(x), mIndices{std::move(indices)}, mRows{rows}
+    {
+        assert(rows >= 0 && "NEGATIVE SIZE");
+    }
+
+    void _releaseCacheImpl()
+    {
+        Base::_releaseCacheImpl();
+        mValue.release();
+    }
+
+    [[nodiscard]] auto _valueImpl() -> Value const&
+    {
+        return mValue([&]() {
+            auto&& xValue = Base::xValue();
+            assert(xValue.rows()
+                    == static_cast<std::ptrdiff_t>(mIndices.size())
+                && "SIZE MISMATCH");
+            Value result = Value::Zero(mRows, xValue.cols());
+            for (std::ptrdiff_t i = 0; i != xValue.rows(); ++i) {
+                auto const index = mIndices[static_cast<std::size_t>(i)];
+                assert(index >= 0 && index < mRows && "INVALID INDEX");
+                result.row(index) += xValue.row(i);
+            }
+            return result;
+        });
+    }
+
+    [[nodiscard]] auto _pushForwardImpl()
+    {
+        auto const size = mRows * Base::xValue().cols();
+        return scatterRows(Base::xPushForward(), coefficients(), size);
+    }
+
+    template <typename Derivative>
+    void _pullBackImpl(Derivative const& derivative)
+    {
+        Base::xPullBack(gatherColumns(derivative, coefficients()));
+    }
+
+private:
+    // the flat indices of the target coefficients of the operand's
+    // coefficients in the result
+    [[nodiscard]] auto coefficients() -> std::vector<std::ptrdiff_t>
+    {
+        return rowCoefficients(mIndices, mRows, Base::xValue().cols());
+    }
+
+    std::vector<std::ptrdiff_t> mIndices;
+    std::ptrdiff_t mRows;
+    internal::CachedValue<Value> mValue;
+};
+
+} // namespace AutoDiff::EigenAD
+
+namespace AutoDiff {
+
+/**
+ * @brief Sums the rows of a matrix into a zero matrix with @p rows rows:
+ * row @c i is added to row @p indices[i] of the result.
+ */
+template <typename X>
+auto scatterAdd(Expression<X> const& x, std::vector<std::ptrdiff_t> indices,
+    std::ptrdiff_t rows)
+    -> std::enable_if_t<EigenAD::hasMatrixBaseValue_v<X>,
+        EigenAD::ScatterAdd<X>>
+{
+    return EigenAD::ScatterAdd<X>(x, std::move(indices), rows);
+}
+
+} // namespace AutoDiff
+
+#endif // AUTODIFF_SRC_EIGEN_INDEXING_OPS_SCATTER_ADD_HPP
@@ -0,0 +1,94 @@
+// Copyright (c) 2024 Matthias Krippner
+//
+// This software is released under the MIT License.
+// https://opensource.org/licenses/MIT
+
+#ifndef AUTODIFF_SRC_EIGEN_INDEXING_OPS_TRANSPOSE_HPP
+#define AUTODIFF_SRC_EIGEN_INDEXING_OPS_TRANSPOSE_HPP
+
+namespace AutoDiff::EigenAD {
+
+/**
+ * @brief Transpose of a matrix, a view of its coefficients.
+ *
+ * The value is an Eigen transpose of the operand's value, which is not copied
+ * (unless the operand is a temporary matrix).
+ * The derivatives permute the tangent rows and the gradient columns
+ * (by transposing each reshaped column or row), without forming the
+ * commutation matrix.
+ */
+template <typename X>
+class Transpose : public UnaryOperation<Transpose<X>, X> {
+public:
+    using Base = UnaryOperation<Transpose<X>, X>;
+    using Base::Base;
+    using typename Base::Derivative;
+    using DenseDerivative = Dense_t<Derivative>;
+
+    [[nodiscard]] auto _valueImpl() -> decltype(auto)
+    {
+        using XValue = decltype(Base::xValue());
+        if constexpr (isTemporary_v<XValue>) {
+            // a view of the temporary would dangle
+            return Base::xValue().transpose().eval();
+        } else {
+            return Base::xValue().transpose();
+        }
+    }
+
+    [[nodiscard]] auto _pushForwardImpl()
+    {
+        auto&& xValue   = Base::xValue();
+        auto const rows = xValue.rows();
+        auto const cols = xValue.cols();
+        return mapColumns(
+            [&](auto const& tangent) {
+                auto deriv = DenseDerivative(tangent.rows(), tangent.cols());
+                for (std::ptrdiff_t k = 0; k != tangent.cols(); ++k) {
+                    deriv.col(k).reshaped(cols, rows)
+                        = tangent.col(k).reshaped(rows, cols).transpose();
+                }
+                return deriv;
+            },
+            Base::xPushForward());
+    }
+
+    template <typename OtherDerivative>
+    void _pullBackImpl(OtherDerivative const& derivative)
+    {
+        auto&& xValue   = Base::xValue();
+        auto const rows = xValue.rows();
+        auto const cols = xValue.cols();
+        Base::xPullBack(mapRows(
+            [&](auto const& gradient) {
+                // column i + rows * j of the result is the gradient column
+                // j + cols * i of the transpose
+                auto deriv = DenseDerivative(gradient.rows(), gradient.cols());
+                for (std::ptrdiff_t i = 0; i != rows; ++i) {
+                    for (std::ptrdiff_t j = 0; j != cols; ++j) {
+                        deriv.col(i + rows * j) = gradient.col(j + cols * i);
+                    }
+                }
+                return deriv;
+            },
+            derivative));
+    }
+};
+
+} // namespace AutoDiff::EigenAD
+
+namespace AutoDiff {
+
+/**
+ * @brief The transpose of a matrix, a view like Eigen's @c transpose.
+ */
+template <typename X>
+auto transpose(Expression<X> const& x) -> std::enable_if_t<
+    EigenAD::hasMatrixBaseValue_v<X>, EigenAD::Transpose<X>>
+{
+    return EigenAD::Transpose<X>(x);
+}
+
+} // namespace AutoDiff
+
+#endif // AUTODIFF_SRC_EIGEN_INDEXING_OPS_TRANSPOSE_HPP
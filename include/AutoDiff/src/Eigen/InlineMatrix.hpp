@@ -0,0 +1,249 @@
+// Copyright (c) 2024 Matthias Krippner
+//
+// This software is released under the MIT License.
+// https://opensource.org/licenses/MIT
+
+/**
+ * @file InlineMatrix.hpp
+ * @brief Defines a dynamic derivative type with inline storage for small sizes.
+ */
+
+#ifndef AUTODIFF_SRC_EIGEN_INLINE_MATRIX_HPP
+#define AUTODIFF_SRC_EIGEN_INLINE_MATRIX_HPP
+
+#include <algorithm> // copy_n
+#include <array>
+#include <cstddef> // ptrdiff_t
+#include <memory>  // unique_ptr
+#include <new>     // placement new
+#include <utility> // move
+
+// forward-declare Eigen types
+
+namespace Eigen {
+
+template <typename Derived>
+struct EigenBase;
+
+template <typename Scalar_, int Rows_, int Cols_, int Options_, int MaxRows_,
+    int MaxCols_>
+class Matrix;
+
+template <typename PlainObjectType, int MapOptions, typename StrideType>
+class Map;
+
+template <int OuterStrideAtCompileTime, int InnerStrideAtCompileTime>
+class Stride;
+
+} // namespace Eigen
+
+namespace AutoDiff::EigenAD {
+
+namespace detail {
+
+    template <typename Scalar>
+    using DynamicMap = Eigen::Map<Eigen::Matrix<Scalar, -1, -1, 0, -1, -1>, 0,
+        Eigen::Stride<0, 0>>;
+
+} // namespace detail
+
+/**
+ * @class InlineMatrix
+ * @brief A dynamic matrix that stores few coefficients without allocation.
+ *
+ * Matrices with at most @p InlineSize coefficients are stored in a buffer
+ * inside the object; larger matrices fall back to the heap.
+ * As a derivative type, this avoids allocating the tiny derivatives of
+ * scalar-heavy graphs (e.g., the 1x1 gradients of loss terms), while
+ * Jacobians of any size remain possible.
+ * Once allocated, heap storage is reused for matrices of the same or smaller
+ * size, so repeated sweeps over a graph do not reallocate.
+ * Assignments that change the dimensions evaluate into new storage, since the
+ * assigned expression may read the current coefficients.
+ *
+ * The matrix is an Eigen map of its storage and can be used in all Eigen
+ * expressions; only assignments resize it.
+ *
+ * @code{.cpp}
+ * using Derivative = EigenAD::InlineMatrix<double>;
+ * auto x = Variable<double, Derivative>(0.5);
+ * auto y = var(x * sin(x));
+ * Function(from(x), to(y)).pullGradientAt(y); // no heap allocation
+ * @endcode
+ *
+ * @tparam Scalar_      the type of the coefficients
+ * @tparam InlineSize   the number of coefficients stored inline
+ */
+template <typename Scalar_, int InlineSize = 16>
+class InlineMatrix : public detail::DynamicMap<Scalar_> {
+    static_assert(InlineSize > 0, "INLINE SIZE MUST BE POSITIVE");
+
+public:
+    using Scalar = Scalar_;
+    using Index  = std::ptrdiff_t;
+    using Base   = detail::DynamicMap<Scalar>;
+
+    /**
+     * @brief Create an empty matrix.
+     */
+    InlineMatrix()
+        : Base{nullptr, 0, 0}
+    {
+        rebind(0, 0);
+    }
+
+    /**
+     * @brief Create an uninitialized matrix with the given dimensions.
+     */
+    InlineMatrix(Index rows, Index cols)
+        : Base{nullptr, 0, 0}
+    {
+        resize(rows, cols);
+    }
+
+    /**
+     * @brief Create a matrix from an Eigen expression.
+     */
+    template <typename Derived>
+    InlineMatrix(Eigen::EigenBase<Derived> const& other) // NOLINT(*-explicit-*)
+        : Base{nullptr, 0, 0}
+    {
+        *this = other.derived();
+    }
+
+    ~InlineMatrix() = default;
+
+    InlineMatrix(InlineMatrix const& other)
+        : Base{nullptr, 0, 0}
+    {
+        *this = other;
+    }
+
+    InlineMatrix(InlineMatrix&& other) noexcept
+        : Base{nullptr, 0, 0}
+    {
+        *this = std::move(other);
+    }
+
+    auto operator=(InlineMatrix const& other) -> InlineMatrix&
+    {
+        if (this != &other) {
+            resize(other.rows(), other.cols());
+            std::copy_n(other.storage(), other.size(), storage());
+        }
+        return *this;
+    }
+
+    auto operator=(InlineMatrix&& other) noexcept -> InlineMatrix&
+    {
+        if (this == &other) {
+            return *this;
+        }
+        if (other.mHeap) {
+            // take over the heap storage
+            mHeap     = std::move(other.mHeap);
+            mCapacity = other.mCapacity;
+            rebind(other.rows(), other.cols());
+        } else {
+            rebind(other.rows(), other.cols());
+            std::copy_n(other.storage(), other.size(), storage());
+        }
+        other.mCapacity = InlineSize;
+        other.rebind(0, 0);
+        return *this;
+    }
+
+    /**
+     * @brief Assign an Eigen expression, resizing the matrix if necessary.
+     *
+     * The expression may read from this matrix (e.g., `m = m.replicate(2, 1)`):
+     * if the dimensions change, it is evaluated into new storage, which only
+     * then replaces the current one.
+     */
+    template <typename Derived>
+    auto operator=(Eigen::EigenBase<Derived> const& other) -> InlineMatrix&
+    {
+        if (other.rows() == Base::rows() && other.cols() == Base::cols()) {
+            static_cast<Base&>(*this) = other.derived();
+        } else {
+            auto result = InlineMatrix(other.rows(), other.cols());
+            result.Base::operator=(other.derived());
+            *this = std::move(result);
+        }
+        return *this;
+    }
+
+    /**
+     * @brief Whether the coefficients are stored inside the object.
+     */
+    [[nodiscard]] auto isInline() const -> bool { return !mHeap; }
+
+    /**
+     * @brief The number of coefficients that fit without reallocation.
+     */
+    [[nodiscard]] auto capacity() const -> Index { return mCapacity; }
+
+    /**
+     * @brief Resize the matrix; the coefficients are unspecified afterwards.
+     */
+    void resize(Index rows, Index cols)
+    {
+        auto const size = rows * cols;
+        if (size > mCapacity) {
+            mHeap     = std::make_unique<Scalar[]>(size);
+            mCapacity = size;
+        }
+        rebind(rows, cols);
+    }
+
+    using Base::setIdentity;
+    using Base::setOnes;
+    using Base::setZero;
+
+    auto setZero(Index rows, Index cols) -> InlineMatrix&
+    {
+        resize(rows, cols);
+        Base::setZero();
+        return *this;
+    }
+
+    auto setOnes(Index rows, Index cols) -> InlineMatrix&
+    {
+        resize(rows, cols);
+        Base::setOnes();
+        return *this;
+    }
+
+    auto setIdentity(Index rows, Index cols) -> InlineMatrix&
+    {
+        resize(rows, cols);
+        Base::setIdentity();
+        return *this;
+    }
+
+private:
+    [[nodiscard]] auto storage() -> Scalar*
+    {
+        return mHeap ? mHeap.get() : mInline.data();
+    }
+
+    [[nodiscard]] auto storage() const -> Scalar const*
+    {
+        return mHeap ? mHeap.get() : mInline.data();
+    }
+
+    // let the map view the current storage (Eigen's way of changing the
+    // viewed array of a map)
+    void rebind(Index rows, Index cols)
+    {
+        new (static_cast<Base*>(this)) Base(storage(), rows, cols);
+    }
+
+    std::array<Scalar, InlineSize> mInline;
+    std::unique_ptr<Scalar[]> mHeap;
+    Index mCapacity{InlineSize};
+};
+
+} // namespace AutoDiff::EigenAD
+
+#endif // AUTODIFF_SRC_EIGEN_INLINE_MATRIX_HPP
@@ -0,0 +1,27 @@
+// Copyright (c) 2024 Matthias Krippner
+//
+// This software is released under the MIT License.
+// https://opensource.org/licenses/MIT
+
+#ifndef AUTODIFF_SRC_EIGEN_LINEAR_ALGEBRA_COMMON_HPP
+#define AUTODIFF_SRC_EIGEN_LINEAR_ALGEBRA_COMMON_HPP
+
+// included here instead of for each operation
+
+#include "../Products/factories.hpp"   // binary matrix operations
+#include "../Reductions/factories.hpp" // unary matrix operations
+
+#include "../../Core/BinaryOperation.hpp"
+#include "../../Core/Cached.hpp" // CachedValue
+#include "../../Core/MultiOutputOperation.hpp"
+#include "../../Core/UnaryOperation.hpp"
+#include "../derivatives.hpp" // Dense_t mapColumns mapRows promote
+#include "decompositions.hpp"
+
+#include <cassert>
+#include <cstddef>     // ptrdiff_t
+#include <tuple>       // make_tuple
+#include <type_traits> // decay enable_if
+#include <utility>     // declval
+
+#endif // AUTODIFF_SRC_EIGEN_LINEAR_ALGEBRA_COMMON_HPP
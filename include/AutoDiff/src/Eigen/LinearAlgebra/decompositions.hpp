@@ -0,0 +1,246 @@
+// Copyright (c) 2024 Matthias Krippner
+//
+// This software is released under the MIT License.
+// https://opensource.org/licenses/MIT
+
+/**
+ * @file decompositions.hpp
+ * @brief Matrix decompositions shared by the linear algebra operations.
+ *
+ * The decompositions are Eigen's, which requires including the corresponding
+ * Eigen module (e.g., @c <Eigen/LU>) before using an operation.
+ */
+
+#ifndef AUTODIFF_SRC_EIGEN_LINEAR_ALGEBRA_DECOMPOSITIONS_HPP
+#define AUTODIFF_SRC_EIGEN_LINEAR_ALGEBRA_DECOMPOSITIONS_HPP
+
+#include <cstddef>     // ptrdiff_t
+#include <type_traits> // decay is_same
+#include <utility>     // forward
+
+// forward-declare Eigen types
+
+namespace Eigen {
+
+template <typename Scalar_, int Rows_, int Cols_, int Options_, int MaxRows_,
+    int MaxCols_>
+class Matrix;
+
+template <typename MatrixType>
+class PartialPivLU;
+
+template <typename MatrixType, int UpLo>
+class LLT;
+
+template <typename MatrixType>
+class SelfAdjointEigenSolver;
+
+template <typename MatrixType>
+class HouseholderQR;
+
+} // namespace Eigen
+
+namespace AutoDiff::EigenAD {
+
+namespace detail {
+
+    // Eigen enums, which cannot be forward-declared
+    constexpr int lower         = 1; // Eigen::Lower
+    constexpr int upper         = 2; // Eigen::Upper
+    constexpr int strictlyLower = 9; // Eigen::StrictlyLower
+    constexpr int onTheRight    = 2; // Eigen::OnTheRight
+
+} // namespace detail
+
+/**
+ * @brief Dynamic-size matrix type of decompositions and their results.
+ */
+template <typename Scalar>
+using DynamicMatrix = Eigen::Matrix<Scalar, -1, -1, 0, -1, -1>;
+
+/**
+ * @brief Dynamic-size column vector type of decomposition results.
+ */
+template <typename Scalar>
+using DynamicVector = Eigen::Matrix<Scalar, -1, 1, 0, -1, 1>;
+
+/**
+ * @brief A decomposition that is computed at most once per evaluation.
+ *
+ * Operations compute the decomposition of their operand when it is first
+ * needed (usually for the value) and reuse it in the pushforward and
+ * pullback, where each derivative costs only triangular solves.
+ * The decomposition is outdated when the cache of the operation is released.
+ * Its storage is kept, so that repeated evaluations of matrices of the same
+ * size do not allocate.
+ *
+ * @tparam Decomposition   the Eigen decomposition (e.g., PartialPivLU)
+ */
+template <typename Decomposition>
+class CachedDecomposition {
+public:
+    /**
+     * @brief The decomposition, computed from the matrix if outdated.
+     *
+     * @param  matrix  a function returning the matrix to decompose
+     */
+    template <typename MatrixFn>
+    auto operator()(MatrixFn const& matrix) -> Decomposition const&
+    {
+        if (!mIsComputed) {
+            mDecomposition.compute(matrix());
+            mIsComputed = true;
+        }
+        return mDecomposition;
+    }
+
+    void release() { mIsComputed = false; }
+
+private:
+    Decomposition mDecomposition;
+    bool mIsComputed{false};
+};
+
+/**
+ * @brief The LU decomposition with partial pivoting in derivative precision.
+ */
+template <typename Derivative>
+using LUDecomposition = CachedDecomposition<
+    Eigen::PartialPivLU<DynamicMatrix<typename Derivative::Scalar>>>;
+
+/**
+ * @brief The Cholesky decomposition S = L L^T in derivative precision.
+ *
+ * Only the lower triangle of the symmetric positive definite matrix is read.
+ */
+template <typename Derivative>
+using CholeskyDecomposition = CachedDecomposition<
+    Eigen::LLT<DynamicMatrix<typename Derivative::Scalar>, detail::lower>>;
+
+/**
+ * @brief The eigendecomposition S = V diag(lambda) V^T of a symmetric matrix
+ * in derivative precision.
+ *
+ * Only the lower triangle of the symmetric matrix is read.
+ * The eigenvalues are sorted in increasing order.
+ */
+template <typename Derivative>
+using SymmetricEigenDecomposition = CachedDecomposition<
+    Eigen::SelfAdjointEigenSolver<DynamicMatrix<typename Derivative::Scalar>>>;
+
+/**
+ * @brief The thin QR decomposition A = Q R of a matrix with at least as many
+ * rows as columns.
+ *
+ * Q has orthonormal columns and R is upper triangular with a nonnegative
+ * diagonal, which makes the decomposition of a matrix with full column rank
+ * unique.
+ * Both factors are formed once from Householder reflections.
+ *
+ * @tparam Matrix  the dynamic-size matrix type
+ */
+template <typename Matrix>
+class ThinQRFactorization {
+public:
+    template <typename Other>
+    void compute(Other const& matrix)
+    {
+        mHouseholder.compute(matrix);
+        auto const rows = matrix.rows();
+        auto const cols = matrix.cols();
+        mQ = mHouseholder.householderQ() * Matrix::Identity(rows, cols);
+        mR = mHouseholder.matrixQR()
+                 .topRows(cols)
+                 .template triangularView<detail::upper>();
+        // flip the signs of the rows of R (columns of Q) with negative diagonal
+        for (std::ptrdiff_t i = 0; i != cols; ++i) {
+            if (mR(i, i) < 0) {
+                mR.row(i) *= -1;
+                mQ.col(i) *= -1;
+            }
+        }
+    }
+
+    [[nodiscard]] auto matrixQ() const -> Matrix const& { return mQ; }
+
+    [[nodiscard]] auto matrixR() const -> Matrix const& { return mR; }
+
+private:
+    Eigen::HouseholderQR<Matrix> mHouseholder;
+    Matrix mQ;
+    Matrix mR;
+};
+
+/**
+ * @brief The thin QR decomposition in derivative precision.
+ */
+template <typename Derivative>
+using ThinQRDecomposition = CachedDecomposition<
+    ThinQRFactorization<DynamicMatrix<typename Derivative::Scalar>>>;
+
+/**
+ * @brief Whether a decomposition succeeded, e.g., whether the decomposed
+ * matrix is positive definite for a Cholesky decomposition.
+ */
+template <typename Decomposition>
+auto succeeded(Decomposition const& decomposition) -> bool
+{
+    using Info = decltype(decomposition.info());
+    return decomposition.info() == Info::Success;
+}
+
+/**
+ * @brief The log-determinant of a symmetric positive definite matrix from
+ * its Cholesky decomposition, 2 sum_i log L_ii.
+ */
+template <typename Cholesky>
+auto logDeterminantFromCholesky(Cholesky const& cholesky)
+{
+    using Scalar = typename Cholesky::Scalar;
+    return Scalar(2) * cholesky.matrixLLT().diagonal().array().log().sum();
+}
+
+/**
+ * @brief The inverse of a symmetric positive definite matrix from its
+ * Cholesky decomposition.
+ *
+ * Computed as S^-1 = L^-T L^-1 from a triangular inverse and a symmetric
+ * rank update, which only computes one triangle.
+ */
+template <typename Cholesky>
+auto inverseSPD(Cholesky const& cholesky)
+{
+    using Matrix    = typename Cholesky::MatrixType;
+    auto const size = cholesky.rows();
+    Matrix lowerInverse = Matrix::Identity(size, size);
+    cholesky.matrixL().solveInPlace(lowerInverse);
+    Matrix inverse = Matrix::Zero(size, size);
+    inverse.template selfadjointView<Cholesky::UpLo>().rankUpdate(
+        lowerInverse.transpose());
+    // copy the computed triangle to the other one
+    inverse = inverse.template selfadjointView<Cholesky::UpLo>();
+    return inverse;
+}
+
+/**
+ * @brief Converts a result computed in derivative precision to the scalar
+ * type of the value.
+ *
+ * Decompositions are computed in the precision of the derivative, which
+ * they are also applied to.
+ * Results of the same precision are returned unchanged.
+ */
+template <typename ValueScalar, typename Matrix>
+auto toValueScalar(Matrix&& matrix)
+{
+    if constexpr (std::is_same_v<ValueScalar,
+                      typename std::decay_t<Matrix>::Scalar>) {
+        return std::decay_t<Matrix>(std::forward<Matrix>(matrix));
+    } else {
+        return matrix.template cast<ValueScalar>().eval();
+    }
+}
+
+} // namespace AutoDiff::EigenAD
+
+#endif // AUTODIFF_SRC_EIGEN_LINEAR_ALGEBRA_DECOMPOSITIONS_HPP
@@ -0,0 +1,23 @@
+// Copyright (c) 2024 Matthias Krippner
+//
+// This software is released under the MIT License.
+// https://opensource.org/licenses/MIT
+
+/**
+ * @file ops.hpp
+ * @brief Includes supported linear algebra operations.
+ */
+
+#ifndef AUTODIFF_SRC_EIGEN_LINEAR_ALGEBRA_OPS_HPP
+#define AUTODIFF_SRC_EIGEN_LINEAR_ALGEBRA_OPS_HPP
+
+// avoid includes in operation headers
+#include "common.hpp"
+
+#include "ops/Determinant.hpp"
+#include "ops/Inverse.hpp"
+#include "ops/Solve.hpp"
+#include "ops/SymmetricEigen.hpp"
+#include "ops/ThinQR.hpp"
+
+#endif // AUTODIFF_SRC_EIGEN_LINEAR_ALGEBRA_OPS_HPP
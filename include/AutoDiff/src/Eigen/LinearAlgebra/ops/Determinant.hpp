@@ -0,0 +1,127 @@
+// Copyright (c) 2024 Matthias Krippner
+//
+// This software is released under the MIT License.
+// https://opensource.org/licenses/MIT
+
+#ifndef AUTODIFF_SRC_EIGEN_LINEAR_ALGEBRA_OPS_DETERMINANT_HPP
+#define AUTODIFF_SRC_EIGEN_LINEAR_ALGEBRA_OPS_DETERMINANT_HPP
+
+namespace AutoDiff::EigenAD {
+
+/**
+ * @brief Determinant or log-absolute-determinant of an invertible matrix.
+ *
+ * Both are computed from the diagonal of the LU decomposition, which is
+ * computed once per evaluation. The log-determinant is the sum of the logs
+ * of the diagonal, which neither overflows nor underflows for large matrices.
+ * The derivatives are given by Jacobi's formula,
+ *   d det(A) = det(A) tr(A^-1 dA),   d log|det(A)| = tr(A^-1 dA).
+ */
+template <typename X, bool IsLog>
+class Determinant : public UnaryOperation<Determinant<X, IsLog>, X> {
+public:
+    using Base  = UnaryOperation<Determinant<X, IsLog>, X>;
+    using Value = typename ValueType_t<X>::Scalar;
+    using Base::Base;
+    using typename Base::Derivative;
+    using DenseDerivative = Dense_t<Derivative>;
+
+    // Expression implementation ===============================================
+
+    void _releaseCacheImpl()
+    {
+        Base::_releaseCacheImpl();
+        mDecomposition.release();
+        mValue.release();
+    }
+
+    [[nodiscard]] auto _valueImpl() -> Value const&
+    {
+        return mValue([&]() { return static_cast<Value>(determinant()); });
+    }
+
+    [[nodiscard]] auto _pushForwardImpl()
+    {
+        auto const xDeriv = this->xDeriv();
+        return mapColumns(
+            [&](auto const& tangent) {
+                return DenseDerivative(xDeriv * tangent);
+            },
+            Base::xPushForward());
+    }
+
+    template <typename OtherDerivative>
+    void _pullBackImpl(OtherDerivative const& derivative)
+    {
+        auto const xDeriv = this->xDeriv();
+        Base::xPullBack(derivative * xDeriv);
+    }
+
+private:
+    [[nodiscard]] auto decomposition() -> decltype(auto)
+    {
+        return mDecomposition(
+            [&]() -> decltype(auto) {
+                return promote<Derivative>(Base::xValue());
+            });
+    }
+
+    // in derivative precision
+    [[nodiscard]] auto determinant()
+    {
+        auto const& lu = decomposition();
+        if constexpr (IsLog) {
+            return lu.matrixLU().diagonal().array().abs().log().sum();
+        } else {
+            return lu.determinant();
+        }
+    }
+
+    // the gradient, vec(A^-T)^T scaled by the determinant
+    [[nodiscard]] auto xDeriv()
+    {
+        auto const& lu = decomposition();
+        DenseDerivative inverse = lu.inverse().transpose();
+        if constexpr (!IsLog) {
+            inverse *= lu.determinant();
+        }
+        return inverse.reshaped().transpose().eval();
+    }
+
+    LUDecomposition<Derivative> mDecomposition;
+    internal::CachedValue<Value> mValue;
+};
+
+} // namespace AutoDiff::EigenAD
+
+namespace AutoDiff {
+
+/**
+ * @brief Determinant of an invertible matrix.
+ *
+ * Requires including @c <Eigen/LU>.
+ */
+template <typename X>
+auto determinant(Expression<X> const& x)
+    -> std::enable_if_t<EigenAD::hasMatrixBaseValue_v<X>,
+        EigenAD::Determinant<X, false>>
+{
+    return EigenAD::Determinant<X, false>(x);
+}
+
+/**
+ * @brief Logarithm of the absolute determinant of an invertible matrix.
+ *
+ * Requires including @c <Eigen/LU>.
+ */
+template <typename X>
+auto logDeterminant(Expression<X> const& x)
+    -> std::enable_if_t<EigenAD::hasMatrixBaseValue_v<X>,
+        EigenAD::Determinant<X, true>>
+{
+    return EigenAD::Determinant<X, true>(x);
+}
+
+} // namespace AutoDiff
+
+#endif // AUTODIFF_SRC_EIGEN_LINEAR_ALGEBRA_OPS_DETERMINANT_HPP
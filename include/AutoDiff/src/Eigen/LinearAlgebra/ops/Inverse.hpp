@@ -0,0 +1,113 @@
+// Copyright (c) 2024 Matthias Krippner
+//
+// This software is released under the MIT License.
+// https://opensource.org/licenses/MIT
+
+#ifndef AUTODIFF_SRC_EIGEN_LINEAR_ALGEBRA_OPS_INVERSE_HPP
+#define AUTODIFF_SRC_EIGEN_LINEAR_ALGEBRA_OPS_INVERSE_HPP
+
+namespace AutoDiff::EigenAD {
+
+/**
+ * @brief Inverse Y = A^-1 of an invertible matrix.
+ *
+ * The inverse is computed from the LU decomposition of A, which is computed
+ * once per evaluation. The derivatives are
+ *   dY = -Y dA Y,   A' = -Y^T Y' Y^T.
+ *
+ * Prefer @c solve to multiplying by the inverse.
+ */
+template <typename X>
+class Inverse : public UnaryOperation<Inverse<X>, X> {
+public:
+    using Base        = UnaryOperation<Inverse<X>, X>;
+    using ValueScalar = typename ValueType_t<X>::Scalar;
+    using Value       = DynamicMatrix<ValueScalar>;
+    using Base::Base;
+    using typename Base::Derivative;
+    using DenseDerivative = Dense_t<Derivative>;
+
+    // Expression implementation ===============================================
+
+    void _releaseCacheImpl()
+    {
+        Base::_releaseCacheImpl();
+        mDecomposition.release();
+        mValue.release();
+    }
+
+    [[nodiscard]] auto _valueImpl() -> Value const&
+    {
+        return mValue([&]() { return toValueScalar<ValueScalar>(inverse()); });
+    }
+
+    [[nodiscard]] auto _pushForwardImpl()
+    {
+        auto const inverse = this->inverse();
+        return mapColumns(
+            [&](auto const& tangent) { return sandwich(inverse, tangent); },
+            Base::xPushForward());
+    }
+
+    template <typename OtherDerivative>
+    void _pullBackImpl(OtherDerivative const& derivative)
+    {
+        // the transposed gradient rows are mapped like tangent columns
+        auto const inverse = this->inverse().transpose().eval();
+        Base::xPullBack(mapRows(
+            [&](auto const& gradient) {
+                return DenseDerivative(
+                    sandwich(inverse, gradient.transpose()).transpose());
+            },
+            derivative));
+    }
+
+private:
+    // -M D M for each column D of the derivative, with all products M D
+    // in one GEMM
+    template <typename Matrix, typename Columns>
+    [[nodiscard]] static auto sandwich(
+        Matrix const& matrix, Columns const& columns)
+    {
+        auto const size      = matrix.rows();
+        auto const derivCols = columns.cols();
+        auto product = DenseDerivative(size * size, derivCols);
+        product.reshaped(size, size * derivCols).noalias()
+            = -matrix * columns.reshaped(size, size * derivCols);
+        auto deriv = DenseDerivative(size * size, derivCols);
+        for (std::ptrdiff_t j = 0; j != derivCols; ++j) {
+            deriv.col(j).reshaped(size, size).noalias()
+                = product.col(j).reshaped(size, size) * matrix;
+        }
+        return deriv;
+    }
+
+    // in derivative precision
+    [[nodiscard]] auto inverse()
+    {
+        return mDecomposition(
+            [&]() -> decltype(auto) {
+                return promote<Derivative>(Base::xValue());
+            })
+            .inverse()
+            .eval();
+    }
+
+    LUDecomposition<Derivative> mDecomposition;
+    internal::CachedValue<Value> mValue;
+};
+
+} // namespace AutoDiff::EigenAD
+
+namespace AutoDiff {
+
+/**
+ * @brief Inverse of an invertible matrix.
+ *
+ * Requires including @c <Eigen/LU>.
+ */
+AUTODIFF_MAKE_MATRIXBASE_UNARY_OP(inverse, EigenAD::Inverse)
+
+} // namespace AutoDiff
+
+#endif // AUTODIFF_SRC_EIGEN_LINEAR_ALGEBRA_OPS_INVERSE_HPP
@@ -0,0 +1,168 @@
+// Copyright (c) 2024 Matthias Krippner
+//
+// This software is released under the MIT License.
+// https://opensource.org/licenses/MIT
+
+#ifndef AUTODIFF_SRC_EIGEN_LINEAR_ALGEBRA_OPS_SOLVE_HPP
+#define AUTODIFF_SRC_EIGEN_LINEAR_ALGEBRA_OPS_SOLVE_HPP
+
+namespace AutoDiff::EigenAD {
+
+/**
+ * @brief Solution X of the linear system A X = B with invertible A.
+ *
+ * The LU decomposition of A is computed once per evaluation.
+ * The derivatives reuse it instead of forming the inverse,
+ *   dX = A^-1 (dB - dA X),   B' = A^-T X',   A' = -B' X^T,
+ * where all tangent columns (gradient rows) are solved for at once.
+ */
+template <typename A, typename B>
+class Solve : public BinaryOperation<Solve<A, B>, A, B> {
+public:
+    using Base        = BinaryOperation<Solve<A, B>, A, B>;
+    using ValueScalar = typename ValueType_t<B>::Scalar;
+    using Value       = std::decay_t<decltype(
+        std::declval<DynamicMatrix<ValueScalar>>()
+            .partialPivLu()
+            .solve(std::declval<ValueType_t<B>>())
+            .eval())>;
+    using Base::Base;
+    using typename Base::Derivative;
+    using DenseDerivative = Dense_t<Derivative>;
+
+    // Expression implementation ===============================================
+
+    void _releaseCacheImpl()
+    {
+        Base::_releaseCacheImpl();
+        mDecomposition.release();
+        mValue.release();
+    }
+
+    [[nodiscard]] auto _valueImpl() -> Value const&
+    {
+        return mValue(
+            [&]() { return toValueScalar<ValueScalar>(solution()); });
+    }
+
+    [[nodiscard]] auto _pushForwardImpl()
+    {
+        auto const& lu      = decomposition();
+        auto const solution = this->solution();
+        auto const rows     = solution.rows();
+        auto const cols     = solution.cols();
+
+        // the tangent columns side by side form a single right-hand side
+        auto const solve = [&](auto const& rhs) {
+            auto const derivCols = rhs.cols();
+            auto deriv = DenseDerivative(rows * cols, derivCols);
+            deriv.reshaped(rows, cols * derivCols)
+                = lu.solve(rhs.reshaped(rows, cols * derivCols));
+            return deriv;
+        };
+        // dA X, one GEMM for each tangent column
+        auto const productA = [&](auto const& aDerivative) {
+            auto const derivCols = aDerivative.cols();
+            auto product = DenseDerivative(rows * cols, derivCols);
+            for (std::ptrdiff_t j = 0; j != derivCols; ++j) {
+                product.col(j).reshaped(rows, cols).noalias()
+                    = aDerivative.col(j).reshaped(rows, rows) * solution;
+            }
+            return product;
+        };
+
+        if constexpr (!Base::hasOperandX) {
+            return mapColumns(solve, Base::yPushForward());
+        } else if constexpr (!Base::hasOperandY) {
+            return mapColumns(
+                [&](auto const& aDerivative) {
+                    DenseDerivative rhs = -productA(aDerivative);
+                    return solve(rhs);
+                },
+                Base::xPushForward());
+        } else {
+            return mapColumns(
+                [&](auto const& aDerivative, auto const& bDerivative) {
+                    DenseDerivative rhs = bDerivative;
+                    rhs -= productA(aDerivative);
+                    return solve(rhs);
+                },
+                Base::xPushForward(), Base::yPushForward());
+        }
+    }
+
+    template <typename OtherDerivative>
+    void _pullBackImpl(OtherDerivative const& derivative)
+    {
+        auto const& lu  = decomposition();
+        auto const rows = lu.rows();
+        auto const cols = derivative.cols() / rows;
+
+        // the transposed gradient rows side by side form a single
+        // right-hand side
+        auto const gradientB = mapRows(
+            [&](auto const& gradient) {
+                auto const derivRows = gradient.rows();
+                auto solved = DenseDerivative(rows * cols, derivRows);
+                solved.reshaped(rows, cols * derivRows)
+                    = lu.transpose().solve(
+                        gradient.transpose().reshaped(rows, cols * derivRows));
+                return DenseDerivative(solved.transpose());
+            },
+            derivative);
+
+        if constexpr (Base::hasOperandX) {
+            // the gradient rows stacked on top of each other, one GEMM
+            auto const solution = this->solution();
+            Base::xPullBack(mapRows(
+                [&](auto const& gradient) {
+                    auto const derivRows = gradient.rows();
+                    auto deriv = DenseDerivative(derivRows, rows * rows);
+                    deriv.reshaped(derivRows * rows, rows).noalias()
+                        = -gradient.reshaped(derivRows * rows, cols)
+                        * solution.transpose();
+                    return deriv;
+                },
+                gradientB));
+        }
+        if constexpr (Base::hasOperandY) {
+            Base::yPullBack(gradientB);
+        }
+    }
+
+private:
+    [[nodiscard]] auto decomposition() -> decltype(auto)
+    {
+        return mDecomposition(
+            [&]() -> decltype(auto) {
+                return promote<Derivative>(Base::xValue());
+            });
+    }
+
+    // in derivative precision
+    [[nodiscard]] auto solution()
+    {
+        return decomposition()
+            .solve(promote<Derivative>(Base::yValue()))
+            .eval();
+    }
+
+    LUDecomposition<Derivative> mDecomposition;
+    internal::CachedValue<Value> mValue;
+};
+
+} // namespace AutoDiff::EigenAD
+
+namespace AutoDiff {
+
+/**
+ * @brief Solution x of the linear system A x = b with invertible A.
+ *
+ * The right-hand side may have several columns.
+ * Requires including @c <Eigen/LU>.
+ */
+AUTODIFF_MAKE_MATRIXBASE_BINARY_OP(solve, EigenAD::Solve)
+
+} // namespace AutoDiff
+
+#endif // AUTODIFF_SRC_EIGEN_LINEAR_ALGEBRA_OPS_SOLVE_HPP
@@ -0,0 +1,169 @@
+// Copyright (c) 2024 Matthias Krippner
+//
+// This software is released under the MIT License.
+// https://opensource.org/licenses/MIT
+
+#ifndef AUTODIFF_SRC_EIGEN_LINEAR_ALGEBRA_OPS_SYMMETRIC_EIGEN_HPP
+#define AUTODIFF_SRC_EIGEN_LINEAR_ALGEBRA_OPS_SYMMETRIC_EIGEN_HPP
+
+namespace AutoDiff::EigenAD {
+
+/**
+ * @brief Eigenvalues lambda and eigenvectors V of a symmetric matrix
+ * S = V diag(lambda) V^T.
+ *
+ * Both outputs are computed by one decomposition per evaluation.
+ * With M = V^T dS V and F_ij = 1 / (lambda_j - lambda_i) for i != j
+ * (F_ii = 0), the derivatives are
+ *   d lambda = diag(M),   dV = V (F o M),
+ *   S' = V sym(diag(lambda') + F o (V^T V')) V^T,
+ * where o is the elementwise product and sym(G) = (G + G^T) / 2.
+ * The joint pullback sandwiches the combined gradient of both outputs once.
+ */
+template <typename X, typename Scalar = typename ValueType_t<X>::Scalar>
+class SymmetricEigen
+    : public MultiOutputOperation<X, DynamicVector<Scalar>,
+          DynamicMatrix<Scalar>> {
+public:
+    using Base = MultiOutputOperation<X, DynamicVector<Scalar>,
+        DynamicMatrix<Scalar>>;
+    using Base::Base;
+    using typename Base::Derivative;
+    using typename Base::Gradients;
+    using DenseDerivative = Dense_t<Derivative>;
+
+    // MultiOutputOperation implementation =====================================
+
+    void _releaseCacheImpl()
+    {
+        Base::_releaseCacheImpl();
+        mDecomposition.release();
+    }
+
+    [[nodiscard]] auto _valueImpl()
+    {
+        auto const& eigen = decomposition();
+        return std::make_tuple(toValueScalar<Scalar>(eigen.eigenvalues()),
+            toValueScalar<Scalar>(eigen.eigenvectors()));
+    }
+
+    [[nodiscard]] auto _pushForwardImpl()
+    {
+        auto const& vectors = decomposition().eigenvectors();
+        auto const size     = vectors.rows();
+        auto const gaps     = inverseGaps();
+
+        auto const tangent   = DenseDerivative(densify(Base::xPushForward()));
+        auto const derivCols = tangent.cols();
+        // V^T dS for all tangent columns in one GEMM
+        auto product = DenseDerivative(size * size, derivCols);
+        product.reshaped(size, size * derivCols).noalias()
+            = vectors.transpose() * tangent.reshaped(size, size * derivCols);
+
+        auto valuesTangent  = DenseDerivative(size, derivCols);
+        auto vectorsTangent = DenseDerivative(size * size, derivCols);
+        auto inner          = DenseDerivative(size, size);
+        for (std::ptrdiff_t j = 0; j != derivCols; ++j) {
+            inner.noalias() = product.col(j).reshaped(size, size) * vectors;
+            DenseDerivative const symmetric
+                = (inner + inner.transpose()) / 2;
+            valuesTangent.col(j) = symmetric.diagonal();
+            vectorsTangent.col(j).reshaped(size, size).noalias()
+                = vectors * gaps.cwiseProduct(symmetric);
+        }
+        return std::make_tuple(valuesTangent, vectorsTangent);
+    }
+
+    void _pullBackImpl(Gradients const& gradients)
+    {
+        auto const& vectors = decomposition().eigenvectors();
+        auto const size     = vectors.rows();
+
+        bool const hasValues  = gradients[0] != nullptr;
+        bool const hasVectors = gradients[1] != nullptr;
+        auto const valuesGradient  = denseGradient(gradients[0]);
+        auto const vectorsGradient = denseGradient(gradients[1]);
+        auto const derivRows
+            = hasValues ? valuesGradient.rows() : vectorsGradient.rows();
+        // the vectors term is skipped without gradient, which also avoids
+        // multiplying zeros by the inverse gaps of repeated eigenvalues
+        auto const gaps = hasVectors ? inverseGaps() : DenseDerivative();
+
+        auto gradient = DenseDerivative(derivRows, size * size);
+        auto inner    = DenseDerivative(size, size);
+        for (std::ptrdiff_t i = 0; i != derivRows; ++i) {
+            if (hasVectors) {
+                inner.noalias() = vectors.transpose()
+                    * vectorsGradient.row(i).reshaped(size, size);
+                inner = gaps.cwiseProduct(inner);
+            } else {
+                inner.setZero();
+            }
+            if (hasValues) {
+                inner.diagonal() += valuesGradient.row(i).transpose();
+            }
+            DenseDerivative const symmetric
+                = (inner + inner.transpose()) / 2;
+            gradient.row(i)
+                = (vectors * symmetric * vectors.transpose()).reshaped();
+        }
+        Base::xPullBack(gradient);
+    }
+
+private:
+    [[nodiscard]] auto decomposition() -> decltype(auto)
+    {
+        return mDecomposition([&]() -> decltype(auto) {
+            return promote<Derivative>(Base::xValue());
+        });
+    }
+
+    // F_ij = 1 / (lambda_j - lambda_i) for i != j, F_ii = 0
+    [[nodiscard]] auto inverseGaps() -> DenseDerivative
+    {
+        auto const& values = decomposition().eigenvalues();
+        auto const size    = values.size();
+        auto gaps          = DenseDerivative(size, size);
+        for (std::ptrdiff_t j = 0; j != size; ++j) {
+            for (std::ptrdiff_t i = 0; i != size; ++i) {
+                gaps(i, j) = i == j ? 0 : 1 / (values(j) - values(i));
+            }
+        }
+        return gaps;
+    }
+
+    SymmetricEigenDecomposition<Derivative> mDecomposition;
+};
+
+} // namespace AutoDiff::EigenAD
+
+namespace AutoDiff {
+
+/**
+ * @brief Eigenvalues and eigenvectors of a symmetric matrix.
+ *
+ * Returns the eigenvalues (in increasing order) and the eigenvectors
+ * (the columns of an orthogonal matrix) as two variables, which share
+ * one decomposition:
+ *
+ * @code{.cpp}
+ * auto [values, vectors] = symmetricEigen(S);
+ * @endcode
+ *
+ * Only the lower triangle is read and the derivatives are taken with respect
+ * to symmetric perturbations.
+ * The eigenvectors are determined up to sign; their derivatives require
+ * distinct eigenvalues.
+ * Requires including @c <Eigen/Eigenvalues>.
+ */
+template <typename X>
+auto symmetricEigen(Expression<X> const& x)
+    -> std::enable_if_t<EigenAD::hasMatrixBaseValue_v<X>,
+        decltype(outputVariables(EigenAD::SymmetricEigen<X>(x)))>
+{
+    return outputVariables(EigenAD::SymmetricEigen<X>(x));
+}
+
+} // namespace AutoDiff
+
+#endif // AUTODIFF_SRC_EIGEN_LINEAR_ALGEBRA_OPS_SYMMETRIC_EIGEN_HPP
@@ -0,0 +1,172 @@
+// Copyright (c) 2024 Matthias Krippner
+//
+// This software is released under the MIT License.
+// https://opensource.org/licenses/MIT
+
+#ifndef AUTODIFF_SRC_EIGEN_LINEAR_ALGEBRA_OPS_THIN_QR_HPP
+#define AUTODIFF_SRC_EIGEN_LINEAR_ALGEBRA_OPS_THIN_QR_HPP
+
+namespace AutoDiff::EigenAD {
+
+/**
+ * @brief Thin QR decomposition A = Q R of an m x n matrix with m >= n and
+ * full column rank.
+ *
+ * Both factors are computed by one decomposition per evaluation.
+ * With X = Q^T dA R^-1 and U = triu(X) + tril(X, -1)^T, the derivatives are
+ *   dR = U R,   dQ = dA R^-1 - Q U,
+ *   A' = (Q' + Q copyltu(R R'^T - Q'^T Q)) R^-T,
+ * where copyltu(M) is the symmetric matrix with the lower triangle of M.
+ * The products with R^-1 are triangular solves.
+ */
+template <typename X, typename Scalar = typename ValueType_t<X>::Scalar>
+class ThinQR : public MultiOutputOperation<X, DynamicMatrix<Scalar>,
+                   DynamicMatrix<Scalar>> {
+public:
+    using Base
+        = MultiOutputOperation<X, DynamicMatrix<Scalar>, DynamicMatrix<Scalar>>;
+    using Base::Base;
+    using typename Base::Derivative;
+    using typename Base::Gradients;
+    using DenseDerivative = Dense_t<Derivative>;
+
+    // MultiOutputOperation implementation =====================================
+
+    void _releaseCacheImpl()
+    {
+        Base::_releaseCacheImpl();
+        mDecomposition.release();
+    }
+
+    [[nodiscard]] auto _valueImpl()
+    {
+        auto const& qr = decomposition();
+        return std::make_tuple(toValueScalar<Scalar>(qr.matrixQ()),
+            toValueScalar<Scalar>(qr.matrixR()));
+    }
+
+    [[nodiscard]] auto _pushForwardImpl()
+    {
+        auto const& qr   = decomposition();
+        auto const& q    = qr.matrixQ();
+        auto const& r    = qr.matrixR();
+        auto const rows  = q.rows();
+        auto const cols  = q.cols();
+        auto const upper = r.template triangularView<detail::upper>();
+
+        auto const tangent   = DenseDerivative(densify(Base::xPushForward()));
+        auto const derivCols = tangent.cols();
+        auto qTangent        = DenseDerivative(rows * cols, derivCols);
+        auto rTangent        = DenseDerivative(cols * cols, derivCols);
+        auto solved          = DenseDerivative(rows, cols);
+        auto projected       = DenseDerivative(cols, cols);
+        for (std::ptrdiff_t j = 0; j != derivCols; ++j) {
+            // dA R^-1
+            solved = tangent.col(j).reshaped(rows, cols);
+            upper.template solveInPlace<detail::onTheRight>(solved);
+            projected.noalias() = q.transpose() * solved;
+            auto const u = upperPart(projected);
+            rTangent.col(j).reshaped(cols, cols).noalias() = u * r;
+            qTangent.col(j).reshaped(rows, cols) = solved;
+            qTangent.col(j).reshaped(rows, cols).noalias() -= q * u;
+        }
+        return std::make_tuple(qTangent, rTangent);
+    }
+
+    void _pullBackImpl(Gradients const& gradients)
+    {
+        auto const& qr   = decomposition();
+        auto const& q    = qr.matrixQ();
+        auto const& r    = qr.matrixR();
+        auto const rows  = q.rows();
+        auto const cols  = q.cols();
+        auto const upper = r.template triangularView<detail::upper>();
+
+        bool const hasQ = gradients[0] != nullptr;
+        bool const hasR = gradients[1] != nullptr;
+        auto const qGradient = denseGradient(gradients[0]);
+        auto const rGradient = denseGradient(gradients[1]);
+        auto const derivRows = hasQ ? qGradient.rows() : rGradient.rows();
+
+        auto gradient = DenseDerivative(derivRows, rows * cols);
+        auto combined = DenseDerivative(rows, cols);
+        auto inner    = DenseDerivative(cols, cols);
+        for (std::ptrdiff_t i = 0; i != derivRows; ++i) {
+            // M = R R'^T - Q'^T Q
+            inner.setZero();
+            if (hasR) {
+                inner.noalias()
+                    += r * rGradient.row(i).reshaped(cols, cols).transpose();
+            }
+            if (hasQ) {
+                combined = qGradient.row(i).reshaped(rows, cols);
+                inner.noalias() -= combined.transpose() * q;
+            } else {
+                combined.setZero();
+            }
+            combined.noalias()
+                += q * inner.template selfadjointView<detail::lower>();
+            // (Q' + Q copyltu(M)) R^-T
+            upper.transpose().template solveInPlace<detail::onTheRight>(
+                combined);
+            gradient.row(i) = combined.reshaped();
+        }
+        Base::xPullBack(gradient);
+    }
+
+private:
+    [[nodiscard]] auto decomposition() -> decltype(auto)
+    {
+        auto const& qr = mDecomposition([&]() -> decltype(auto) {
+            return promote<Derivative>(Base::xValue());
+        });
+        assert(qr.matrixQ().rows() >= qr.matrixQ().cols()
+            && "MATRIX HAS FEWER ROWS THAN COLUMNS");
+        return qr;
+    }
+
+    // U = triu(X) + tril(X, -1)^T, the upper triangular part of dR R^-1
+    [[nodiscard]] static auto upperPart(DenseDerivative const& projected)
+        -> DenseDerivative
+    {
+        DenseDerivative u
+            = projected.template triangularView<detail::upper>();
+        DenseDerivative const strictlyLower
+            = projected.template triangularView<detail::strictlyLower>();
+        u += strictlyLower.transpose();
+        return u;
+    }
+
+    ThinQRDecomposition<Derivative> mDecomposition;
+};
+
+} // namespace AutoDiff::EigenAD
+
+namespace AutoDiff {
+
+/**
+ * @brief Thin QR decomposition of a matrix with at least as many rows as
+ * columns.
+ *
+ * Returns the factor Q with orthonormal columns and the upper triangular
+ * factor R with nonnegative diagonal as two variables, which share
+ * one decomposition:
+ *
+ * @code{.cpp}
+ * auto [Q, R] = thinQR(A);
+ * @endcode
+ *
+ * The derivatives require full column rank.
+ * Requires including @c <Eigen/QR>.
+ */
+template <typename X>
+auto thinQR(Expression<X> const& x)
+    -> std::enable_if_t<EigenAD::hasMatrixBaseValue_v<X>,
+        decltype(outputVariables(EigenAD::ThinQR<X>(x)))>
+{
+    return outputVariables(EigenAD::ThinQR<X>(x));
+}
+
+} // namespace AutoDiff
+
+#endif // AUTODIFF_SRC_EIGEN_LINEAR_ALGEBRA_OPS_THIN_QR_HPP
@@ -11,6 +11,7 @@
 #include "factories.hpp"
 
 #include "../../Core/BinaryOperation.hpp"
+#include "../derivatives.hpp" // Dense_t mapColumns mapRows promote
 
 #include <cstddef> // ptrdiff
 
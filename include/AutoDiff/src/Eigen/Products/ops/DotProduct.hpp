@@ -13,6 +13,7 @@ class DotProduct : public BinaryOperation<DotProduct<X, Y>, X, Y> {
 public:
     using Base = BinaryOperation<DotProduct<X, Y>, X, Y>;
     using Base::Base;
+    using typename Base::Derivative;
 
     [[nodiscard]] auto _valueImpl() -> decltype(auto)
     {
@@ -22,12 +23,12 @@ public:
     [[nodiscard]] auto _pushForwardImpl() -> decltype(auto)
     {
         if constexpr (!Base::hasOperandX) {
-            return Base::xValue().transpose() * Base::yPushForward();
+            return yDeriv() * Base::yPushForward();
         } else if constexpr (!Base::hasOperandY) {
-            return Base::yValue().transpose() * Base::xPushForward();
+            return xDeriv() * Base::xPushForward();
         } else {
-            return Base::yValue().transpose() * Base::xPushForward()
-                 + Base::xValue().transpose() * Base::yPushForward();
+            return xDeriv() * Base::xPushForward()
+                 + yDeriv() * Base::yPushForward();
         }
     }
 
@@ -35,12 +36,23 @@ public:
     void _pullBackImpl(Derivative const& derivative)
     {
         if constexpr (Base::hasOperandX) {
-            Base::xPullBack(derivative * Base::yValue().transpose());
+            Base::xPullBack(derivative * xDeriv());
         }
         if constexpr (Base::hasOperandY) {
-            Base::yPullBack(derivative * Base::xValue().transpose());
+            Base::yPullBack(derivative * yDeriv());
         }
     }
+
+private:
+    [[nodiscard]] auto xDeriv() -> decltype(auto)
+    {
+        return promote<Derivative>(Base::yValue()).transpose();
+    }
+
+    [[nodiscard]] auto yDeriv() -> decltype(auto)
+    {
+        return promote<Derivative>(Base::xValue()).transpose();
+    }
 };
 
 } // namespace AutoDiff::EigenAD
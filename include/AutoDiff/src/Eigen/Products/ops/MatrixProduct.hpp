@@ -14,83 +14,95 @@ public:
     using Base = BinaryOperation<MatrixProduct<X, Y>, X, Y>;
     using Base::Base;
     using typename Base::Derivative;
+    using DenseDerivative = Dense_t<Derivative>;
 
     [[nodiscard]] auto _valueImpl() -> decltype(auto)
     {
         return Base::xValue() * Base::yValue();
     }
 
-    [[nodiscard]] auto _pushForwardImpl() -> Derivative
+    // The Jacobians are Kronecker products,
+    //   d vec(X Y) = (Y^T kron I) d vec(X) + (I kron X) d vec(Y),
+    // so the slices of a derivative are mapped together in few large GEMMs
+    // where the memory layout allows it.
+
+    [[nodiscard]] auto _pushForwardImpl()
     {
-        auto const& xValue = Base::xValue();
-        auto const& yValue = Base::yValue();
-        Derivative deriv;
+        auto const xValue = promote<Derivative>(Base::xValue()).eval();
+        auto const yValue = promote<Derivative>(Base::yValue()).eval();
+        auto const rows   = xValue.rows();
+        auto const inner  = xValue.cols();
+        auto const cols   = yValue.cols();
 
-        if constexpr (!Base::hasOperandX) {
-            auto const& yDerivative = Base::yPushForward();
-            auto const derivCols    = yDerivative.cols();
-            deriv.resize(xValue.rows() * yValue.cols(), derivCols);
+        // contracts the middle index of the tangent columns, one GEMM each
+        auto const pushForwardX = [&](auto const& xDerivative) {
+            auto const derivCols = xDerivative.cols();
+            auto deriv = DenseDerivative(rows * cols, derivCols);
             for (std::ptrdiff_t j = 0; j != derivCols; ++j) {
-                deriv.col(j) = (xValue
-                                * yDerivative.col(j).reshaped(
-                                    yValue.rows(), yValue.cols()))
-                                   .reshaped();
+                deriv.col(j).reshaped(rows, cols).noalias()
+                    = xDerivative.col(j).reshaped(rows, inner) * yValue;
             }
+            return deriv;
+        };
+        // the tangent columns side by side form a single right-hand side
+        auto const pushForwardY = [&](auto const& yDerivative) {
+            auto const derivCols = yDerivative.cols();
+            auto deriv = DenseDerivative(rows * cols, derivCols);
+            deriv.reshaped(rows, cols * derivCols).noalias()
+                = xValue * yDerivative.reshaped(inner, cols * derivCols);
+            return deriv;
+        };
+
+        if constexpr (!Base::hasOperandX) {
+            return mapColumns(pushForwardY, Base::yPushForward());
         } else if constexpr (!Base::hasOperandY) {
-            auto const& xDerivative = Base::xPushForward();
-            auto const derivCols    = xDerivative.cols();
-            deriv.resize(xValue.rows() * yValue.cols(), derivCols);
-            for (std::ptrdiff_t j = 0; j != derivCols; ++j) {
-                deriv.col(j)
-                    = (xDerivative.col(j).reshaped(xValue.rows(), xValue.cols())
-                        * yValue)
-                          .reshaped();
-            }
+            return mapColumns(pushForwardX, Base::xPushForward());
         } else {
-            auto const& xDerivative = Base::xPushForward();
-            auto const& yDerivative = Base::yPushForward();
-            auto const derivCols = xDerivative.cols(); // = yDerivative.cols()
-            deriv.resize(xValue.rows() * yValue.cols(), derivCols);
-            for (std::ptrdiff_t j = 0; j != derivCols; ++j) {
-                auto const derivX
-                    = (xDerivative.col(j).reshaped(xValue.rows(), xValue.cols())
-                        * yValue)
-                          .reshaped();
-                auto const derivY = (xValue
-                                     * yDerivative.col(j).reshaped(
-                                         yValue.rows(), yValue.cols()))
-                                        .reshaped();
-                deriv.col(j) = derivX + derivY;
-            }
+            return mapColumns(
+                [&](auto const& xDerivative, auto const& yDerivative) {
+                    DenseDerivative deriv = pushForwardX(xDerivative);
+                    deriv += pushForwardY(yDerivative);
+                    return deriv;
+                },
+                Base::xPushForward(), Base::yPushForward());
         }
-
-        return deriv;
     }
 
     template <typename OtherDerivative>
     void _pullBackImpl(OtherDerivative const& derivative)
     {
-        auto const& xValue   = Base::xValue();
-        auto const& yValue   = Base::yValue();
-        auto const derivRows = derivative.rows();
+        auto const xValue = promote<Derivative>(Base::xValue()).eval();
+        auto const yValue = promote<Derivative>(Base::yValue()).eval();
+        auto const rows   = xValue.rows();
+        auto const inner  = xValue.cols();
+        auto const cols   = yValue.cols();
 
         if constexpr (Base::hasOperandX) {
-            auto deriv = Derivative(derivRows, xValue.size());
-            for (std::ptrdiff_t i = 0; i != derivRows; ++i) {
-                auto const matricized
-                    = derivative.row(i).reshaped(xValue.rows(), yValue.cols());
-                deriv.row(i) = (matricized * yValue.transpose()).reshaped();
-            }
-            Base::xPullBack(deriv);
+            // the cotangent rows stacked on top of each other form
+            // a single left-hand side
+            Base::xPullBack(mapRows(
+                [&](auto const& gradient) {
+                    auto const derivRows = gradient.rows();
+                    auto deriv = DenseDerivative(derivRows, rows * inner);
+                    deriv.reshaped(derivRows * rows, inner).noalias()
+                        = gradient.reshaped(derivRows * rows, cols)
+                        * yValue.transpose();
+                    return deriv;
+                },
+                derivative));
         }
         if constexpr (Base::hasOperandY) {
-            auto deriv = Derivative(derivRows, yValue.size());
-            for (std::ptrdiff_t i = 0; i != derivRows; ++i) {
-                auto const matricized
-                    = derivative.row(i).reshaped(xValue.rows(), yValue.cols());
-                deriv.row(i) = (xValue.transpose() * matricized).reshaped();
-            }
-            Base::yPullBack(deriv);
+            // one GEMM for each column of the result
+            Base::yPullBack(mapRows(
+                [&](auto const& gradient) {
+                    auto deriv = DenseDerivative(gradient.rows(), inner * cols);
+                    for (std::ptrdiff_t j = 0; j != cols; ++j) {
+                        deriv.middleCols(j * inner, inner).noalias()
+                            = gradient.middleCols(j * rows, rows) * xValue;
+                    }
+                    return deriv;
+                },
+                derivative));
         }
     }
 };
@@ -15,6 +15,7 @@ public:
     using Base = BinaryOperation<MatrixVectorProduct<X, Y>, X, Y>;
     using Base::Base;
     using typename Base::Derivative;
+    using DenseDerivative = Dense_t<Derivative>;
 
     [[nodiscard]] auto _valueImpl() -> decltype(auto)
     {
@@ -23,41 +24,55 @@ public:
 
     [[nodiscard]] auto _pushForwardImpl() -> decltype(auto)
     {
-        auto const& xValue = Base::xValue();
-        auto const& yValue = Base::yValue();
+        auto const xValue = promote<Derivative>(Base::xValue()).eval();
+        auto const yValue = promote<Derivative>(Base::yValue()).eval();
 
-        if constexpr (!Base::hasOperandX) {
-            return xValue * Base::yPushForward();
-        } else {
-            auto const& xDerivative = Base::xPushForward();
-            auto const derivCols    = xDerivative.cols();
-            auto deriv              = Derivative(xValue.rows(), derivCols);
+        auto const pushForwardX = [&](auto const& xDerivative) {
+            auto const derivCols = xDerivative.cols();
+            auto deriv = DenseDerivative(xValue.rows(), derivCols);
             for (std::ptrdiff_t j = 0; j != derivCols; ++j) {
-                deriv.col(j)
+                deriv.col(j).noalias()
                     = xDerivative.col(j).reshaped(xValue.rows(), xValue.cols())
                     * yValue;
             }
-            if constexpr (Base::hasOperandY) {
-                deriv.noalias() += xValue * Base::yPushForward();
-            }
             return deriv;
+        };
+
+        if constexpr (!Base::hasOperandX) {
+            // xValue may be a local copy, which must not outlive this call
+            return promote<Derivative>(Base::xValue()) * Base::yPushForward();
+        } else if constexpr (!Base::hasOperandY) {
+            return mapColumns(pushForwardX, Base::xPushForward());
+        } else {
+            return mapColumns(
+                [&](auto const& xDerivative, auto const& yDerivative) {
+                    DenseDerivative deriv = pushForwardX(xDerivative);
+                    deriv.noalias() += xValue * yDerivative;
+                    return deriv;
+                },
+                Base::xPushForward(), Base::yPushForward());
         }
     }
 
     template <typename OtherDerivative>
     void _pullBackImpl(OtherDerivative const& derivative)
     {
-        auto const& xValue   = Base::xValue();
-        auto const& yValue   = Base::yValue();
-        auto const derivRows = derivative.rows();
+        auto const xValue = promote<Derivative>(Base::xValue()).eval();
+        auto const yValue = promote<Derivative>(Base::yValue()).eval();
 
         if constexpr (Base::hasOperandX) {
-            auto deriv = Derivative(derivRows, xValue.size());
-            for (std::ptrdiff_t i = 0; i != derivRows; ++i) {
-                deriv.row(i)
-                    = (yValue * derivative.row(i)).transpose().reshaped();
-            }
-            Base::xPullBack(deriv);
+            // d vec(X y) = (y^T kron I) d vec(X), so the stacked cotangent
+            // rows are mapped by a single outer product
+            Base::xPullBack(mapRows(
+                [&](auto const& gradient) {
+                    auto const size = gradient.size();
+                    auto deriv
+                        = DenseDerivative(gradient.rows(), xValue.size());
+                    deriv.reshaped(size, yValue.size()).noalias()
+                        = gradient.reshaped(size, 1) * yValue.transpose();
+                    return deriv;
+                },
+                derivative));
         }
         if constexpr (Base::hasOperandY) {
             Base::yPullBack(derivative * xValue);
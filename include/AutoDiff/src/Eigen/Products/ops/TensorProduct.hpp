@@ -14,75 +14,93 @@ public:
     using Base = BinaryOperation<TensorProduct<X, Y>, X, Y>;
     using Base::Base;
     using typename Base::Derivative;
+    using DenseDerivative = Dense_t<Derivative>;
 
     [[nodiscard]] auto _valueImpl() -> decltype(auto)
     {
         return Base::xValue() * Base::yValue().transpose();
     }
 
-    [[nodiscard]] auto _pushForwardImpl() -> Derivative
+    // d vec(x y^T) = (y kron I) dx + (I kron x) dy, so the slices of
+    // a derivative are mapped together where the memory layout allows it
+
+    [[nodiscard]] auto _pushForwardImpl()
     {
-        auto const& xValue = Base::xValue();
-        auto const& yValue = Base::yValue();
-        Derivative deriv;
+        auto const xValue = promote<Derivative>(Base::xValue()).eval();
+        auto const yValue = promote<Derivative>(Base::yValue()).eval();
+        auto const rows   = xValue.size();
+        auto const cols   = yValue.size();
 
-        if constexpr (!Base::hasOperandX) {
-            auto const& yDerivative = Base::yPushForward();
-            auto const derivCols    = yDerivative.cols();
-            deriv.resize(xValue.size() * yValue.size(), derivCols);
+        auto const pushForwardX = [&](auto const& xDerivative) {
+            auto const derivCols = xDerivative.cols();
+            auto deriv = DenseDerivative(rows * cols, derivCols);
             for (std::ptrdiff_t j = 0; j != derivCols; ++j) {
-                deriv.col(j)
-                    = (xValue * yDerivative.col(j).transpose()).reshaped();
+                deriv.col(j).reshaped(rows, cols).noalias()
+                    = xDerivative.col(j) * yValue.transpose();
             }
+            return deriv;
+        };
+        // a single outer product with the tangent columns side by side
+        auto const pushForwardY = [&](auto const& yDerivative) {
+            auto const derivCols = yDerivative.cols();
+            auto deriv = DenseDerivative(rows * cols, derivCols);
+            deriv.reshaped(rows, cols * derivCols).noalias()
+                = xValue * yDerivative.reshaped(1, cols * derivCols);
+            return deriv;
+        };
+
+        if constexpr (!Base::hasOperandX) {
+            return mapColumns(pushForwardY, Base::yPushForward());
         } else if constexpr (!Base::hasOperandY) {
-            auto const& xDerivative = Base::xPushForward();
-            auto const derivCols    = xDerivative.cols();
-            deriv.resize(xValue.size() * yValue.size(), derivCols);
-            for (std::ptrdiff_t j = 0; j != derivCols; ++j) {
-                deriv.col(j)
-                    = (xDerivative.col(j) * yValue.transpose()).reshaped();
-            }
+            return mapColumns(pushForwardX, Base::xPushForward());
         } else {
-            auto const& xDerivative = Base::xPushForward();
-            auto const& yDerivative = Base::yPushForward();
-            auto const derivCols = xDerivative.cols(); // == yDerivative.cols()
-            deriv.resize(xValue.size() * yValue.size(), derivCols);
-            for (std::ptrdiff_t j = 0; j != derivCols; ++j) {
-                auto const derivX
-                    = (xDerivative.col(j) * yValue.transpose()).reshaped();
-                auto const derivY
-                    = (xValue * yDerivative.col(j).transpose()).reshaped();
-                deriv.col(j) = derivX + derivY;
-            }
+            return mapColumns(
+                [&](auto const& xDerivative, auto const& yDerivative) {
+                    DenseDerivative deriv = pushForwardX(xDerivative);
+                    deriv += pushForwardY(yDerivative);
+                    return deriv;
+                },
+                Base::xPushForward(), Base::yPushForward());
         }
-
-        return deriv;
     }
 
     template <typename OtherDerivative>
     void _pullBackImpl(OtherDerivative const& derivative)
     {
-        auto const& xValue   = Base::xValue();
-        auto const& yValue   = Base::yValue();
-        auto const derivRows = derivative.rows();
+        auto const xValue = promote<Derivative>(Base::xValue()).eval();
+        auto const yValue = promote<Derivative>(Base::yValue()).eval();
+        auto const rows   = xValue.size();
+        auto const cols   = yValue.size();
 
         if constexpr (Base::hasOperandX) {
-            auto deriv = Derivative(derivRows, xValue.size());
-            for (std::ptrdiff_t i = 0; i != derivRows; ++i) {
-                auto const matricized
-                    = derivative.row(i).reshaped(xValue.size(), yValue.size());
-                deriv.row(i) = (matricized * yValue).transpose();
-            }
-            Base::xPullBack(deriv);
+            // a single GEMV with the cotangent rows stacked
+            Base::xPullBack(mapRows(
+                [&](auto const& gradient) {
+                    auto const derivRows = gradient.rows();
+                    auto deriv = DenseDerivative(derivRows, rows);
+                    deriv.reshaped().noalias()
+                        = gradient.reshaped(derivRows * rows, cols) * yValue;
+                    return deriv;
+                },
+                derivative));
         }
         if constexpr (Base::hasOperandY) {
-            auto deriv = Derivative(derivRows, yValue.size());
-            for (std::ptrdiff_t i = 0; i != derivRows; ++i) {
-                auto const matricized
-                    = derivative.row(i).reshaped(xValue.size(), yValue.size());
-                deriv.row(i) = xValue.transpose() * matricized;
-            }
-            Base::yPullBack(deriv);
+            // sums the blocks of all cotangent rows for each entry of x
+            Base::yPullBack(mapRows(
+                [&](auto const& gradient) {
+                    auto const derivRows = gradient.rows();
+                    auto const blocks
+                        = gradient.reshaped(derivRows * rows, cols);
+                    DenseDerivative deriv
+                        = DenseDerivative::Zero(derivRows, cols);
+                    for (std::ptrdiff_t i = 0; i != rows; ++i) {
+                        deriv.noalias() += xValue(i)
+                                         * blocks.middleRows(
+                                             i * derivRows, derivRows);
+                    }
+                    return deriv;
+                },
+                derivative));
         }
     }
 };
@@ -10,8 +10,13 @@
 
 #include "factories.hpp"
 
+#include "../../Core/Cached.hpp" // CachedValue
 #include "../../Core/UnaryOperation.hpp"
+#include "../derivatives.hpp" // broadcasting promote
 
-#include <cstddef> // ptrdiff
+#include <cstddef>     // ptrdiff size_t
+#include <type_traits> // conditional decay
+#include <utility>     // declval
+#include <vector>
 
 #endif // AUTODIFF_SRC_EIGEN_REDUCTIONS_COMMON_HPP
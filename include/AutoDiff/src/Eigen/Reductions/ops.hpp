@@ -18,5 +18,6 @@
 #include "ops/Norm.hpp"
 #include "ops/SquaredNorm.hpp"
 #include "ops/Total.hpp"
+#include "ops/Vectorwise.hpp"
 
 #endif // AUTODIFF_SRC_EIGEN_REDUCTIONS_OPS_HPP
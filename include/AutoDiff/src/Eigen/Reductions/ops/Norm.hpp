@@ -13,6 +13,7 @@ class Norm : public UnaryOperation<Norm<X>, X> {
 public:
     using Base = UnaryOperation<Norm<X>, X>;
     using Base::Base;
+    using typename Base::Derivative;
 
     [[nodiscard]] auto _valueImpl() -> decltype(auto)
     {
@@ -21,15 +22,20 @@ public:
 
     [[nodiscard]] auto _pushForwardImpl() -> decltype(auto)
     {
-        return Base::xValue().reshaped().transpose() / _valueImpl()
-             * Base::xPushForward();
+        return xDeriv() * Base::xPushForward();
     }
 
     template <typename Derivative>
     void _pullBackImpl(Derivative const& derivative)
     {
-        Base::xPullBack(
-            derivative * Base::xValue().reshaped().transpose() / _valueImpl());
+        Base::xPullBack(derivative * xDeriv());
+    }
+
+private:
+    [[nodiscard]] auto xDeriv() -> decltype(auto)
+    {
+        return promote<Derivative>(Base::xValue()).reshaped().transpose()
+             / _valueImpl();
     }
 };
 
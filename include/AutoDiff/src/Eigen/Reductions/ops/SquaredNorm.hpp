@@ -13,6 +13,7 @@ class SquaredNorm : public UnaryOperation<SquaredNorm<X>, X> {
 public:
     using Base = UnaryOperation<SquaredNorm<X>, X>;
     using Base::Base;
+    using typename Base::Derivative;
 
     [[nodiscard]] auto _valueImpl() -> decltype(auto)
     {
@@ -21,13 +22,19 @@ public:
 
     [[nodiscard]] auto _pushForwardImpl() -> decltype(auto)
     {
-        return Base::xValue().reshaped().transpose() * 2 * Base::xPushForward();
+        return xDeriv() * Base::xPushForward();
     }
 
     template <typename Derivative>
     void _pullBackImpl(Derivative const& derivative)
     {
-        Base::xPullBack(derivative * Base::xValue().reshaped().transpose() * 2);
+        Base::xPullBack(derivative * xDeriv());
+    }
+
+private:
+    [[nodiscard]] auto xDeriv() -> decltype(auto)
+    {
+        return 2 * promote<Derivative>(Base::xValue()).reshaped().transpose();
     }
 };
 
@@ -21,14 +21,14 @@ public:
 
     [[nodiscard]] auto _pushForwardImpl() -> decltype(auto)
     {
-        return Base::xPushForward().colwise().sum();
+        return sumRows(Base::xPushForward());
     }
 
     template <typename Derivative>
     void _pullBackImpl(Derivative const& derivative)
     {
         auto const size = Base::xValue().size();
-        Base::xPullBack(derivative.replicate(1, size));
+        Base::xPullBack(replicateCol(derivative, size));
     }
 };
 
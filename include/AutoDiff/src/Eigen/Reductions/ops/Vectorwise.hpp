@@ -0,0 +1,292 @@
+// Copyright (c) 2024 Matthias Krippner
+//
+// This software is released under the MIT License.
+// https://opensource.org/licenses/MIT
+
+#ifndef AUTODIFF_SRC_EIGEN_REDUCTIONS_OPS_VECTORWISE_HPP
+#define AUTODIFF_SRC_EIGEN_REDUCTIONS_OPS_VECTORWISE_HPP
+
+namespace AutoDiff::EigenAD {
+
+/**
+ * @brief Reductions of the columns or rows of a matrix.
+ */
+enum class VectorwiseReduction { Sum, Mean, SquaredNorm, Norm, Max, Min };
+
+/**
+ * @brief Reduction of each column (to a row) or of each row (to a column).
+ *
+ * Each reduced coefficient depends on one group of coefficients of the
+ * operand, i.e., one column or row. The derivatives are mapped group by
+ * group: sums and means add up (or copy) blocks, norms contract them with
+ * the weights x / ||x||, and extrema select single rows or columns.
+ * Neither the Jacobian nor replicated gradients are formed.
+ */
+template <typename X, bool IsColwise, VectorwiseReduction Reduction>
+class Vectorwise
+    : public UnaryOperation<Vectorwise<X, IsColwise, Reduction>, X> {
+public:
+    using Base  = UnaryOperation<Vectorwise<X, IsColwise, Reduction>, X>;
+    using Plain = internal::Evaluated_t<ValueType_t<X>>;
+    using Value = std::decay_t<std::conditional_t<IsColwise,
+        decltype(std::declval<Plain const&>().colwise().sum().eval()),
+        decltype(std::declval<Plain const&>().rowwise().sum().eval())>>;
+    using Base::Base;
+    using typename Base::Derivative;
+    using DenseDerivative = Dense_t<Derivative>;
+
+    void _releaseCacheImpl()
+    {
+        Base::_releaseCacheImpl();
+        mValue.release();
+    }
+
+    [[nodiscard]] auto _valueImpl() -> Value const&
+    {
+        return mValue([&]() {
+            auto const xValue = Base::xValue().eval();
+            if constexpr (IsColwise) {
+                return reduce(xValue.colwise());
+            } else {
+                return reduce(xValue.rowwise());
+            }
+        });
+    }
+
+    [[nodiscard]] auto _pushForwardImpl()
+    {
+        auto const xValue = promote<Derivative>(Base::xValue()).eval();
+        auto const rows   = xValue.rows();
+        auto const cols   = xValue.cols();
+        auto const size   = IsColwise ? cols : rows;
+
+        if constexpr (isSelection) {
+            auto const sources = this->sources(xValue);
+            return mapColumns(
+                [&](auto const& tangent) {
+                    auto deriv = DenseDerivative(size, tangent.cols());
+                    for (std::ptrdiff_t k = 0; k != size; ++k) {
+                        deriv.row(k) = tangent.row(
+                            sources[static_cast<std::size_t>(k)]);
+                    }
+                    return deriv;
+                },
+                Base::xPushForward());
+        } else {
+            auto const weights = this->weights(xValue);
+            return mapColumns(
+                [&](auto const& tangent) {
+                    auto const derivCols = tangent.cols();
+                    if constexpr (IsColwise) {
+                        auto deriv = DenseDerivative(cols, derivCols);
+                        for (std::ptrdiff_t j = 0; j != cols; ++j) {
+                            auto const block
+                                = tangent.middleRows(j * rows, rows);
+                            if constexpr (isLinear) {
+                                deriv.row(j) = weights * block.colwise().sum();
+                            } else {
+                                deriv.row(j).noalias()
+                                    = weights.col(j).transpose() * block;
+                            }
+                        }
+                        return deriv;
+                    } else {
+                        DenseDerivative deriv
+                            = DenseDerivative::Zero(rows, derivCols);
+                        for (std::ptrdiff_t j = 0; j != cols; ++j) {
+                            auto const block
+                                = tangent.middleRows(j * rows, rows);
+                            if constexpr (isLinear) {
+                                deriv += block;
+                            } else {
+                                deriv += weights.col(j).asDiagonal() * block;
+                            }
+                        }
+                        if constexpr (isLinear) {
+                            deriv *= weights;
+                        }
+                        return deriv;
+                    }
+                },
+                Base::xPushForward());
+        }
+    }
+
+    template <typename OtherDerivative>
+    void _pullBackImpl(OtherDerivative const& derivative)
+    {
+        auto const xValue = promote<Derivative>(Base::xValue()).eval();
+        auto const rows   = xValue.rows();
+        auto const cols   = xValue.cols();
+
+        if constexpr (isSelection) {
+            auto const sources = this->sources(xValue);
+            Base::xPullBack(mapRows(
+                [&](auto const& gradient) {
+                    DenseDerivative deriv
+                        = DenseDerivative::Zero(gradient.rows(), rows * cols);
+                    for (std::size_t k = 0; k != sources.size(); ++k) {
+                        deriv.col(sources[k])
+                            = gradient.col(static_cast<std::ptrdiff_t>(k));
+                    }
+                    return deriv;
+                },
+                derivative));
+        } else {
+            auto const weights = this->weights(xValue);
+            Base::xPullBack(mapRows(
+                [&](auto const& gradient) {
+                    auto deriv = DenseDerivative(gradient.rows(), rows * cols);
+                    for (std::ptrdiff_t j = 0; j != cols; ++j) {
+                        auto block = deriv.middleCols(j * rows, rows);
+                        if constexpr (IsColwise && isLinear) {
+                            block.colwise() = weights * gradient.col(j);
+                        } else if constexpr (IsColwise) {
+                            block.noalias()
+                                = gradient.col(j) * weights.col(j).transpose();
+                        } else if constexpr (isLinear) {
+                            block = weights * gradient;
+                        } else {
+                            block = gradient * weights.col(j).asDiagonal();
+                        }
+                    }
+                    return deriv;
+                },
+                derivative));
+        }
+    }
+
+private:
+    static constexpr bool isLinear = Reduction == VectorwiseReduction::Sum
+                                  || Reduction == VectorwiseReduction::Mean;
+    static constexpr bool isSelection = Reduction == VectorwiseReduction::Max
+                                     || Reduction == VectorwiseReduction::Min;
+
+    template <typename VectorwiseOp>
+    static auto reduce(VectorwiseOp const& vectorwise)
+    {
+        if constexpr (Reduction == VectorwiseReduction::Sum) {
+            return vectorwise.sum().eval();
+        } else if constexpr (Reduction == VectorwiseReduction::Mean) {
+            return vectorwise.mean().eval();
+        } else if constexpr (Reduction == VectorwiseReduction::SquaredNorm) {
+            return vectorwise.squaredNorm().eval();
+        } else if constexpr (Reduction == VectorwiseReduction::Norm) {
+            return vectorwise.norm().eval();
+        } else if constexpr (Reduction == VectorwiseReduction::Max) {
+            return vectorwise.maxCoeff().eval();
+        } else {
+            return vectorwise.minCoeff().eval();
+        }
+    }
+
+    // the derivative of each reduced coefficient by its group, as column
+    // (a single scale for sums and means)
+    template <typename Matrix>
+    static auto weights(Matrix const& matrix)
+    {
+        using Scalar = typename Matrix::Scalar;
+        if constexpr (Reduction == VectorwiseReduction::Sum) {
+            return Scalar(1);
+        } else if constexpr (Reduction == VectorwiseReduction::Mean) {
+            auto const size = IsColwise ? matrix.rows() : matrix.cols();
+            return Scalar(1) / static_cast<Scalar>(size);
+        } else if constexpr (Reduction == VectorwiseReduction::SquaredNorm) {
+            return (Scalar(2) * matrix).eval();
+        } else if constexpr (IsColwise) {
+            return (matrix.array().rowwise() / matrix.colwise().norm().array())
+                .matrix()
+                .eval();
+        } else {
+            return (matrix.array().colwise() / matrix.rowwise().norm().array())
+                .matrix()
+                .eval();
+        }
+    }
+
+    // the flat index of the extremum of each group
+    template <typename Matrix>
+    static auto sources(Matrix const& matrix) -> std::vector<std::ptrdiff_t>
+    {
+        auto const rows = matrix.rows();
+        auto const size = IsColwise ? matrix.cols() : rows;
+        auto sources
+            = std::vector<std::ptrdiff_t>(static_cast<std::size_t>(size));
+        for (std::ptrdiff_t k = 0; k != size; ++k) {
+            auto& source = sources[static_cast<std::size_t>(k)];
+            if constexpr (IsColwise) {
+                source = argExtremum(matrix.col(k)) + k * rows;
+            } else {
+                source = k + argExtremum(matrix.row(k)) * rows;
+            }
+        }
+        return sources;
+    }
+
+    template <typename Vector>
+    static auto argExtremum(Vector const& vector) -> std::ptrdiff_t
+    {
+        std::ptrdiff_t index = 0;
+        if constexpr (Reduction == VectorwiseReduction::Max) {
+            vector.maxCoeff(&index);
+        } else {
+            vector.minCoeff(&index);
+        }
+        return index;
+    }
+
+    internal::CachedValue<Value> mValue;
+};
+
+template <typename X>
+using ColwiseSum = Vectorwise<X, true, VectorwiseReduction::Sum>;
+template <typename X>
+using RowwiseSum = Vectorwise<X, false, VectorwiseReduction::Sum>;
+template <typename X>
+using ColwiseMean = Vectorwise<X, true, VectorwiseReduction::Mean>;
+template <typename X>
+using RowwiseMean = Vectorwise<X, false, VectorwiseReduction::Mean>;
+template <typename X>
+using ColwiseSquaredNorm
+    = Vectorwise<X, true, VectorwiseReduction::SquaredNorm>;
+template <typename X>
+using RowwiseSquaredNorm
+    = Vectorwise<X, false, VectorwiseReduction::SquaredNorm>;
+template <typename X>
+using ColwiseNorm = Vectorwise<X, true, VectorwiseReduction::Norm>;
+template <typename X>
+using RowwiseNorm = Vectorwise<X, false, VectorwiseReduction::Norm>;
+template <typename X>
+using ColwiseMax = Vectorwise<X, true, VectorwiseReduction::Max>;
+template <typename X>
+using RowwiseMax = Vectorwise<X, false, VectorwiseReduction::Max>;
+template <typename X>
+using ColwiseMin = Vectorwise<X, true, VectorwiseReduction::Min>;
+template <typename X>
+using RowwiseMin = Vectorwise<X, false, VectorwiseReduction::Min>;
+
+} // namespace AutoDiff::EigenAD
+
+namespace AutoDiff {
+
+// reductions of each column (to a row vector)
+AUTODIFF_MAKE_MATRIXBASE_UNARY_OP(colwiseSum, EigenAD::ColwiseSum)
+AUTODIFF_MAKE_MATRIXBASE_UNARY_OP(colwiseMean, EigenAD::ColwiseMean)
+AUTODIFF_MAKE_MATRIXBASE_UNARY_OP(
+    colwiseSquaredNorm, EigenAD::ColwiseSquaredNorm)
+AUTODIFF_MAKE_MATRIXBASE_UNARY_OP(colwiseNorm, EigenAD::ColwiseNorm)
+AUTODIFF_MAKE_MATRIXBASE_UNARY_OP(colwiseMax, EigenAD::ColwiseMax)
+AUTODIFF_MAKE_MATRIXBASE_UNARY_OP(colwiseMin, EigenAD::ColwiseMin)
+
+// reductions of each row (to a column vector)
+AUTODIFF_MAKE_MATRIXBASE_UNARY_OP(rowwiseSum, EigenAD::RowwiseSum)
+AUTODIFF_MAKE_MATRIXBASE_UNARY_OP(rowwiseMean, EigenAD::RowwiseMean)
+AUTODIFF_MAKE_MATRIXBASE_UNARY_OP(
+    rowwiseSquaredNorm, EigenAD::RowwiseSquaredNorm)
+AUTODIFF_MAKE_MATRIXBASE_UNARY_OP(rowwiseNorm, EigenAD::RowwiseNorm)
+AUTODIFF_MAKE_MATRIXBASE_UNARY_OP(rowwiseMax, EigenAD::RowwiseMax)
+AUTODIFF_MAKE_MATRIXBASE_UNARY_OP(rowwiseMin, EigenAD::RowwiseMin)
+
+} // namespace AutoDiff
+
+#endif // AUTODIFF_SRC_EIGEN_REDUCTIONS_OPS_VECTORWISE_HPP
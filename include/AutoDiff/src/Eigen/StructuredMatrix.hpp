@@ -0,0 +1,626 @@
+// Copyright (c) 2024 Matthias Krippner
+//
+// This software is released under the MIT License.
+// https://opensource.org/licenses/MIT
+
+/**
+ * @file StructuredMatrix.hpp
+ * @brief Defines a derivative type that keeps diagonal structure symbolic.
+ */
+
+#ifndef AUTODIFF_SRC_EIGEN_STRUCTURED_MATRIX_HPP
+#define AUTODIFF_SRC_EIGEN_STRUCTURED_MATRIX_HPP
+
+#include "traits.hpp" // isScalar
+
+#include <cassert>
+#include <cstddef> // ptrdiff_t
+#include <cstdint> // uint8_t
+#include <ostream>
+#include <type_traits> // enable_if
+#include <utility>     // move
+
+// forward-declare Eigen types
+
+namespace Eigen {
+
+template <typename Derived>
+class DiagonalBase;
+
+template <typename Derived>
+class MatrixBase;
+
+template <typename Scalar_, int Rows_, int Cols_, int Options_, int MaxRows_,
+    int MaxCols_>
+class Matrix;
+
+} // namespace Eigen
+
+namespace AutoDiff::EigenAD {
+
+/**
+ * @class StructuredMatrix
+ * @brief A matrix that is either zero, a scaled identity, diagonal or dense.
+ *
+ * The Jacobians of elementwise operations are diagonal.
+ * As a derivative type, this class keeps them diagonal through elementwise
+ * operations, sums and differences, so that differentiating such operations
+ * costs O(n) instead of O(n^2) for n coefficients.
+ * Zero and identity maps generated by a @c Function are not materialized.
+ * Operations that need a dense derivative (e.g., matrix products)
+ * convert it with @c toDense.
+ *
+ * @code{.cpp}
+ * using Derivative = EigenAD::StructuredMatrix<double>;
+ * auto x = Variable<Eigen::VectorXd, Derivative>(Eigen::VectorXd::Ones(1000));
+ * auto y = var(exp(x) + x);
+ * Function(from(x), to(y)).pushTangentAt(x); // d(y) is diagonal
+ * @endcode
+ *
+ * @tparam Scalar_      the type of the coefficients
+ */
+template <typename Scalar_>
+class StructuredMatrix {
+public:
+    using Scalar         = Scalar_;
+    using Index          = std::ptrdiff_t;
+    using DenseMatrix    = Eigen::Matrix<Scalar, -1, -1, 0, -1, -1>;
+    using DiagonalVector = Eigen::Matrix<Scalar, -1, 1, 0, -1, 1>;
+
+    enum Structure : std::uint8_t { zero, scaledIdentity, diagonal, dense };
+
+    class RowwiseView;
+    class ColwiseView;
+
+    /**
+     * @brief Create an empty zero matrix.
+     */
+    StructuredMatrix() = default;
+
+    /**
+     * @brief Create a dense matrix.
+     */
+    explicit StructuredMatrix(DenseMatrix matrix)
+        : mStructure{dense}
+        , mRows{matrix.rows()}
+        , mCols{matrix.cols()}
+        , mDense{std::move(matrix)}
+    {
+    }
+
+    /**
+     * @brief Create a dense matrix from an Eigen expression.
+     */
+    template <typename Derived>
+    explicit StructuredMatrix(Eigen::MatrixBase<Derived> const& matrix)
+        : StructuredMatrix{DenseMatrix(matrix)}
+    {
+    }
+
+    /**
+     * @brief Create a zero matrix.
+     */
+    [[nodiscard]] static auto Zero(Index rows, Index cols) -> StructuredMatrix
+    {
+        auto matrix  = StructuredMatrix();
+        matrix.mRows = rows;
+        matrix.mCols = cols;
+        return matrix;
+    }
+
+    /**
+     * @brief Create an identity matrix.
+     *
+     * A non-square identity matrix is dense.
+     */
+    [[nodiscard]] static auto Identity(
+        Index rows, Index cols) -> StructuredMatrix
+    {
+        if (rows != cols) {
+            return StructuredMatrix(DenseMatrix::Identity(rows, cols));
+        }
+        return ScaledIdentity(rows, 1);
+    }
+
+    /**
+     * @brief Create a square matrix equal to the identity times a scalar.
+     */
+    [[nodiscard]] static auto ScaledIdentity(
+        Index size, Scalar scale) -> StructuredMatrix
+    {
+        auto matrix       = StructuredMatrix();
+        matrix.mStructure = scaledIdentity;
+        matrix.mRows      = size;
+        matrix.mCols      = size;
+        matrix.mScale     = scale;
+        return matrix;
+    }
+
+    /**
+     * @brief Create a diagonal matrix from its (reshaped) diagonal.
+     */
+    template <typename Derived>
+    [[nodiscard]] static auto Diagonal(
+        Eigen::MatrixBase<Derived> const& coeffs) -> StructuredMatrix
+    {
+        auto matrix       = StructuredMatrix();
+        matrix.mStructure = diagonal;
+        matrix.mRows      = coeffs.size();
+        matrix.mCols      = coeffs.size();
+        matrix.mDiagonal  = coeffs.reshaped();
+        return matrix;
+    }
+
+    [[nodiscard]] auto structure() const -> Structure { return mStructure; }
+
+    [[nodiscard]] auto rows() const -> Index { return mRows; }
+
+    [[nodiscard]] auto cols() const -> Index { return mCols; }
+
+    [[nodiscard]] auto size() const -> Index { return mRows * mCols; }
+
+    /**
+     * @brief The scale of a scaled identity matrix.
+     */
+    [[nodiscard]] auto scale() const -> Scalar
+    {
+        assert(mStructure == scaledIdentity && "NOT A SCALED IDENTITY");
+        return mScale;
+    }
+
+    /**
+     * @brief The diagonal of a diagonal matrix.
+     */
+    [[nodiscard]] auto diagonalCoeffs() const -> DiagonalVector const&
+    {
+        assert(mStructure == diagonal && "NOT A DIAGONAL MATRIX");
+        return mDiagonal;
+    }
+
+    /**
+     * @brief The coefficients of a dense matrix.
+     */
+    [[nodiscard]] auto denseCoeffs() const -> DenseMatrix const&
+    {
+        assert(mStructure == dense && "NOT A DENSE MATRIX");
+        return mDense;
+    }
+
+    /**
+     * @brief Returns the coefficient at the given position.
+     */
+    [[nodiscard]] auto operator()(Index row, Index col) const -> Scalar
+    {
+        switch (mStructure) {
+        case scaledIdentity: return row == col ? mScale : Scalar(0);
+        case diagonal: return row == col ? mDiagonal(row) : Scalar(0);
+        case dense: return mDense(row, col);
+        default: return Scalar(0);
+        }
+    }
+
+    /**
+     * @brief Converts to a dense Eigen matrix.
+     */
+    [[nodiscard]] auto toDense() const -> DenseMatrix
+    {
+        switch (mStructure) {
+        case scaledIdentity:
+            return DenseMatrix::Identity(mRows, mCols) * mScale;
+        case diagonal: return DenseMatrix(mDiagonal.asDiagonal());
+        case dense: return mDense;
+        default: return DenseMatrix::Zero(mRows, mCols);
+        }
+    }
+
+    /**
+     * @brief Add this matrix times a factor to a dense Eigen matrix.
+     */
+    template <typename Derived>
+    void addTo(Eigen::MatrixBase<Derived>& matrix, Scalar factor = 1) const
+    {
+        assert(matrix.rows() == mRows && matrix.cols() == mCols);
+        switch (mStructure) {
+        case scaledIdentity:
+            matrix.diagonal().array() += factor * mScale;
+            break;
+        case diagonal: matrix.diagonal() += factor * mDiagonal; break;
+        case dense: matrix += factor * mDense; break;
+        default: break;
+        }
+    }
+
+    auto operator+=(StructuredMatrix const& other) -> StructuredMatrix&
+    {
+        if (mStructure == dense) {
+            other.addTo(mDense);
+        } else {
+            *this = *this + other;
+        }
+        return *this;
+    }
+
+    template <typename Derived>
+    auto operator+=(
+        Eigen::MatrixBase<Derived> const& other) -> StructuredMatrix&
+    {
+        if (mStructure != dense) {
+            *this = StructuredMatrix(toDense());
+        }
+        mDense += other;
+        return *this;
+    }
+
+    // Eigen-like broadcasting, used by operations with scalar operands =======
+
+    /**
+     * @brief Replicates the matrix; the result is dense unless zero.
+     */
+    [[nodiscard]] auto replicate(
+        Index rowFactor, Index colFactor) const -> StructuredMatrix
+    {
+        if (rowFactor == 1 && colFactor == 1) {
+            return *this;
+        }
+        if (mStructure == zero) {
+            return Zero(mRows * rowFactor, mCols * colFactor);
+        }
+        return StructuredMatrix(toDense().replicate(rowFactor, colFactor));
+    }
+
+    /**
+     * @brief Returns the row with the given index as a 1 x cols matrix.
+     */
+    [[nodiscard]] auto row(Index index) const -> StructuredMatrix
+    {
+        if (mStructure == zero) {
+            return Zero(1, mCols);
+        }
+        if (mStructure == dense) {
+            return StructuredMatrix(mDense.row(index));
+        }
+        auto result = DenseMatrix::Zero(1, mCols).eval();
+        result(0, index) = (*this)(index, index);
+        return StructuredMatrix(std::move(result));
+    }
+
+    [[nodiscard]] auto rowwise() const -> RowwiseView
+    {
+        return RowwiseView(*this);
+    }
+
+    [[nodiscard]] auto colwise() const -> ColwiseView
+    {
+        return ColwiseView(*this);
+    }
+
+    // Arithmetic ==============================================================
+
+    [[nodiscard]] friend auto operator-(
+        StructuredMatrix const& matrix) -> StructuredMatrix
+    {
+        return matrix.scaled(-1);
+    }
+
+    [[nodiscard]] friend auto operator+(StructuredMatrix const& left,
+        StructuredMatrix const& right) -> StructuredMatrix
+    {
+        return combine(left, right, 1);
+    }
+
+    [[nodiscard]] friend auto operator-(StructuredMatrix const& left,
+        StructuredMatrix const& right) -> StructuredMatrix
+    {
+        return combine(left, right, -1);
+    }
+
+    template <typename T, typename = std::enable_if_t<isScalar_v<T>>>
+    [[nodiscard]] friend auto operator*(
+        StructuredMatrix const& matrix, T scalar) -> StructuredMatrix
+    {
+        return matrix.scaled(static_cast<Scalar>(scalar));
+    }
+
+    template <typename T, typename = std::enable_if_t<isScalar_v<T>>>
+    [[nodiscard]] friend auto operator*(
+        T scalar, StructuredMatrix const& matrix) -> StructuredMatrix
+    {
+        return matrix.scaled(static_cast<Scalar>(scalar));
+    }
+
+    template <typename T, typename = std::enable_if_t<isScalar_v<T>>>
+    [[nodiscard]] friend auto operator/(
+        StructuredMatrix const& matrix, T scalar) -> StructuredMatrix
+    {
+        auto const divisor = static_cast<Scalar>(scalar);
+        switch (matrix.mStructure) {
+        case scaledIdentity:
+            return ScaledIdentity(matrix.mRows, matrix.mScale / divisor);
+        case diagonal: return Diagonal(matrix.mDiagonal / divisor);
+        case dense: return StructuredMatrix(matrix.mDense / divisor);
+        default: return matrix;
+        }
+    }
+
+    /**
+     * @brief Left-multiply by a diagonal matrix, preserving the structure.
+     */
+    template <typename Derived>
+    [[nodiscard]] friend auto operator*(
+        Eigen::DiagonalBase<Derived> const& left,
+        StructuredMatrix const& right) -> StructuredMatrix
+    {
+        DiagonalVector const coeffs = left.diagonal();
+        return right.scaledRows(coeffs);
+    }
+
+    /**
+     * @brief Right-multiply by a diagonal matrix, preserving the structure.
+     */
+    template <typename Derived>
+    [[nodiscard]] friend auto operator*(StructuredMatrix const& left,
+        Eigen::DiagonalBase<Derived> const& right) -> StructuredMatrix
+    {
+        DiagonalVector const coeffs = right.diagonal();
+        return left.scaledCols(coeffs);
+    }
+
+    /**
+     * @brief Left-multiply by a dense matrix; the result is dense unless zero.
+     */
+    template <typename Derived>
+    [[nodiscard]] friend auto operator*(
+        Eigen::MatrixBase<Derived> const& left,
+        StructuredMatrix const& right) -> StructuredMatrix
+    {
+        assert(left.cols() == right.mRows);
+        switch (right.mStructure) {
+        case scaledIdentity: return StructuredMatrix(left * right.mScale);
+        case diagonal:
+            return StructuredMatrix(left * right.mDiagonal.asDiagonal());
+        case dense: return StructuredMatrix(left * right.mDense);
+        default: return Zero(left.rows(), right.mCols);
+        }
+    }
+
+    /**
+     * @brief Right-multiply by a dense matrix; the result is dense unless zero.
+     */
+    template <typename Derived>
+    [[nodiscard]] friend auto operator*(StructuredMatrix const& left,
+        Eigen::MatrixBase<Derived> const& right) -> StructuredMatrix
+    {
+        assert(left.mCols == right.rows());
+        switch (left.mStructure) {
+        case scaledIdentity: return StructuredMatrix(left.mScale * right);
+        case diagonal:
+            return StructuredMatrix(left.mDiagonal.asDiagonal() * right);
+        case dense: return StructuredMatrix(left.mDense * right);
+        default: return Zero(left.mRows, right.cols());
+        }
+    }
+
+    template <typename Derived>
+    [[nodiscard]] friend auto operator+(StructuredMatrix const& left,
+        Eigen::MatrixBase<Derived> const& right) -> StructuredMatrix
+    {
+        DenseMatrix result = right;
+        left.addTo(result);
+        return StructuredMatrix(std::move(result));
+    }
+
+    template <typename Derived>
+    [[nodiscard]] friend auto operator+(Eigen::MatrixBase<Derived> const& left,
+        StructuredMatrix const& right) -> StructuredMatrix
+    {
+        return right + left;
+    }
+
+    template <typename Derived>
+    [[nodiscard]] friend auto operator-(StructuredMatrix const& left,
+        Eigen::MatrixBase<Derived> const& right) -> StructuredMatrix
+    {
+        DenseMatrix result = -right;
+        left.addTo(result);
+        return StructuredMatrix(std::move(result));
+    }
+
+    template <typename Derived>
+    [[nodiscard]] friend auto operator-(Eigen::MatrixBase<Derived> const& left,
+        StructuredMatrix const& right) -> StructuredMatrix
+    {
+        DenseMatrix result = left;
+        right.addTo(result, -1);
+        return StructuredMatrix(std::move(result));
+    }
+
+    friend auto operator<<(
+        std::ostream& stream, StructuredMatrix const& matrix) -> std::ostream&
+    {
+        return stream << matrix.toDense();
+    }
+
+private:
+    [[nodiscard]] auto scaled(Scalar factor) const -> StructuredMatrix
+    {
+        switch (mStructure) {
+        case scaledIdentity: return ScaledIdentity(mRows, factor * mScale);
+        case diagonal: return Diagonal(factor * mDiagonal);
+        case dense: return StructuredMatrix(factor * mDense);
+        default: return *this;
+        }
+    }
+
+    [[nodiscard]] auto scaledRows(
+        DiagonalVector const& coeffs) const -> StructuredMatrix
+    {
+        assert(coeffs.size() == mRows);
+        switch (mStructure) {
+        case scaledIdentity: return Diagonal(mScale * coeffs);
+        case diagonal: return Diagonal(coeffs.cwiseProduct(mDiagonal));
+        case dense: return StructuredMatrix(coeffs.asDiagonal() * mDense);
+        default: return *this;
+        }
+    }
+
+    [[nodiscard]] auto scaledCols(
+        DiagonalVector const& coeffs) const -> StructuredMatrix
+    {
+        assert(coeffs.size() == mCols);
+        switch (mStructure) {
+        case zero: return Zero(mRows, mCols);
+        case dense: return StructuredMatrix(mDense * coeffs.asDiagonal());
+        default: return scaledRows(coeffs); // square
+        }
+    }
+
+    // left + sign * right
+    [[nodiscard]] static auto combine(StructuredMatrix const& left,
+        StructuredMatrix const& right, Scalar sign) -> StructuredMatrix
+    {
+        assert(left.mRows == right.mRows && left.mCols == right.mCols);
+        if (right.mStructure == zero) {
+            return left;
+        }
+        if (left.mStructure == zero) {
+            return right.scaled(sign);
+        }
+        if (left.mStructure == scaledIdentity
+            && right.mStructure == scaledIdentity) {
+            return ScaledIdentity(
+                left.mRows, left.mScale + sign * right.mScale);
+        }
+        if (left.mStructure != dense && right.mStructure != dense) {
+            // both diagonal
+            return Diagonal(left.diagonalOf() + sign * right.diagonalOf());
+        }
+        DenseMatrix result = left.toDense();
+        right.addTo(result, sign);
+        return StructuredMatrix(std::move(result));
+    }
+
+    // the diagonal of a scaled identity or diagonal matrix
+    [[nodiscard]] auto diagonalOf() const -> DiagonalVector
+    {
+        if (mStructure == scaledIdentity) {
+            return DiagonalVector::Constant(mRows, mScale);
+        }
+        return mDiagonal;
+    }
+
+    Structure mStructure{zero};
+    Index mRows{0};
+    Index mCols{0};
+    Scalar mScale{0};
+    DiagonalVector mDiagonal{};
+    DenseMatrix mDense{};
+};
+
+/**
+ * @brief Row-wise operations on a @c StructuredMatrix.
+ */
+template <typename Scalar>
+class StructuredMatrix<Scalar>::RowwiseView {
+public:
+    explicit RowwiseView(StructuredMatrix const& matrix)
+        : mMatrix{matrix}
+    {
+    }
+
+    /**
+     * @brief Sum of each row as a column vector.
+     */
+    [[nodiscard]] auto sum() const -> StructuredMatrix
+    {
+        switch (mMatrix.mStructure) {
+        case scaledIdentity:
+        case diagonal:
+            return StructuredMatrix(DenseMatrix(mMatrix.diagonalOf()));
+        case dense: return StructuredMatrix(mMatrix.mDense.rowwise().sum());
+        default: return Zero(mMatrix.mRows, 1);
+        }
+    }
+
+    /**
+     * @brief Add a 1 x cols matrix to each row.
+     */
+    [[nodiscard]] friend auto operator+(
+        RowwiseView const& view,
+        StructuredMatrix const& row) -> StructuredMatrix
+    {
+        return view.broadcast(row, 1);
+    }
+
+    /**
+     * @brief Subtract a 1 x cols matrix from each row.
+     */
+    [[nodiscard]] friend auto operator-(
+        RowwiseView const& view,
+        StructuredMatrix const& row) -> StructuredMatrix
+    {
+        return view.broadcast(row, -1);
+    }
+
+private:
+    [[nodiscard]] auto broadcast(
+        StructuredMatrix const& row, Scalar sign) const -> StructuredMatrix
+    {
+        assert(row.mRows == 1 && row.mCols == mMatrix.mCols);
+        if (row.mStructure == zero) {
+            return mMatrix;
+        }
+        DenseMatrix result = mMatrix.toDense();
+        result.rowwise() += sign * row.toDense().row(0);
+        return StructuredMatrix(std::move(result));
+    }
+
+    StructuredMatrix const& mMatrix;
+};
+
+/**
+ * @brief Column-wise reductions of a @c StructuredMatrix.
+ */
+template <typename Scalar>
+class StructuredMatrix<Scalar>::ColwiseView {
+public:
+    explicit ColwiseView(StructuredMatrix const& matrix)
+        : mMatrix{matrix}
+    {
+    }
+
+    /**
+     * @brief Sum of each column as a row vector.
+     */
+    [[nodiscard]] auto sum() const -> StructuredMatrix
+    {
+        switch (mMatrix.mStructure) {
+        case scaledIdentity:
+        case diagonal:
+            return StructuredMatrix(
+                DenseMatrix(mMatrix.diagonalOf().transpose()));
+        case dense: return StructuredMatrix(mMatrix.mDense.colwise().sum());
+        default: return Zero(1, mMatrix.mCols);
+        }
+    }
+
+    /**
+     * @brief Mean of each column as a row vector.
+     */
+    [[nodiscard]] auto mean() const -> StructuredMatrix
+    {
+        return sum() / mMatrix.mRows;
+    }
+
+private:
+    StructuredMatrix const& mMatrix;
+};
+
+template <typename T>
+constexpr bool isStructured_v = false;
+
+template <typename Scalar>
+constexpr bool isStructured_v<StructuredMatrix<Scalar>> = true;
+
+} // namespace AutoDiff::EigenAD
+
+#endif // AUTODIFF_SRC_EIGEN_STRUCTURED_MATRIX_HPP
@@ -0,0 +1,22 @@
+// Copyright (c) 2024 Matthias Krippner
+//
+// This software is released under the MIT License.
+// https://opensource.org/licenses/MIT
+
+#ifndef AUTODIFF_SRC_EIGEN_TENSOR_COMMON_HPP
+#define AUTODIFF_SRC_EIGEN_TENSOR_COMMON_HPP
+
+// included here instead of for each operation
+
+#include "factories.hpp"
+
+#include "../../Core/BinaryOperation.hpp"
+#include "../../Core/UnaryOperation.hpp"
+#include "../derivatives.hpp" // Dense_t broadcasting mapColumns promote
+#include "derivatives.hpp"
+
+#include <algorithm> // copy find
+#include <array>
+#include <cstddef> // ptrdiff_t size_t
+
+#endif // AUTODIFF_SRC_EIGEN_TENSOR_COMMON_HPP
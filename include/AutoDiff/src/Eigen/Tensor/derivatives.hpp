@@ -0,0 +1,220 @@
+// Copyright (c) 2024 Matthias Krippner
+//
+// This software is released under the MIT License.
+// https://opensource.org/licenses/MIT
+
+/**
+ * @file derivatives.hpp
+ * @brief Helpers for differentiating operations on Eigen tensors.
+ *
+ * The derivatives of tensor-valued expressions are matrices acting on the
+ * flattened (column-major) coefficients.
+ * The columns of a tangent (pushforward) and the rows of a gradient (pullback)
+ * can therefore be viewed as one tensor with an additional dimension,
+ * which lets operations map all of them at once with tensor operations.
+ */
+
+#ifndef AUTODIFF_SRC_EIGEN_TENSOR_DERIVATIVES_HPP
+#define AUTODIFF_SRC_EIGEN_TENSOR_DERIVATIVES_HPP
+
+#include "../../internal/traits.hpp" // Evaluated
+#include "../derivatives.hpp"          // mapColumns
+
+#include <array>
+#include <cstddef>     // ptrdiff_t size_t
+#include <type_traits> // decay is_same
+#include <utility>     // forward
+
+// forward-declare Eigen types
+
+namespace Eigen {
+
+template <typename Scalar_, int Rows_, int Cols_, int Options_, int MaxRows_,
+    int MaxCols_>
+class Matrix;
+
+template <typename Scalar_, int NumIndices_, int Options_, typename IndexType>
+class Tensor;
+
+template <typename T>
+struct MakePointer;
+
+template <typename PlainObjectType, int Options_,
+    template <class> class MakePointer_>
+class TensorMap;
+
+template <typename PlainObjectType, int MapOptions, typename StrideType>
+class Map;
+
+template <int OuterStrideAtCompileTime, int InnerStrideAtCompileTime>
+class Stride;
+
+template <typename Idx>
+struct IndexPair;
+
+} // namespace Eigen
+
+namespace AutoDiff::EigenAD::Tensor {
+
+using Index = std::ptrdiff_t;
+
+template <std::size_t Rank>
+using Dimensions = std::array<Index, Rank>;
+
+template <typename Scalar, std::size_t Rank>
+using PlainTensor = Eigen::Tensor<Scalar, static_cast<int>(Rank), 0, Index>;
+
+template <typename Scalar, std::size_t Rank>
+using TensorMap
+    = Eigen::TensorMap<PlainTensor<Scalar, Rank>, 0, Eigen::MakePointer>;
+
+template <typename Scalar, std::size_t Rank>
+using ConstTensorMap
+    = Eigen::TensorMap<PlainTensor<Scalar, Rank> const, 0, Eigen::MakePointer>;
+
+template <typename Scalar>
+using ConstVectorMap = Eigen::Map<Eigen::Matrix<Scalar, -1, 1, 0, -1, 1> const,
+    0, Eigen::Stride<0, 0>>;
+
+template <typename T>
+constexpr std::size_t rank_v = static_cast<std::size_t>(T::NumDimensions);
+
+/**
+ * @brief Evaluates a tensor expression.
+ *
+ * Evaluated tensors (lvalues) are returned unchanged.
+ */
+template <typename T>
+auto evaluate(T&& tensor) -> decltype(auto)
+{
+    using Plain = internal::Evaluated_t<std::decay_t<T>>;
+    if constexpr (std::is_same_v<std::decay_t<T>, Plain>
+                  && std::is_lvalue_reference_v<T>) {
+        return static_cast<T>(tensor);
+    } else {
+        return Plain(std::forward<T>(tensor));
+    }
+}
+
+/**
+ * @brief The dimensions of an evaluated tensor.
+ */
+template <typename T>
+auto dimensions(T const& tensor) -> Dimensions<rank_v<T>>
+{
+    auto dims = Dimensions<rank_v<T>>();
+    for (std::size_t i = 0; i != dims.size(); ++i) {
+        dims[i] = tensor.dimension(static_cast<Index>(i));
+    }
+    return dims;
+}
+
+/**
+ * @brief The number of coefficients of a tensor with the given dimensions.
+ */
+template <std::size_t Rank>
+auto flatSize(Dimensions<Rank> const& dims) -> Index
+{
+    auto size = Index{1};
+    for (auto const dim : dims) {
+        size *= dim;
+    }
+    return size;
+}
+
+/**
+ * @brief The coefficients of an evaluated tensor as column vector.
+ */
+template <typename T>
+auto flat(T const& tensor) -> ConstVectorMap<typename T::Scalar>
+{
+    return {tensor.data(), tensor.size()};
+}
+
+/**
+ * @brief Appends a dimension, e.g., for the columns of a tangent.
+ */
+template <std::size_t Rank>
+auto append(Dimensions<Rank> const& dims, Index last) -> Dimensions<Rank + 1>
+{
+    auto result = Dimensions<Rank + 1>();
+    for (std::size_t i = 0; i != Rank; ++i) {
+        result[i] = dims[i];
+    }
+    result[Rank] = last;
+    return result;
+}
+
+/**
+ * @brief Prepends a dimension, e.g., for the rows of a gradient.
+ */
+template <std::size_t Rank>
+auto prepend(Index first, Dimensions<Rank> const& dims) -> Dimensions<Rank + 1>
+{
+    auto result = Dimensions<Rank + 1>();
+    result[0]   = first;
+    for (std::size_t i = 0; i != Rank; ++i) {
+        result[i + 1] = dims[i];
+    }
+    return result;
+}
+
+/**
+ * @brief Views the columns of a dense derivative as one tensor.
+ *
+ * The column index is the last index of the tensor.
+ */
+template <typename Matrix, std::size_t Rank>
+auto columnTensor(Matrix const& matrix, Dimensions<Rank> const& dims)
+    -> ConstTensorMap<typename Matrix::Scalar, Rank + 1>
+{
+    return {matrix.data(), append(dims, matrix.cols())};
+}
+
+template <typename Matrix, std::size_t Rank>
+auto columnTensor(Matrix& matrix, Dimensions<Rank> const& dims)
+    -> TensorMap<typename Matrix::Scalar, Rank + 1>
+{
+    return {matrix.data(), append(dims, matrix.cols())};
+}
+
+/**
+ * @brief Views the rows of a dense derivative as one tensor.
+ *
+ * The row index is the first index of the tensor.
+ */
+template <typename Matrix, std::size_t Rank>
+auto rowTensor(Matrix const& matrix, Dimensions<Rank> const& dims)
+    -> ConstTensorMap<typename Matrix::Scalar, Rank + 1>
+{
+    return {matrix.data(), prepend(matrix.rows(), dims)};
+}
+
+template <typename Matrix, std::size_t Rank>
+auto rowTensor(Matrix& matrix, Dimensions<Rank> const& dims)
+    -> TensorMap<typename Matrix::Scalar, Rank + 1>
+{
+    return {matrix.data(), prepend(matrix.rows(), dims)};
+}
+
+/**
+ * @brief Pushes a tangent forward by a coefficient-wise operation.
+ *
+ * The Jacobian of the operation is diagonal, with the coefficients of
+ * @p slope on its diagonal.
+ *
+ * @tparam DenseDerivative the dense type of the derivative
+ */
+template <typename DenseDerivative, typename T, typename Derivative>
+auto scaleTangent(T const& slope, Derivative const& derivative)
+{
+    return mapColumns(
+        [&](auto const& tangent) {
+            return DenseDerivative(flat(slope).asDiagonal() * tangent);
+        },
+        derivative);
+}
+
+} // namespace AutoDiff::EigenAD::Tensor
+
+#endif // AUTODIFF_SRC_EIGEN_TENSOR_DERIVATIVES_HPP
@@ -0,0 +1,95 @@
+// Copyright (c) 2024 Matthias Krippner
+//
+// This software is released under the MIT License.
+// https://opensource.org/licenses/MIT
+
+/**
+ * @file factories.hpp
+ * @brief Macros defining factory functions for operations on Eigen tensors.
+ *
+ * Use these macros inside the @c AutoDiff namespace. They can be used without
+ * namespace qualification in user code because of argument-dependent lookup.
+ */
+
+#ifndef AUTODIFF_SRC_EIGEN_TENSOR_FACTORIES_HPP
+#define AUTODIFF_SRC_EIGEN_TENSOR_FACTORIES_HPP
+
+#include "../traits.hpp"
+#include "derivatives.hpp" // forward-declared Eigen::Tensor
+
+#define AUTODIFF_MAKE_TENSOR_UNARY_OP(operation, Type)                         \
+    template <typename X>                                                      \
+    auto operation(Expression<X> const& x)                                     \
+        -> std::enable_if_t<EigenAD::hasTensorValue_v<X>, Type<X>>             \
+    {                                                                          \
+        return Type<X>(x);                                                     \
+    }
+
+#define AUTODIFF_MAKE_TENSOR_TENSOR_OP(operation, Type)                        \
+    template <typename X, typename Y>                                          \
+    auto operation(Expression<X> const& x, Expression<Y> const& y)             \
+        -> std::enable_if_t<EigenAD::hasTensorValue_v<X>                       \
+                                && EigenAD::hasTensorValue_v<Y>,               \
+            Type<X, Y>>                                                        \
+    {                                                                          \
+        return Type<X, Y>(x, y);                                               \
+    }                                                                          \
+                                                                               \
+    template <typename Scalar, int Rank, typename Index, typename Y>           \
+    auto operation(Eigen::Tensor<Scalar, Rank, 0, Index> const& x,             \
+        Expression<Y> const& y)                                                \
+        -> std::enable_if_t<EigenAD::hasTensorValue_v<Y>,                      \
+            Type<Eigen::Tensor<Scalar, Rank, 0, Index>, Y>>                    \
+    {                                                                          \
+        return Type<Eigen::Tensor<Scalar, Rank, 0, Index>, Y>(x, y);           \
+    }                                                                          \
+                                                                               \
+    template <typename X, typename Scalar, int Rank, typename Index>           \
+    auto operation(Expression<X> const& x,                                     \
+        Eigen::Tensor<Scalar, Rank, 0, Index> const& y)                        \
+        -> std::enable_if_t<EigenAD::hasTensorValue_v<X>,                      \
+            Type<X, Eigen::Tensor<Scalar, Rank, 0, Index>>>                    \
+    {                                                                          \
+        return Type<X, Eigen::Tensor<Scalar, Rank, 0, Index>>(x, y);           \
+    }
+
+#define AUTODIFF_MAKE_TENSOR_SCALAR_OP(operation, Type)                        \
+    template <typename X, typename Scalar>                                     \
+    auto operation(Expression<X> const& x,                                     \
+        Scalar y) -> std::enable_if_t<EigenAD::hasTensorValue_v<X>             \
+                                          && EigenAD::isScalar_v<Scalar>,      \
+                      Type<X, Scalar>>                                         \
+    {                                                                          \
+        return Type<X, Scalar>(x, y);                                          \
+    }                                                                          \
+                                                                               \
+    template <typename X, typename Y>                                          \
+    auto operation(Expression<X> const& x, Expression<Y> const& y)             \
+        -> std::enable_if_t<EigenAD::hasTensorValue_v<X>                       \
+                                && EigenAD::hasScalarValue_v<Y>,               \
+            Type<X, Y>>                                                        \
+    {                                                                          \
+        return Type<X, Y>(x, y);                                               \
+    }
+
+// For commutative operations: the tensor becomes the first operand.
+#define AUTODIFF_MAKE_SCALAR_TENSOR_OP(operation, Type)                        \
+    template <typename Scalar, typename Y>                                     \
+    auto operation(Scalar x, Expression<Y> const& y)                           \
+        -> std::enable_if_t<EigenAD::isScalar_v<Scalar>                        \
+                                && EigenAD::hasTensorValue_v<Y>,               \
+            Type<Y, Scalar>>                                                   \
+    {                                                                          \
+        return Type<Y, Scalar>(y, x);                                          \
+    }                                                                          \
+                                                                               \
+    template <typename X, typename Y>                                          \
+    auto operation(Expression<X> const& x, Expression<Y> const& y)             \
+        -> std::enable_if_t<EigenAD::hasScalarValue_v<X>                       \
+                                && EigenAD::hasTensorValue_v<Y>,               \
+            Type<Y, X>>                                                        \
+    {                                                                          \
+        return Type<Y, X>(y, x);                                               \
+    }
+
+#endif // AUTODIFF_SRC_EIGEN_TENSOR_FACTORIES_HPP
@@ -0,0 +1,32 @@
+// Copyright (c) 2024 Matthias Krippner
+//
+// This software is released under the MIT License.
+// https://opensource.org/licenses/MIT
+
+/**
+ * @file ops.hpp
+ * @brief Includes supported operations for Eigen tensors.
+ */
+
+#ifndef AUTODIFF_SRC_EIGEN_TENSOR_OPS_HPP
+#define AUTODIFF_SRC_EIGEN_TENSOR_OPS_HPP
+
+// avoid includes in operation headers
+#include "common.hpp"
+
+#include "ops/Broadcast.hpp"
+#include "ops/Contraction.hpp"
+#include "ops/Difference.hpp"
+#include "ops/Exp.hpp"
+#include "ops/Log.hpp"
+#include "ops/Negation.hpp"
+#include "ops/Product.hpp"
+#include "ops/Quotient.hpp"
+#include "ops/Reduction.hpp"
+#include "ops/Sqrt.hpp"
+#include "ops/Square.hpp"
+#include "ops/Sum.hpp"
+#include "ops/Tanh.hpp"
+#include "ops/Total.hpp"
+
+#endif // AUTODIFF_SRC_EIGEN_TENSOR_OPS_HPP
@@ -0,0 +1,114 @@
+// Copyright (c) 2024 Matthias Krippner
+//
+// This software is released under the MIT License.
+// https://opensource.org/licenses/MIT
+
+#ifndef AUTODIFF_SRC_EIGEN_TENSOR_OPS_BROADCAST_HPP
+#define AUTODIFF_SRC_EIGEN_TENSOR_OPS_BROADCAST_HPP
+
+namespace AutoDiff::EigenAD::Tensor {
+
+/**
+ * @brief Repeats a tensor along each dimension.
+ *
+ * The gradient sums over the repetitions: each dimension of size d f
+ * of the value is split into the dimensions (d, f) and reduced along f.
+ */
+template <typename X>
+class Broadcast : public UnaryOperation<Broadcast<X>, X> {
+public:
+    using Base = UnaryOperation<Broadcast<X>, X>;
+    using typename Base::Derivative;
+    using DenseDerivative = Dense_t<Derivative>;
+    using Factors         = Dimensions<rank_v<ValueType_t<X>>>;
+
+    Broadcast(Expression<X> const& x, Factors const& factors)
+        : Base(x), mFactors{factors}
+    {
+    }
+
+    [[nodiscard]] auto _valueImpl() -> decltype(auto)
+    {
+        return Base::xValue().broadcast(mFactors);
+    }
+
+    [[nodiscard]] auto _pushForwardImpl()
+    {
+        auto const xDims   = dimensions(evaluate(Base::xValue()));
+        auto const dims    = valueDimensions(xDims);
+        auto const factors = append(mFactors, 1);
+        return mapColumns(
+            [&](auto const& tangent) {
+                auto const& xTangent = tangent.eval();
+                auto result = DenseDerivative(flatSize(dims), xTangent.cols());
+                columnTensor(result, dims)
+                    = columnTensor(xTangent, xDims).broadcast(factors);
+                return result;
+            },
+            Base::xPushForward());
+    }
+
+    template <typename OtherDerivative>
+    void _pullBackImpl(OtherDerivative const& derivative)
+    {
+        using Scalar     = typename DenseDerivative::Scalar;
+        auto const xDims = dimensions(evaluate(Base::xValue()));
+
+        auto split = Dimensions<2 * rank + 1>();
+        auto axes  = Dimensions<rank>();
+        for (std::size_t i = 0; i != rank; ++i) {
+            split[1 + 2 * i] = xDims[i];
+            split[2 + 2 * i] = mFactors[i];
+            axes[i]          = static_cast<Index>(2 + 2 * i);
+        }
+
+        Base::xPullBack(mapRows(
+            [&](auto const& gradient) {
+                auto const& rows = gradient.eval();
+                auto result = DenseDerivative(rows.rows(), flatSize(xDims));
+                split[0]    = rows.rows();
+                rowTensor(result, xDims)
+                    = ConstTensorMap<Scalar, 2 * rank + 1>(rows.data(), split)
+                          .sum(axes);
+                return result;
+            },
+            derivative));
+    }
+
+private:
+    static constexpr auto rank = rank_v<ValueType_t<X>>;
+
+    [[nodiscard]] auto valueDimensions(Dimensions<rank> const& xDims) const
+        -> Dimensions<rank>
+    {
+        auto dims = Dimensions<rank>();
+        for (std::size_t i = 0; i != rank; ++i) {
+            dims[i] = xDims[i] * mFactors[i];
+        }
+        return dims;
+    }
+
+    Factors mFactors;
+};
+
+} // namespace AutoDiff::EigenAD::Tensor
+
+namespace AutoDiff {
+
+/**
+ * @brief Repeats a tensor @p factors[i] times along each dimension @c i.
+ */
+template <typename X, typename Idx, std::size_t Rank>
+auto broadcast(Expression<X> const& x, std::array<Idx, Rank> const& factors)
+    -> std::enable_if_t<EigenAD::hasTensorValue_v<X>,
+        EigenAD::Tensor::Broadcast<X>>
+{
+    auto dims = typename EigenAD::Tensor::Broadcast<X>::Factors();
+    static_assert(Rank == dims.size(), "ONE FACTOR PER DIMENSION");
+    std::copy(factors.begin(), factors.end(), dims.begin());
+    return EigenAD::Tensor::Broadcast<X>(x, dims);
+}
+
+} // namespace AutoDiff
+
+#endif // AUTODIFF_SRC_EIGEN_TENSOR_OPS_BROADCAST_HPP
@@ -0,0 +1,274 @@
+// Copyright (c) 2024 Matthias Krippner
+//
+// This software is released under the MIT License.
+// https://opensource.org/licenses/MIT
+
+#ifndef AUTODIFF_SRC_EIGEN_TENSOR_OPS_CONTRACTION_HPP
+#define AUTODIFF_SRC_EIGEN_TENSOR_OPS_CONTRACTION_HPP
+
+namespace AutoDiff::EigenAD::Tensor {
+
+/**
+ * @brief Contraction of two tensors over pairs of dimensions.
+ *
+ * The free dimensions of @c X are followed by the free dimensions of @c Y,
+ * as for Eigen's @c TensorBase::contract.
+ * The derivatives are contractions with the same tensors, followed by a
+ * shuffle that restores the order of the dimensions.
+ */
+template <typename X, typename Y, std::size_t N>
+class Contraction : public BinaryOperation<Contraction<X, Y, N>, X, Y> {
+public:
+    using Base = BinaryOperation<Contraction<X, Y, N>, X, Y>;
+    using typename Base::Derivative;
+    using DenseDerivative = Dense_t<Derivative>;
+    using Pairs           = std::array<Eigen::IndexPair<Index>, N>;
+
+    template <typename OperandX, typename OperandY>
+    Contraction(OperandX const& x, OperandY const& y, Pairs const& pairs)
+        : Base(x, y), mPairs{pairs}
+    {
+    }
+
+    [[nodiscard]] auto _valueImpl() -> decltype(auto)
+    {
+        return Base::xValue().contract(Base::yValue(), mPairs);
+    }
+
+    [[nodiscard]] auto _pushForwardImpl()
+    {
+        auto const& xValue = evaluate(promote<Derivative>(Base::xValue()));
+        auto const& yValue = evaluate(promote<Derivative>(Base::yValue()));
+        auto const dims    = valueDimensions(xValue, yValue);
+        auto const size    = flatSize(dims);
+
+        auto const xPushForward = [&](auto const& tangent) {
+            auto const& xTangent = tangent.eval();
+            auto result          = DenseDerivative(size, xTangent.cols());
+            columnTensor(result, dims)
+                = columnTensor(xTangent, dimensions(xValue))
+                      .contract(yValue, mPairs)
+                      .shuffle(columnShuffle());
+            return result;
+        };
+        auto const yPushForward = [&](auto const& tangent) {
+            auto const& yTangent = tangent.eval();
+            auto result          = DenseDerivative(size, yTangent.cols());
+            columnTensor(result, dims) = xValue.contract(
+                columnTensor(yTangent, dimensions(yValue)), mPairs);
+            return result;
+        };
+
+        if constexpr (!Base::hasOperandX) {
+            return mapColumns(yPushForward, Base::yPushForward());
+        } else if constexpr (!Base::hasOperandY) {
+            return mapColumns(xPushForward, Base::xPushForward());
+        } else {
+            return mapColumns(
+                [&](auto const& xTangent, auto const& yTangent) {
+                    return DenseDerivative(
+                        xPushForward(xTangent) + yPushForward(yTangent));
+                },
+                Base::xPushForward(), Base::yPushForward());
+        }
+    }
+
+    template <typename OtherDerivative>
+    void _pullBackImpl(OtherDerivative const& derivative)
+    {
+        auto const& xValue = evaluate(promote<Derivative>(Base::xValue()));
+        auto const& yValue = evaluate(promote<Derivative>(Base::yValue()));
+        auto const dims    = valueDimensions(xValue, yValue);
+
+        if constexpr (Base::hasOperandX) {
+            Base::xPullBack(mapRows(
+                [&](auto const& gradient) {
+                    return pullBackFactor<true>(
+                        gradient.eval(), dims, xValue, yValue, mPairs);
+                },
+                derivative));
+        }
+        if constexpr (Base::hasOperandY) {
+            Base::yPullBack(mapRows(
+                [&](auto const& gradient) {
+                    return pullBackFactor<false>(
+                        gradient.eval(), dims, yValue, xValue, swapped(mPairs));
+                },
+                derivative));
+        }
+    }
+
+private:
+    static constexpr auto rank
+        = rank_v<ValueType_t<X>> + rank_v<ValueType_t<Y>> - 2 * N;
+
+    // the free dimensions of X followed by the free dimensions of Y
+    template <typename A, typename B>
+    auto valueDimensions(A const& a, B const& b) const -> Dimensions<rank>
+    {
+        auto dims = Dimensions<rank>();
+        auto next = dims.begin();
+        for (std::size_t i = 0; i != rank_v<A>; ++i) {
+            if (!isPaired(i, true)) {
+                *next++ = a.dimension(static_cast<Index>(i));
+            }
+        }
+        for (std::size_t j = 0; j != rank_v<B>; ++j) {
+            if (!isPaired(j, false)) {
+                *next++ = b.dimension(static_cast<Index>(j));
+            }
+        }
+        return dims;
+    }
+
+    [[nodiscard]] auto isPaired(std::size_t dim, bool first) const -> bool
+    {
+        for (auto const& pair : mPairs) {
+            auto const paired = first ? pair.first : pair.second;
+            if (static_cast<std::size_t>(paired) == dim) {
+                return true;
+            }
+        }
+        return false;
+    }
+
+    // moves the column index behind the free dimensions of Y
+    static auto columnShuffle() -> Dimensions<rank + 1>
+    {
+        constexpr auto xFree = rank_v<ValueType_t<X>> - N;
+        auto shuffle         = Dimensions<rank + 1>();
+        for (std::size_t i = 0; i != rank; ++i) {
+            shuffle[i] = static_cast<Index>(i < xFree ? i : i + 1);
+        }
+        shuffle[rank] = static_cast<Index>(xFree);
+        return shuffle;
+    }
+
+    static auto swapped(Pairs const& pairs) -> Pairs
+    {
+        auto result = Pairs();
+        for (std::size_t i = 0; i != N; ++i) {
+            result[i] = {pairs[i].second, pairs[i].first};
+        }
+        return result;
+    }
+
+    // The gradient of the factor a of the contraction with b.
+    // Contracting the gradient rows with the free dimensions of b leaves
+    // the free dimensions of a followed by its paired ones (in the order of
+    // the paired dimensions of b), which are then shuffled into place.
+    template <bool IsFirst, typename Gradient, typename A, typename B>
+    static auto pullBackFactor(Gradient const& gradient,
+        Dimensions<rank> const& dims, A const& a, B const& b,
+        Pairs const& pairs) -> DenseDerivative
+    {
+        constexpr auto aRank = rank_v<A>;
+        constexpr auto bRank = rank_v<B>;
+        constexpr auto aFree = aRank - N;
+
+        auto aPaired = std::array<bool, aRank>();
+        auto bPaired = std::array<bool, bRank>();
+        for (auto const& pair : pairs) {
+            aPaired[static_cast<std::size_t>(pair.first)]  = true;
+            bPaired[static_cast<std::size_t>(pair.second)] = true;
+        }
+
+        // the free dimensions of b come second in the value iff a is first
+        auto const bOffset = IsFirst ? 1 + aFree : 1;
+        auto gradientPairs = std::array<Eigen::IndexPair<Index>, bRank - N>();
+        for (std::size_t j = 0, k = 0; j != bRank; ++j) {
+            if (!bPaired[j]) {
+                gradientPairs[k] = {static_cast<Index>(bOffset + k),
+                    static_cast<Index>(j)};
+                ++k;
+            }
+        }
+
+        auto shuffle = Dimensions<aRank + 1>();
+        for (std::size_t i = 0, free = 0; i != aRank; ++i) {
+            if (!aPaired[i]) {
+                shuffle[1 + i] = static_cast<Index>(1 + free++);
+            }
+        }
+        for (auto const& pair : pairs) {
+            auto order = std::size_t{0};
+            for (auto const& other : pairs) {
+                order += other.second < pair.second ? 1 : 0;
+            }
+            shuffle[1 + static_cast<std::size_t>(pair.first)]
+                = static_cast<Index>(1 + aFree + order);
+        }
+
+        auto result = DenseDerivative(gradient.rows(), a.size());
+        rowTensor(result, dimensions(a))
+            = rowTensor(gradient, dims)
+                  .contract(b, gradientPairs)
+                  .shuffle(shuffle);
+        return result;
+    }
+
+    Pairs mPairs;
+};
+
+} // namespace AutoDiff::EigenAD::Tensor
+
+namespace AutoDiff {
+
+namespace EigenAD::Tensor {
+
+template <typename X, typename Y, typename Idx, std::size_t N>
+auto makeContraction(
+    X const& x, Y const& y, std::array<Eigen::IndexPair<Idx>, N> const& pairs)
+{
+    using Type      = Contraction<X, Y, N>;
+    auto indexPairs = typename Type::Pairs();
+    for (std::size_t i = 0; i != N; ++i) {
+        indexPairs[i] = {static_cast<Index>(pairs[i].first),
+            static_cast<Index>(pairs[i].second)};
+    }
+    return Type(x, y, indexPairs);
+}
+
+} // namespace EigenAD::Tensor
+
+/**
+ * @brief Contracts two tensors over the given pairs of dimensions.
+ *
+ * One of the tensors may be a literal.
+ */
+template <typename X, typename Y, typename Idx, std::size_t N>
+auto contract(Expression<X> const& x, Expression<Y> const& y,
+    std::array<Eigen::IndexPair<Idx>, N> const& pairs)
+    -> std::enable_if_t<EigenAD::hasTensorValue_v<X>
+                            && EigenAD::hasTensorValue_v<Y>,
+        EigenAD::Tensor::Contraction<X, Y, N>>
+{
+    return EigenAD::Tensor::makeContraction(x.derived(), y.derived(), pairs);
+}
+
+template <typename Scalar, int Rank, typename Index, typename Y, typename Idx,
+    std::size_t N>
+auto contract(Eigen::Tensor<Scalar, Rank, 0, Index> const& x,
+    Expression<Y> const& y, std::array<Eigen::IndexPair<Idx>, N> const& pairs)
+    -> std::enable_if_t<EigenAD::hasTensorValue_v<Y>,
+        EigenAD::Tensor::Contraction<Eigen::Tensor<Scalar, Rank, 0, Index>, Y,
+            N>>
+{
+    return EigenAD::Tensor::makeContraction(x, y.derived(), pairs);
+}
+
+template <typename X, typename Scalar, int Rank, typename Index, typename Idx,
+    std::size_t N>
+auto contract(Expression<X> const& x,
+    Eigen::Tensor<Scalar, Rank, 0, Index> const& y,
+    std::array<Eigen::IndexPair<Idx>, N> const& pairs)
+    -> std::enable_if_t<EigenAD::hasTensorValue_v<X>,
+        EigenAD::Tensor::Contraction<X, Eigen::Tensor<Scalar, Rank, 0, Index>,
+            N>>
+{
+    return EigenAD::Tensor::makeContraction(x.derived(), y, pairs);
+}
+
+} // namespace AutoDiff
+
+#endif // AUTODIFF_SRC_EIGEN_TENSOR_OPS_CONTRACTION_HPP
@@ -0,0 +1,61 @@
+// Copyright (c) 2024 Matthias Krippner
+//
+// This software is released under the MIT License.
+// https://opensource.org/licenses/MIT
+
+#ifndef AUTODIFF_SRC_EIGEN_TENSOR_OPS_DIFFERENCE_HPP
+#define AUTODIFF_SRC_EIGEN_TENSOR_OPS_DIFFERENCE_HPP
+
+namespace AutoDiff::EigenAD::Tensor {
+
+template <typename X, typename Y>
+class Difference : public BinaryOperation<Difference<X, Y>, X, Y> {
+public:
+    using Base = BinaryOperation<Difference<X, Y>, X, Y>;
+    using Base::Base;
+    using typename Base::Derivative;
+    using DenseDerivative = Dense_t<Derivative>;
+
+    [[nodiscard]] auto _valueImpl() -> decltype(auto)
+    {
+        return Base::xValue() - Base::yValue();
+    }
+
+    [[nodiscard]] auto _pushForwardImpl() -> decltype(auto)
+    {
+        if constexpr (!Base::hasOperandX) {
+            return mapColumns(
+                [](auto const& yTangent) { return DenseDerivative(-yTangent); },
+                Base::yPushForward());
+        } else if constexpr (!Base::hasOperandY) {
+            return Base::xPushForward();
+        } else {
+            return mapColumns(
+                [](auto const& xTangent, auto const& yTangent) {
+                    return DenseDerivative(xTangent - yTangent);
+                },
+                Base::xPushForward(), Base::yPushForward());
+        }
+    }
+
+    template <typename OtherDerivative>
+    void _pullBackImpl(OtherDerivative const& derivative)
+    {
+        if constexpr (Base::hasOperandX) {
+            Base::xPullBack(derivative);
+        }
+        if constexpr (Base::hasOperandY) {
+            Base::yPullBack(-derivative);
+        }
+    }
+};
+
+} // namespace AutoDiff::EigenAD::Tensor
+
+namespace AutoDiff {
+
+AUTODIFF_MAKE_TENSOR_TENSOR_OP(operator-, EigenAD::Tensor::Difference)
+
+} // namespace AutoDiff
+
+#endif // AUTODIFF_SRC_EIGEN_TENSOR_OPS_DIFFERENCE_HPP
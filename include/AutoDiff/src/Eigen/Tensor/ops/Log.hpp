@@ -0,0 +1,51 @@
+// Copyright (c) 2024 Matthias Krippner
+//
+// This software is released under the MIT License.
+// https://opensource.org/licenses/MIT
+
+#ifndef AUTODIFF_SRC_EIGEN_TENSOR_OPS_LOG_HPP
+#define AUTODIFF_SRC_EIGEN_TENSOR_OPS_LOG_HPP
+
+namespace AutoDiff::EigenAD::Tensor {
+
+template <typename X>
+class Log : public UnaryOperation<Log<X>, X> {
+public:
+    using Base = UnaryOperation<Log<X>, X>;
+    using Base::Base;
+    using typename Base::Derivative;
+    using DenseDerivative = Dense_t<Derivative>;
+
+    [[nodiscard]] auto _valueImpl() -> decltype(auto)
+    {
+        return Base::xValue().log();
+    }
+
+    [[nodiscard]] auto _pushForwardImpl()
+    {
+        return scaleTangent<DenseDerivative>(xDeriv(), Base::xPushForward());
+    }
+
+    template <typename OtherDerivative>
+    void _pullBackImpl(OtherDerivative const& derivative)
+    {
+        auto const xDeriv = this->xDeriv();
+        Base::xPullBack(derivative * flat(xDeriv).asDiagonal());
+    }
+
+private:
+    [[nodiscard]] auto xDeriv()
+    {
+        return evaluate(promote<Derivative>(Base::xValue()).inverse());
+    }
+};
+
+} // namespace AutoDiff::EigenAD::Tensor
+
+namespace AutoDiff {
+
+AUTODIFF_MAKE_TENSOR_UNARY_OP(log, EigenAD::Tensor::Log)
+
+} // namespace AutoDiff
+
+#endif // AUTODIFF_SRC_EIGEN_TENSOR_OPS_LOG_HPP
@@ -0,0 +1,46 @@
+// Copyright (c) 2024 Matthias Krippner
+//
+// This software is released under the MIT License.
+// https://opensource.org/licenses/MIT
+
+#ifndef AUTODIFF_SRC_EIGEN_TENSOR_OPS_NEGATION_HPP
+#define AUTODIFF_SRC_EIGEN_TENSOR_OPS_NEGATION_HPP
+
+namespace AutoDiff::EigenAD::Tensor {
+
+template <typename X>
+class Negation : public UnaryOperation<Negation<X>, X> {
+public:
+    using Base = UnaryOperation<Negation<X>, X>;
+    using Base::Base;
+    using typename Base::Derivative;
+    using DenseDerivative = Dense_t<Derivative>;
+
+    [[nodiscard]] auto _valueImpl() -> decltype(auto)
+    {
+        return -Base::xValue();
+    }
+
+    [[nodiscard]] auto _pushForwardImpl()
+    {
+        return mapColumns(
+            [](auto const& tangent) { return DenseDerivative(-tangent); },
+            Base::xPushForward());
+    }
+
+    template <typename OtherDerivative>
+    void _pullBackImpl(OtherDerivative const& derivative)
+    {
+        Base::xPullBack(-derivative);
+    }
+};
+
+} // namespace AutoDiff::EigenAD::Tensor
+
+namespace AutoDiff {
+
+AUTODIFF_MAKE_TENSOR_UNARY_OP(operator-, EigenAD::Tensor::Negation)
+
+} // namespace AutoDiff
+
+#endif // AUTODIFF_SRC_EIGEN_TENSOR_OPS_NEGATION_HPP
@@ -0,0 +1,119 @@
+// Copyright (c) 2024 Matthias Krippner
+//
+// This software is released under the MIT License.
+// https://opensource.org/licenses/MIT
+
+#ifndef AUTODIFF_SRC_EIGEN_TENSOR_OPS_PRODUCT_HPP
+#define AUTODIFF_SRC_EIGEN_TENSOR_OPS_PRODUCT_HPP
+
+namespace AutoDiff::EigenAD::Tensor {
+
+template <typename X, typename Y>
+class Product : public BinaryOperation<Product<X, Y>, X, Y> {
+public:
+    using Base = BinaryOperation<Product<X, Y>, X, Y>;
+    using Base::Base;
+    using typename Base::Derivative;
+    using DenseDerivative = Dense_t<Derivative>;
+
+    [[nodiscard]] auto _valueImpl() -> decltype(auto)
+    {
+        return Base::xValue() * Base::yValue();
+    }
+
+    [[nodiscard]] auto _pushForwardImpl()
+    {
+        auto const& xValue = evaluate(promote<Derivative>(Base::xValue()));
+        auto const& yValue = evaluate(promote<Derivative>(Base::yValue()));
+        if constexpr (!Base::hasOperandX) {
+            return scaleTangent<DenseDerivative>(xValue, Base::yPushForward());
+        } else if constexpr (!Base::hasOperandY) {
+            return scaleTangent<DenseDerivative>(yValue, Base::xPushForward());
+        } else {
+            return mapColumns(
+                [&](auto const& xTangent, auto const& yTangent) {
+                    return DenseDerivative(
+                        flat(yValue).asDiagonal() * xTangent
+                        + flat(xValue).asDiagonal() * yTangent);
+                },
+                Base::xPushForward(), Base::yPushForward());
+        }
+    }
+
+    template <typename OtherDerivative>
+    void _pullBackImpl(OtherDerivative const& derivative)
+    {
+        if constexpr (Base::hasOperandX) {
+            auto const& yValue = evaluate(promote<Derivative>(Base::yValue()));
+            Base::xPullBack(derivative * flat(yValue).asDiagonal());
+        }
+        if constexpr (Base::hasOperandY) {
+            auto const& xValue = evaluate(promote<Derivative>(Base::xValue()));
+            Base::yPullBack(derivative * flat(xValue).asDiagonal());
+        }
+    }
+};
+
+template <typename X, typename Y>
+class ProductScalar : public BinaryOperation<ProductScalar<X, Y>, X, Y> {
+public:
+    using Base = BinaryOperation<ProductScalar<X, Y>, X, Y>;
+    using Base::Base;
+    using typename Base::Derivative;
+    using DenseDerivative = Dense_t<Derivative>;
+
+    [[nodiscard]] auto _valueImpl() -> decltype(auto)
+    {
+        return Base::xValue() * Base::yValue();
+    }
+
+    [[nodiscard]] auto _pushForwardImpl()
+    {
+        auto const& xValue = evaluate(promote<Derivative>(Base::xValue()));
+        auto const yValue  = Base::yValue();
+        if constexpr (!Base::hasOperandX) {
+            return mapColumns(
+                [&](auto const& yTangent) {
+                    return DenseDerivative(flat(xValue) * yTangent);
+                },
+                Base::yPushForward());
+        } else if constexpr (!Base::hasOperandY) {
+            return mapColumns(
+                [&](auto const& xTangent) {
+                    return DenseDerivative(xTangent * yValue);
+                },
+                Base::xPushForward());
+        } else {
+            return mapColumns(
+                [&](auto const& xTangent, auto const& yTangent) {
+                    return DenseDerivative(
+                        xTangent * yValue + flat(xValue) * yTangent);
+                },
+                Base::xPushForward(), Base::yPushForward());
+        }
+    }
+
+    template <typename OtherDerivative>
+    void _pullBackImpl(OtherDerivative const& derivative)
+    {
+        if constexpr (Base::hasOperandX) {
+            Base::xPullBack(derivative * Base::yValue());
+        }
+        if constexpr (Base::hasOperandY) {
+            auto const& xValue = evaluate(promote<Derivative>(Base::xValue()));
+            Base::yPullBack(derivative * flat(xValue));
+        }
+    }
+};
+
+} // namespace AutoDiff::EigenAD::Tensor
+
+namespace AutoDiff {
+
+AUTODIFF_MAKE_TENSOR_TENSOR_OP(operator*, EigenAD::Tensor::Product)
+AUTODIFF_MAKE_TENSOR_SCALAR_OP(operator*, EigenAD::Tensor::ProductScalar)
+AUTODIFF_MAKE_SCALAR_TENSOR_OP(operator*, EigenAD::Tensor::ProductScalar)
+
+} // namespace AutoDiff
+
+#endif // AUTODIFF_SRC_EIGEN_TENSOR_OPS_PRODUCT_HPP
@@ -0,0 +1,141 @@
+// Copyright (c) 2024 Matthias Krippner
+//
+// This software is released under the MIT License.
+// https://opensource.org/licenses/MIT
+
+#ifndef AUTODIFF_SRC_EIGEN_TENSOR_OPS_QUOTIENT_HPP
+#define AUTODIFF_SRC_EIGEN_TENSOR_OPS_QUOTIENT_HPP
+
+namespace AutoDiff::EigenAD::Tensor {
+
+template <typename X, typename Y>
+class Quotient : public BinaryOperation<Quotient<X, Y>, X, Y> {
+public:
+    using Base = BinaryOperation<Quotient<X, Y>, X, Y>;
+    using Base::Base;
+    using typename Base::Derivative;
+    using DenseDerivative = Dense_t<Derivative>;
+
+    [[nodiscard]] auto _valueImpl() -> decltype(auto)
+    {
+        return Base::xValue() / Base::yValue();
+    }
+
+    [[nodiscard]] auto _pushForwardImpl()
+    {
+        if constexpr (!Base::hasOperandX) {
+            return scaleTangent<DenseDerivative>(
+                yDeriv(), Base::yPushForward());
+        } else if constexpr (!Base::hasOperandY) {
+            return scaleTangent<DenseDerivative>(
+                xDeriv(), Base::xPushForward());
+        } else {
+            auto const xDeriv = this->xDeriv();
+            auto const yDeriv = this->yDeriv();
+            return mapColumns(
+                [&](auto const& xTangent, auto const& yTangent) {
+                    return DenseDerivative(
+                        flat(xDeriv).asDiagonal() * xTangent
+                        + flat(yDeriv).asDiagonal() * yTangent);
+                },
+                Base::xPushForward(), Base::yPushForward());
+        }
+    }
+
+    template <typename OtherDerivative>
+    void _pullBackImpl(OtherDerivative const& derivative)
+    {
+        if constexpr (Base::hasOperandX) {
+            auto const xDeriv = this->xDeriv();
+            Base::xPullBack(derivative * flat(xDeriv).asDiagonal());
+        }
+        if constexpr (Base::hasOperandY) {
+            auto const yDeriv = this->yDeriv();
+            Base::yPullBack(derivative * flat(yDeriv).asDiagonal());
+        }
+    }
+
+private:
+    [[nodiscard]] auto xDeriv()
+    {
+        return evaluate(promote<Derivative>(Base::yValue()).inverse());
+    }
+
+    [[nodiscard]] auto yDeriv()
+    {
+        return evaluate(-promote<Derivative>(_valueImpl())
+                        / promote<Derivative>(Base::yValue()));
+    }
+};
+
+template <typename X, typename Y>
+class QuotientScalar : public BinaryOperation<QuotientScalar<X, Y>, X, Y> {
+public:
+    using Base = BinaryOperation<QuotientScalar<X, Y>, X, Y>;
+    using Base::Base;
+    using typename Base::Derivative;
+    using DenseDerivative = Dense_t<Derivative>;
+
+    [[nodiscard]] auto _valueImpl() -> decltype(auto)
+    {
+        return Base::xValue() / Base::yValue();
+    }
+
+    [[nodiscard]] auto _pushForwardImpl()
+    {
+        auto const yValue = Base::yValue();
+        if constexpr (!Base::hasOperandX) {
+            auto const yDeriv = this->yDeriv();
+            return mapColumns(
+                [&](auto const& yTangent) {
+                    return DenseDerivative(flat(yDeriv) * yTangent);
+                },
+                Base::yPushForward());
+        } else if constexpr (!Base::hasOperandY) {
+            return mapColumns(
+                [&](auto const& xTangent) {
+                    return DenseDerivative(xTangent / yValue);
+                },
+                Base::xPushForward());
+        } else {
+            auto const yDeriv = this->yDeriv();
+            return mapColumns(
+                [&](auto const& xTangent, auto const& yTangent) {
+                    return DenseDerivative(
+                        xTangent / yValue + flat(yDeriv) * yTangent);
+                },
+                Base::xPushForward(), Base::yPushForward());
+        }
+    }
+
+    template <typename OtherDerivative>
+    void _pullBackImpl(OtherDerivative const& derivative)
+    {
+        if constexpr (Base::hasOperandX) {
+            Base::xPullBack(derivative / Base::yValue());
+        }
+        if constexpr (Base::hasOperandY) {
+            auto const yDeriv = this->yDeriv();
+            Base::yPullBack(derivative * flat(yDeriv));
+        }
+    }
+
+private:
+    [[nodiscard]] auto yDeriv()
+    {
+        using Scalar = typename Derivative::Scalar;
+        auto const yValue = static_cast<Scalar>(Base::yValue());
+        return evaluate(promote<Derivative>(_valueImpl()) / -yValue);
+    }
+};
+
+} // namespace AutoDiff::EigenAD::Tensor
+
+namespace AutoDiff {
+
+AUTODIFF_MAKE_TENSOR_TENSOR_OP(operator/, EigenAD::Tensor::Quotient)
+AUTODIFF_MAKE_TENSOR_SCALAR_OP(operator/, EigenAD::Tensor::QuotientScalar)
+
+} // namespace AutoDiff
+
+#endif // AUTODIFF_SRC_EIGEN_TENSOR_OPS_QUOTIENT_HPP
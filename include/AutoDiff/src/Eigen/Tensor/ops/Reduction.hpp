@@ -0,0 +1,145 @@
+// Copyright (c) 2024 Matthias Krippner
+//
+// This software is released under the MIT License.
+// https://opensource.org/licenses/MIT
+
+#ifndef AUTODIFF_SRC_EIGEN_TENSOR_OPS_REDUCTION_HPP
+#define AUTODIFF_SRC_EIGEN_TENSOR_OPS_REDUCTION_HPP
+
+namespace AutoDiff::EigenAD::Tensor {
+
+/**
+ * @brief Sum or mean over the given dimensions of a tensor.
+ *
+ * The gradient is broadcast back along the reduced dimensions.
+ */
+template <typename X, std::size_t N, bool IsMean>
+class Reduction : public UnaryOperation<Reduction<X, N, IsMean>, X> {
+public:
+    using Base = UnaryOperation<Reduction<X, N, IsMean>, X>;
+    using typename Base::Derivative;
+    using DenseDerivative = Dense_t<Derivative>;
+    using Axes            = Dimensions<N>;
+
+    Reduction(Expression<X> const& x, Axes const& axes)
+        : Base(x), mAxes{axes}
+    {
+    }
+
+    [[nodiscard]] auto _valueImpl() -> decltype(auto)
+    {
+        if constexpr (IsMean) {
+            return Base::xValue().mean(mAxes);
+        } else {
+            return Base::xValue().sum(mAxes);
+        }
+    }
+
+    [[nodiscard]] auto _pushForwardImpl()
+    {
+        auto const xDims = dimensions(evaluate(Base::xValue()));
+        auto const dims  = valueDimensions(xDims);
+        auto const size  = flatSize(dims);
+        return mapColumns(
+            [&](auto const& tangent) {
+                auto const& xTangent = tangent.eval();
+                auto result = DenseDerivative(size, xTangent.cols());
+                if constexpr (IsMean) {
+                    columnTensor(result, dims)
+                        = columnTensor(xTangent, xDims).mean(mAxes);
+                } else {
+                    columnTensor(result, dims)
+                        = columnTensor(xTangent, xDims).sum(mAxes);
+                }
+                return result;
+            },
+            Base::xPushForward());
+    }
+
+    template <typename OtherDerivative>
+    void _pullBackImpl(OtherDerivative const& derivative)
+    {
+        using Scalar     = typename DenseDerivative::Scalar;
+        auto const xDims = dimensions(evaluate(Base::xValue()));
+
+        // keep the reduced dimensions (with size 1) to broadcast along them
+        auto shape   = prepend(0, xDims);
+        auto factors = Dimensions<rank + 1>();
+        factors.fill(1);
+        auto count = Index{1};
+        for (auto const axis : mAxes) {
+            auto const i   = static_cast<std::size_t>(axis);
+            shape[1 + i]   = 1;
+            factors[1 + i] = xDims[i];
+            count *= xDims[i];
+        }
+        auto const scale
+            = IsMean ? Scalar(1) / static_cast<Scalar>(count) : Scalar(1);
+
+        Base::xPullBack(mapRows(
+            [&](auto const& gradient) {
+                auto const& rows = gradient.eval();
+                auto result = DenseDerivative(rows.rows(), flatSize(xDims));
+                shape[0]    = rows.rows();
+                rowTensor(result, xDims)
+                    = ConstTensorMap<Scalar, rank + 1>(rows.data(), shape)
+                          .broadcast(factors)
+                      * scale;
+                return result;
+            },
+            derivative));
+    }
+
+private:
+    static constexpr auto rank = rank_v<ValueType_t<X>>;
+
+    [[nodiscard]] auto valueDimensions(Dimensions<rank> const& xDims) const
+        -> Dimensions<rank - N>
+    {
+        auto dims = Dimensions<rank - N>();
+        auto next = dims.begin();
+        for (std::size_t i = 0; i != rank; ++i) {
+            if (std::find(mAxes.begin(), mAxes.end(), static_cast<Index>(i))
+                == mAxes.end()) {
+                *next++ = xDims[i];
+            }
+        }
+        return dims;
+    }
+
+    Axes mAxes;
+};
+
+} // namespace AutoDiff::EigenAD::Tensor
+
+namespace AutoDiff {
+
+/**
+ * @brief Sums a tensor over the given dimensions.
+ */
+template <typename X, typename Idx, std::size_t N>
+auto sum(Expression<X> const& x, std::array<Idx, N> const& axes)
+    -> std::enable_if_t<EigenAD::hasTensorValue_v<X>,
+        EigenAD::Tensor::Reduction<X, N, false>>
+{
+    auto dims = EigenAD::Tensor::Dimensions<N>();
+    std::copy(axes.begin(), axes.end(), dims.begin());
+    return EigenAD::Tensor::Reduction<X, N, false>(x, dims);
+}
+
+/**
+ * @brief Averages a tensor over the given dimensions.
+ */
+template <typename X, typename Idx, std::size_t N>
+auto mean(Expression<X> const& x, std::array<Idx, N> const& axes)
+    -> std::enable_if_t<EigenAD::hasTensorValue_v<X>,
+        EigenAD::Tensor::Reduction<X, N, true>>
+{
+    auto dims = EigenAD::Tensor::Dimensions<N>();
+    std::copy(axes.begin(), axes.end(), dims.begin());
+    return EigenAD::Tensor::Reduction<X, N, true>(x, dims);
+}
+
+} // namespace AutoDiff
+
+#endif // AUTODIFF_SRC_EIGEN_TENSOR_OPS_REDUCTION_HPP
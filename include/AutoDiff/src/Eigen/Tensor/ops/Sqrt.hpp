@@ -0,0 +1,53 @@
+// Copyright (c) 2024 Matthias Krippner
+//
+// This software is released under the MIT License.
+// https://opensource.org/licenses/MIT
+
+#ifndef AUTODIFF_SRC_EIGEN_TENSOR_OPS_SQRT_HPP
+#define AUTODIFF_SRC_EIGEN_TENSOR_OPS_SQRT_HPP
+
+namespace AutoDiff::EigenAD::Tensor {
+
+template <typename X>
+class Sqrt : public UnaryOperation<Sqrt<X>, X> {
+public:
+    using Base = UnaryOperation<Sqrt<X>, X>;
+    using Base::Base;
+    using typename Base::Derivative;
+    using DenseDerivative = Dense_t<Derivative>;
+
+    [[nodiscard]] auto _valueImpl() -> decltype(auto)
+    {
+        return Base::xValue().sqrt();
+    }
+
+    [[nodiscard]] auto _pushForwardImpl()
+    {
+        return scaleTangent<DenseDerivative>(xDeriv(), Base::xPushForward());
+    }
+
+    template <typename OtherDerivative>
+    void _pullBackImpl(OtherDerivative const& derivative)
+    {
+        auto const xDeriv = this->xDeriv();
+        Base::xPullBack(derivative * flat(xDeriv).asDiagonal());
+    }
+
+private:
+    [[nodiscard]] auto xDeriv()
+    {
+        using Scalar = typename Derivative::Scalar;
+        return evaluate(
+            promote<Derivative>(_valueImpl()).inverse() * Scalar(0.5));
+    }
+};
+
+} // namespace AutoDiff::EigenAD::Tensor
+
+namespace AutoDiff {
+
+AUTODIFF_MAKE_TENSOR_UNARY_OP(sqrt, EigenAD::Tensor::Sqrt)
+
+} // namespace AutoDiff
+
+#endif // AUTODIFF_SRC_EIGEN_TENSOR_OPS_SQRT_HPP
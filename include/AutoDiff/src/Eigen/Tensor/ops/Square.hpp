@@ -0,0 +1,52 @@
+// Copyright (c) 2024 Matthias Krippner
+//
+// This software is released under the MIT License.
+// https://opensource.org/licenses/MIT
+
+#ifndef AUTODIFF_SRC_EIGEN_TENSOR_OPS_SQUARE_HPP
+#define AUTODIFF_SRC_EIGEN_TENSOR_OPS_SQUARE_HPP
+
+namespace AutoDiff::EigenAD::Tensor {
+
+template <typename X>
+class Square : public UnaryOperation<Square<X>, X> {
+public:
+    using Base = UnaryOperation<Square<X>, X>;
+    using Base::Base;
+    using typename Base::Derivative;
+    using DenseDerivative = Dense_t<Derivative>;
+
+    [[nodiscard]] auto _valueImpl() -> decltype(auto)
+    {
+        return Base::xValue().square();
+    }
+
+    [[nodiscard]] auto _pushForwardImpl()
+    {
+        return scaleTangent<DenseDerivative>(xDeriv(), Base::xPushForward());
+    }
+
+    template <typename OtherDerivative>
+    void _pullBackImpl(OtherDerivative const& derivative)
+    {
+        auto const xDeriv = this->xDeriv();
+        Base::xPullBack(derivative * flat(xDeriv).asDiagonal());
+    }
+
+private:
+    [[nodiscard]] auto xDeriv()
+    {
+        using Scalar = typename Derivative::Scalar;
+        return evaluate(promote<Derivative>(Base::xValue()) * Scalar(2));
+    }
+};
+
+} // namespace AutoDiff::EigenAD::Tensor
+
+namespace AutoDiff {
+
+AUTODIFF_MAKE_TENSOR_UNARY_OP(square, EigenAD::Tensor::Square)
+
+} // namespace AutoDiff
+
+#endif // AUTODIFF_SRC_EIGEN_TENSOR_OPS_SQUARE_HPP
@@ -0,0 +1,51 @@
+// Copyright (c) 2024 Matthias Krippner
+//
+// This software is released under the MIT License.
+// https://opensource.org/licenses/MIT
+
+#ifndef AUTODIFF_SRC_EIGEN_TENSOR_OPS_TOTAL_HPP
+#define AUTODIFF_SRC_EIGEN_TENSOR_OPS_TOTAL_HPP
+
+namespace AutoDiff::EigenAD::Tensor {
+
+template <typename X>
+class Total : public UnaryOperation<Total<X>, X> {
+public:
+    using Base = UnaryOperation<Total<X>, X>;
+    using Base::Base;
+    using typename Base::Derivative;
+    using DenseDerivative = Dense_t<Derivative>;
+
+    // the sum of all coefficients is a scalar, not a tensor of rank 0
+    [[nodiscard]] auto _valueImpl()
+    {
+        return evaluate(Base::xValue().sum())();
+    }
+
+    // evaluated, since the tangent of the operand may be a temporary
+    [[nodiscard]] auto _pushForwardImpl()
+    {
+        return mapColumns(
+            [](auto const& tangent) {
+                return DenseDerivative(tangent.colwise().sum());
+            },
+            Base::xPushForward());
+    }
+
+    template <typename OtherDerivative>
+    void _pullBackImpl(OtherDerivative const& derivative)
+    {
+        auto const size = evaluate(Base::xValue()).size();
+        Base::xPullBack(replicateCol(derivative, size));
+    }
+};
+
+} // namespace AutoDiff::EigenAD::Tensor
+
+namespace AutoDiff {
+
+AUTODIFF_MAKE_TENSOR_UNARY_OP(total, EigenAD::Tensor::Total)
+
+} // namespace AutoDiff
+
+#endif // AUTODIFF_SRC_EIGEN_TENSOR_OPS_TOTAL_HPP
@@ -0,0 +1,747 @@
+// Copyright (c) 2024 Matthias Krippner
+//
+// This software is released under the MIT License.
+// https://opensource.org/licenses/MIT
+
+/**
+ * @file derivatives.hpp
+ * @brief Helpers for operations on dense, structured and sparse derivatives.
+ *
+ * Operations compose derivatives with Eigen expressions.
+ * Where an operation needs more than the arithmetic that all derivative types
+ * support (e.g., slicing or broadcasting), it uses these helpers.
+ */
+
+#ifndef AUTODIFF_SRC_EIGEN_DERIVATIVES_HPP
+#define AUTODIFF_SRC_EIGEN_DERIVATIVES_HPP
+
+#include "StructuredMatrix.hpp"
+#include "traits.hpp" // isPlain isScalar isSparse
+
+#include <algorithm>   // sort
+#include <cstddef>     // ptrdiff_t size_t
+#include <tuple>       // tuple tuple_element
+#include <type_traits> // conditional decay enable_if is_lvalue_reference
+#include <utility>     // forward
+#include <vector>
+
+// forward-declare Eigen types
+
+namespace Eigen {
+
+template <typename NullaryOp, typename PlainObjectType>
+class CwiseNullaryOp;
+
+template <typename Scalar_, int Options_, typename StorageIndex_>
+class SparseMatrix;
+
+} // namespace Eigen
+
+namespace AutoDiff::EigenAD {
+
+/**
+ * @brief The dense type of a derivative.
+ *
+ * Operations that compute dense derivatives (e.g., matrix products)
+ * store them in this type.
+ */
+template <typename Derivative, typename = void>
+struct Dense {
+    using type = Derivative;
+};
+
+template <typename Scalar>
+struct Dense<StructuredMatrix<Scalar>> {
+    using type = typename StructuredMatrix<Scalar>::DenseMatrix;
+};
+
+template <typename Sparse>
+struct Dense<Sparse, std::enable_if_t<isSparse_v<Sparse>>> {
+    using type = Eigen::Matrix<typename Sparse::Scalar, -1, -1, 0, -1, -1>;
+};
+
+template <typename Derivative>
+using Dense_t = typename Dense<Derivative>::type;
+
+/**
+ * @brief Converts a derivative for operations that need dense coefficients.
+ *
+ * Eigen expressions are returned unchanged (rvalues by value).
+ */
+template <typename T>
+auto densify(T&& derivative)
+    -> std::enable_if_t<!isStructured_v<std::decay_t<T>>, T>
+{
+    return std::forward<T>(derivative);
+}
+
+template <typename Scalar>
+auto densify(StructuredMatrix<Scalar> const& derivative) ->
+    typename StructuredMatrix<Scalar>::DenseMatrix
+{
+    return derivative.toDense();
+}
+
+/**
+ * @brief The dense gradient of an output of a multi-output operation.
+ *
+ * Outputs without gradient (null) yield an empty matrix.
+ */
+template <typename Derivative>
+auto denseGradient(Derivative const* gradient) -> Dense_t<Derivative>
+{
+    if (gradient == nullptr) {
+        return {};
+    }
+    return Dense_t<Derivative>(densify(*gradient));
+}
+
+/**
+ * @brief Converts a value to the scalar type of the derivative.
+ *
+ * Values may be stored in lower precision than their derivatives
+ * (e.g., float values with double gradients).
+ * Values of the same precision and scalar values, which Eigen converts itself,
+ * are returned unchanged (rvalues by value).
+ */
+template <typename Derivative, typename T>
+auto promote(T&& value) -> decltype(auto)
+{
+    using Value = std::decay_t<T>;
+    if constexpr (isScalar_v<Value>) {
+        return static_cast<T>(value);
+    } else if constexpr (std::is_same_v<typename Value::Scalar,
+                             typename Derivative::Scalar>) {
+        return static_cast<T>(value);
+    } else {
+        return value.template cast<typename Derivative::Scalar>();
+    }
+}
+
+namespace detail {
+
+    // reads the coefficients of a matrix in column-major order,
+    // the order of reshaped()
+    template <typename Coefficients>
+    struct LinearCoefficients {
+        Coefficients coefficients;
+
+        auto operator()(std::ptrdiff_t i) const ->
+            typename std::decay_t<Coefficients>::Scalar
+        {
+            auto const rows = coefficients.rows();
+            return coefficients.coeff(i % rows, i / rows);
+        }
+    };
+
+} // namespace detail
+
+/**
+ * @brief The diagonal matrix of the (flattened) coefficients of a matrix,
+ * for coefficient-wise derivatives.
+ *
+ * Eigen's sparse-diagonal products keep references into the diagonal
+ * expression, which must not be a lazy reshaped view of a temporary.
+ * For sparse derivatives, the returned expression therefore holds the
+ * coefficients itself: rvalue expressions by value, lvalues by reference.
+ * The coefficients are read lazily, without allocating a vector.
+ */
+template <typename Derivative, typename Coefficients>
+auto asDiagonal(Coefficients&& coefficients)
+{
+    if constexpr (isSparse_v<Derivative>) {
+        using Matrix = std::decay_t<Coefficients>;
+        using Stored
+            = std::conditional_t<std::is_lvalue_reference_v<Coefficients>,
+                Matrix const&, Matrix>;
+        using Vector = Eigen::Matrix<typename Matrix::Scalar, -1, 1, 0, -1, 1>;
+        auto const size = coefficients.size();
+        return Vector::NullaryExpr(size,
+            detail::LinearCoefficients<Stored>{
+                std::forward<Coefficients>(coefficients)})
+            .asDiagonal();
+    } else {
+        return coefficients.reshaped().asDiagonal();
+    }
+}
+
+namespace detail {
+
+    using Index = std::ptrdiff_t;
+
+    template <typename Scalar>
+    using SparseColMajor = Eigen::SparseMatrix<Scalar, 0, int>;
+
+    // Sparse results keep the storage order of the derivative (row-major for
+    // row-sparse gradients), since sums require the same storage order.
+    template <typename Derivative>
+    using SparseLike = Eigen::SparseMatrix<typename Derivative::Scalar,
+        Derivative::IsRowMajor ? 1 : 0, int>;
+
+    template <typename Scalar>
+    using DenseMatrix = Eigen::Matrix<Scalar, -1, -1, 0, -1, -1>;
+
+    template <typename Scalar>
+    auto hasNonZeros(SparseColMajor<Scalar> const& matrix, Index col) -> bool
+    {
+        return static_cast<bool>(
+            typename SparseColMajor<Scalar>::InnerIterator(matrix, col));
+    }
+
+    // the given columns of a sparse matrix as dense matrix
+    template <typename Scalar>
+    auto compressColumns(SparseColMajor<Scalar> const& matrix,
+        std::vector<Index> const& columns) -> DenseMatrix<Scalar>
+    {
+        auto const size = static_cast<Index>(columns.size());
+        DenseMatrix<Scalar> result
+            = DenseMatrix<Scalar>::Zero(matrix.rows(), size);
+        for (Index k = 0; k != size; ++k) {
+            typename SparseColMajor<Scalar>::InnerIterator it(
+                matrix, columns[k]);
+            for (; it; ++it) {
+                result(it.row(), k) = it.value();
+            }
+        }
+        return result;
+    }
+
+    // inverse of compressColumns
+    template <typename Scalar>
+    auto expandColumns(DenseMatrix<Scalar> const& compressed,
+        std::vector<Index> const& columns,
+        Index cols) -> SparseColMajor<Scalar>
+    {
+        SparseColMajor<Scalar> result(compressed.rows(), cols);
+        result.reserve(compressed.size());
+        std::size_t k = 0;
+        for (Index j = 0; j != cols; ++j) {
+            result.startVec(j);
+            if (k != columns.size() && columns[k] == j) {
+                for (Index i = 0; i != compressed.rows(); ++i) {
+                    if (compressed(i, k) != Scalar(0)) {
+                        result.insertBack(i, j) = compressed(i, k);
+                    }
+                }
+                ++k;
+            }
+        }
+        result.finalize();
+        return result;
+    }
+
+    template <typename Scalar>
+    auto nonZeroRows(SparseColMajor<Scalar> const& matrix) -> std::vector<Index>
+    {
+        auto isNonZero = std::vector<bool>(matrix.rows(), false);
+        for (Index j = 0; j != matrix.cols(); ++j) {
+            typename SparseColMajor<Scalar>::InnerIterator it(matrix, j);
+            for (; it; ++it) {
+                isNonZero[it.row()] = true;
+            }
+        }
+        auto rows = std::vector<Index>();
+        for (Index i = 0; i != matrix.rows(); ++i) {
+            if (isNonZero[i]) {
+                rows.push_back(i);
+            }
+        }
+        return rows;
+    }
+
+    // the given rows of a sparse matrix as dense matrix
+    template <typename Scalar>
+    auto compressRows(SparseColMajor<Scalar> const& matrix,
+        std::vector<Index> const& rows) -> DenseMatrix<Scalar>
+    {
+        auto position = std::vector<Index>(matrix.rows(), -1);
+        for (std::size_t k = 0; k != rows.size(); ++k) {
+            position[rows[k]] = static_cast<Index>(k);
+        }
+        DenseMatrix<Scalar> result = DenseMatrix<Scalar>::Zero(
+            static_cast<Index>(rows.size()), matrix.cols());
+        for (Index j = 0; j != matrix.cols(); ++j) {
+            typename SparseColMajor<Scalar>::InnerIterator it(matrix, j);
+            for (; it; ++it) {
+                result(position[it.row()], j) = it.value();
+            }
+        }
+        return result;
+    }
+
+    // inverse of compressRows
+    template <typename Scalar>
+    auto expandRows(DenseMatrix<Scalar> const& compressed,
+        std::vector<Index> const& rows,
+        Index numRows) -> SparseColMajor<Scalar>
+    {
+        SparseColMajor<Scalar> result(numRows, compressed.cols());
+        result.reserve(compressed.size());
+        for (Index j = 0; j != compressed.cols(); ++j) {
+            result.startVec(j);
+            for (std::size_t k = 0; k != rows.size(); ++k) {
+                auto const value = compressed(static_cast<Index>(k), j);
+                if (value != Scalar(0)) {
+                    result.insertBack(rows[k], j) = value;
+                }
+            }
+        }
+        result.finalize();
+        return result;
+    }
+
+    template <typename Scalar>
+    auto ones(Index rows, Index cols) -> SparseColMajor<Scalar>
+    {
+        return DenseMatrix<Scalar>::Ones(rows, cols).sparseView();
+    }
+
+    template <typename Map, typename Scalar, typename... Others>
+    auto mapSparseColumns(Map const& map, SparseColMajor<Scalar> const& first,
+        Others const&... others) -> SparseColMajor<Scalar>
+    {
+        auto columns = std::vector<Index>();
+        for (Index j = 0; j != first.cols(); ++j) {
+            if (hasNonZeros(first, j) || (hasNonZeros(others, j) || ...)) {
+                columns.push_back(j);
+            }
+        }
+        DenseMatrix<Scalar> const compressed
+            = map(compressColumns(first, columns),
+                compressColumns(others, columns)...);
+        return expandColumns(compressed, columns, first.cols());
+    }
+
+} // namespace detail
+
+/**
+ * @brief Applies a linear map to derivatives column by column.
+ *
+ * The map is implemented for dense derivatives, which it receives
+ * (one per argument) with the same number of columns,
+ * and must return an evaluated dense matrix.
+ * For sparse derivatives, the map is only applied to the columns
+ * with nonzero coefficients, and the result is sparse.
+ * This suits pushforwards, which map the tangent columns independently.
+ *
+ * @param  map             the linear map
+ * @param  derivatives     the derivatives with the same number of columns
+ */
+template <typename Map, typename... Derivatives>
+auto mapColumns(Map const& map, Derivatives const&... derivatives)
+{
+    if constexpr ((isSparse_v<Derivatives> || ...)) {
+        using First = std::tuple_element_t<0, std::tuple<Derivatives...>>;
+        return detail::SparseLike<First>(detail::mapSparseColumns(map,
+            detail::SparseColMajor<typename Derivatives::Scalar>(
+                derivatives)...));
+    } else {
+        return map(densify(derivatives)...);
+    }
+}
+
+/**
+ * @brief Applies a linear map to a derivative row by row.
+ *
+ * Like @c mapColumns, but for pullbacks, which map the gradient rows
+ * independently.
+ * For a sparse derivative, the map is only applied to the rows with nonzero
+ * coefficients.
+ *
+ * @param  map             the linear map
+ * @param  derivative      the derivative
+ */
+template <typename Map, typename Derivative>
+auto mapRows(Map const& map, Derivative const& derivative)
+{
+    if constexpr (isSparse_v<Derivative>) {
+        using Scalar      = typename Derivative::Scalar;
+        auto const matrix = detail::SparseColMajor<Scalar>(derivative);
+        auto const rows   = detail::nonZeroRows(matrix);
+        detail::DenseMatrix<Scalar> const compressed
+            = map(detail::compressRows(matrix, rows));
+        return detail::SparseLike<Derivative>(
+            detail::expandRows(compressed, rows, matrix.rows()));
+    } else {
+        return map(densify(derivative));
+    }
+}
+
+// Broadcasting ================================================================
+
+/**
+ * @brief Replicates a derivative with one row @p factor times.
+ */
+template <typename Derivative>
+auto replicateRow(
+    Derivative const& derivative, std::ptrdiff_t factor) -> decltype(auto)
+{
+    if constexpr (isSparse_v<Derivative>) {
+        using Scalar = typename Derivative::Scalar;
+        auto const ones = detail::ones<Scalar>(factor, 1);
+        return detail::SparseLike<Derivative>(ones * derivative);
+    } else {
+        return derivative.replicate(factor, 1);
+    }
+}
+
+/**
+ * @brief Replicates a derivative with one column @p factor times.
+ */
+template <typename Derivative>
+auto replicateCol(
+    Derivative const& derivative, std::ptrdiff_t factor) -> decltype(auto)
+{
+    if constexpr (isSparse_v<Derivative>) {
+        using Scalar = typename Derivative::Scalar;
+        auto const ones = detail::ones<Scalar>(1, factor);
+        return detail::SparseLike<Derivative>(derivative * ones);
+    } else {
+        return derivative.replicate(1, factor);
+    }
+}
+
+/**
+ * @brief Adds a derivative with one row to each row of another derivative.
+ */
+template <typename Derivative, typename Row>
+auto addToRows(Derivative const& derivative, Row const& row) -> decltype(auto)
+{
+    if constexpr (isSparse_v<Derivative>) {
+        return detail::SparseLike<Derivative>(
+            derivative + replicateRow(row, derivative.rows()));
+    } else {
+        return derivative.rowwise() + row.row(0);
+    }
+}
+
+/**
+ * @brief Subtracts a derivative with one row from each row of another
+ * derivative.
+ */
+template <typename Derivative, typename Row>
+auto subtractFromRows(
+    Derivative const& derivative, Row const& row) -> decltype(auto)
+{
+    if constexpr (isSparse_v<Derivative>) {
+        return detail::SparseLike<Derivative>(
+            derivative - replicateRow(row, derivative.rows()));
+    } else {
+        return derivative.rowwise() - row.row(0);
+    }
+}
+
+/**
+ * @brief The sum of the columns of a derivative (the sum of each row).
+ */
+template <typename Derivative>
+auto sumColumns(Derivative const& derivative) -> decltype(auto)
+{
+    if constexpr (isSparse_v<Derivative>) {
+        using Scalar = typename Derivative::Scalar;
+        auto const ones = detail::ones<Scalar>(derivative.cols(), 1);
+        return detail::SparseLike<Derivative>(derivative * ones);
+    } else {
+        return derivative.rowwise().sum();
+    }
+}
+
+/**
+ * @brief The sum of the rows of a derivative (the sum of each column).
+ */
+template <typename Derivative>
+auto sumRows(Derivative const& derivative) -> decltype(auto)
+{
+    if constexpr (isSparse_v<Derivative>) {
+        using Scalar = typename Derivative::Scalar;
+        auto const ones = detail::ones<Scalar>(1, derivative.rows());
+        return detail::SparseLike<Derivative>(ones * derivative);
+    } else {
+        return derivative.colwise().sum();
+    }
+}
+
+/**
+ * @brief The average of the rows of a derivative (the mean of each column).
+ */
+template <typename Derivative>
+auto averageRows(Derivative const& derivative) -> decltype(auto)
+{
+    if constexpr (isSparse_v<Derivative>) {
+        auto result = sumRows(derivative);
+        result /= static_cast<typename Derivative::Scalar>(derivative.rows());
+        return result;
+    } else {
+        return derivative.colwise().mean();
+    }
+}
+
+// Indexing ====================================================================
+
+/**
+ * @brief The flat indices of the coefficients in the given rows of a matrix
+ * with @p rows rows and @p cols columns.
+ *
+ * The coefficients are listed in column-major order of the selected rows
+ * (e.g., of a gathered matrix).
+ */
+inline auto rowCoefficients(std::vector<std::ptrdiff_t> const& indices,
+    std::ptrdiff_t rows, std::ptrdiff_t cols) -> std::vector<std::ptrdiff_t>
+{
+    auto coefficients = std::vector<std::ptrdiff_t>();
+    coefficients.reserve(indices.size() * static_cast<std::size_t>(cols));
+    for (std::ptrdiff_t j = 0; j != cols; ++j) {
+        for (auto const index : indices) {
+            coefficients.push_back(index + j * rows);
+        }
+    }
+    return coefficients;
+}
+
+/**
+ * @brief Selects rows of a derivative: row @c k of the result is row
+ * @p rows[k] of the derivative.
+ */
+template <typename Derivative>
+auto gatherRows(
+    Derivative const& derivative, std::vector<std::ptrdiff_t> const& rows)
+{
+    return mapColumns(
+        [&](auto const& tangent) {
+            using Scalar = typename std::decay_t<decltype(tangent)>::Scalar;
+            auto result  = detail::DenseMatrix<Scalar>(
+                static_cast<std::ptrdiff_t>(rows.size()), tangent.cols());
+            for (std::size_t k = 0; k != rows.size(); ++k) {
+                result.row(static_cast<std::ptrdiff_t>(k))
+                    = tangent.row(rows[k]);
+            }
+            return result;
+        },
+        derivative);
+}
+
+/**
+ * @brief Sums the rows of a derivative into a derivative with @p size rows:
+ * row @c k is added to row @p rows[k] of the result.
+ */
+template <typename Derivative>
+auto scatterRows(Derivative const& derivative,
+    std::vector<std::ptrdiff_t> const& rows, std::ptrdiff_t size)
+{
+    return mapColumns(
+        [&](auto const& tangent) {
+            using Scalar = typename std::decay_t<decltype(tangent)>::Scalar;
+            detail::DenseMatrix<Scalar> result
+                = detail::DenseMatrix<Scalar>::Zero(size, tangent.cols());
+            for (std::size_t k = 0; k != rows.size(); ++k) {
+                result.row(rows[k])
+                    += tangent.row(static_cast<std::ptrdiff_t>(k));
+            }
+            return result;
+        },
+        derivative);
+}
+
+/**
+ * @brief Selects columns of a gradient: column @c k of the result is column
+ * @p columns[k] of the gradient.
+ */
+template <typename Derivative>
+auto gatherColumns(
+    Derivative const& gradient, std::vector<std::ptrdiff_t> const& columns)
+{
+    return mapRows(
+        [&](auto const& dense) {
+            using Scalar = typename std::decay_t<decltype(dense)>::Scalar;
+            auto result  = detail::DenseMatrix<Scalar>(
+                dense.rows(), static_cast<std::ptrdiff_t>(columns.size()));
+            for (std::size_t k = 0; k != columns.size(); ++k) {
+                result.col(static_cast<std::ptrdiff_t>(k))
+                    = dense.col(columns[k]);
+            }
+            return result;
+        },
+        gradient);
+}
+
+/**
+ * @brief Sums the columns of a gradient into a gradient of type @p Derivative
+ * with @p size columns: column @c k is added to column @p columns[k].
+ *
+ * For sparse derivatives, the result is assembled from the nonzero
+ * coefficients of the gradient only. Its cost is independent of @p size
+ * for row-major storage, such that the gradient of a few rows of a large
+ * matrix (e.g., an embedding table) is never stored densely.
+ */
+template <typename Derivative, typename Gradient>
+auto scatterColumns(Gradient const& gradient,
+    std::vector<std::ptrdiff_t> const& columns, std::ptrdiff_t size)
+{
+    if constexpr (isSparse_v<Derivative>) {
+        using Scalar = typename Derivative::Scalar;
+        using Index  = std::ptrdiff_t;
+        struct Entry {
+            Index outer;
+            Index inner;
+            Scalar value;
+        };
+        auto entries  = std::vector<Entry>();
+        auto const add = [&](Index row, Index col, Scalar value) {
+            if constexpr (Derivative::IsRowMajor) {
+                entries.push_back({row, columns[col], value});
+            } else {
+                entries.push_back({columns[col], row, value});
+            }
+        };
+        if constexpr (isSparse_v<Gradient>) {
+            auto const matrix = detail::SparseColMajor<Scalar>(gradient);
+            for (Index j = 0; j != matrix.cols(); ++j) {
+                typename detail::SparseColMajor<Scalar>::InnerIterator it(
+                    matrix, j);
+                for (; it; ++it) {
+                    add(it.row(), j, it.value());
+                }
+            }
+        } else {
+            detail::DenseMatrix<Scalar> const matrix = densify(gradient);
+            for (Index j = 0; j != matrix.cols(); ++j) {
+                for (Index i = 0; i != matrix.rows(); ++i) {
+                    if (matrix(i, j) != Scalar(0)) {
+                        add(i, j, matrix(i, j));
+                    }
+                }
+            }
+        }
+        std::sort(entries.begin(), entries.end(),
+            [](Entry const& a, Entry const& b) {
+                return a.outer < b.outer
+                    || (a.outer == b.outer && a.inner < b.inner);
+            });
+
+        auto result = Derivative(gradient.rows(), size);
+        result.reserve(static_cast<Index>(entries.size()));
+        std::size_t k = 0;
+        for (Index outer = 0; outer != result.outerSize(); ++outer) {
+            result.startVec(outer);
+            while (k != entries.size() && entries[k].outer == outer) {
+                // duplicate columns are summed
+                auto const inner = entries[k].inner;
+                auto sum         = Scalar(0);
+                for (; k != entries.size() && entries[k].outer == outer
+                       && entries[k].inner == inner;
+                     ++k) {
+                    sum += entries[k].value;
+                }
+                if constexpr (Derivative::IsRowMajor) {
+                    result.insertBack(outer, inner) = sum;
+                } else {
+                    result.insertBack(inner, outer) = sum;
+                }
+            }
+        }
+        result.finalize();
+        return result;
+    } else {
+        return mapRows(
+            [&](auto const& dense) {
+                using Scalar = typename std::decay_t<decltype(dense)>::Scalar;
+                detail::DenseMatrix<Scalar> result
+                    = detail::DenseMatrix<Scalar>::Zero(dense.rows(), size);
+                for (std::size_t k = 0; k != columns.size(); ++k) {
+                    result.col(columns[k])
+                        += dense.col(static_cast<std::ptrdiff_t>(k));
+                }
+                return result;
+            },
+            gradient);
+    }
+}
+
+namespace detail {
+
+    // the gradient w.r.t. a block of a matrix as gradient w.r.t. the matrix,
+    // zero outside of the columns of the block coefficients
+    template <typename Gradient>
+    struct BlockColumns {
+        using Scalar = typename std::decay_t<Gradient>::Scalar;
+
+        Gradient gradient;
+        std::ptrdiff_t start;     // flat index of the first block coefficient
+        std::ptrdiff_t outerRows; // rows of the matrix
+        std::ptrdiff_t rows;      // rows of the block
+        std::ptrdiff_t cols;      // columns of the block
+
+        auto operator()(std::ptrdiff_t i, std::ptrdiff_t j) const -> Scalar
+        {
+            auto const offset = j - start;
+            if (offset < 0 || offset % outerRows >= rows
+                || offset / outerRows >= cols) {
+                return Scalar(0);
+            }
+            return gradient.coeff(
+                i, offset / outerRows * rows + offset % outerRows);
+        }
+
+        // adds the block gradient to the block columns of a gradient
+        template <typename Matrix>
+        void addTo(Matrix& matrix) const
+        {
+            for (std::ptrdiff_t j = 0; j != cols; ++j) {
+                matrix.middleCols(start + j * outerRows, rows)
+                    += promote<Matrix>(gradient.middleCols(j * rows, rows));
+            }
+        }
+    };
+
+    template <typename T>
+    struct IsBlockColumns : std::false_type { };
+
+    template <typename Gradient, typename PlainObjectType>
+    struct IsBlockColumns<
+        Eigen::CwiseNullaryOp<BlockColumns<Gradient>, PlainObjectType>>
+        : std::true_type { };
+
+} // namespace detail
+
+// lazily padded block gradients, accumulated into the block columns only
+template <typename T>
+constexpr bool isBlockColumns_v = detail::IsBlockColumns<T>::value;
+
+/**
+ * @brief Pads a gradient w.r.t. a block of a matrix with @p outerRows rows
+ * to a gradient of type @p Derivative w.r.t. the matrix of @p size
+ * coefficients.
+ *
+ * The block has @p rows rows and starts at the flat index @p start.
+ * Sparse gradients are scattered as by scatterColumns. Dense gradients are
+ * padded lazily: the result reads the coefficients of the block gradient,
+ * and dense derivatives accumulate it into the block columns only, such that
+ * no gradient of the size of the matrix is allocated per block.
+ */
+template <typename Derivative, typename Gradient>
+auto scatterBlock(Gradient const& gradient, std::ptrdiff_t start,
+    std::ptrdiff_t outerRows, std::ptrdiff_t rows, std::ptrdiff_t size)
+{
+    auto const cols = rows == 0 ? 0 : gradient.cols() / rows;
+    if constexpr (isSparse_v<Derivative>) {
+        auto columns = std::vector<std::ptrdiff_t>();
+        columns.reserve(static_cast<std::size_t>(rows * cols));
+        for (std::ptrdiff_t j = 0; j != cols; ++j) {
+            for (std::ptrdiff_t i = 0; i != rows; ++i) {
+                columns.push_back(start + j * outerRows + i);
+            }
+        }
+        return scatterColumns<Derivative>(gradient, columns, size);
+    } else {
+        // plain gradients are read in place, others are evaluated once
+        using Stored = std::conditional_t<isPlain_v<Gradient>,
+            Gradient const&, std::decay_t<decltype(densify(gradient).eval())>>;
+        return Dense_t<Derivative>::NullaryExpr(gradient.rows(), size,
+            detail::BlockColumns<Stored>{
+                densify(gradient), start, outerRows, rows, cols});
+    }
+}
+
+} // namespace AutoDiff::EigenAD
+
+#endif // AUTODIFF_SRC_EIGEN_DERIVATIVES_HPP
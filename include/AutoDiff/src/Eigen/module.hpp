@@ -17,8 +17,12 @@
 
 #include "../internal/TypeImpl.hpp"
 #include "../internal/traits.hpp" // traits to be specialized
-#include "traits.hpp"             // isScalar, isDense, isMatrixBase, isArray
+#include "InlineMatrix.hpp"        // InlineMatrix
+#include "StructuredMatrix.hpp"    // StructuredMatrix
+#include "derivatives.hpp"         // promote
+#include "traits.hpp" // isScalar, isDense, isMatrixBase, isSparse, isTensor
 
+#include <cstddef> // ptrdiff_t size_t
 #include <type_traits>
 #include <utility> // declval
 
@@ -57,6 +61,18 @@ using Vector2f = Matrix<float, 2, 1, 0, 2, 1>;
 using Vector3f = Matrix<float, 3, 1, 0, 3, 1>;
 using Vector4f = Matrix<float, 4, 1, 0, 4, 1>;
 
+template <typename PlainObjectType, int MapOptions, typename StrideType>
+class Map;
+
+template <int OuterStrideAtCompileTime, int InnerStrideAtCompileTime>
+class Stride;
+
+template <typename Scalar_, int Options_, typename StorageIndex_>
+class SparseMatrix;
+
+template <typename Scalar_, int NumIndices_, int Options_, typename IndexType>
+class Tensor;
+
 } // namespace Eigen
 
 // mandatory specializations of type traits for Eigen types
@@ -66,6 +82,25 @@ namespace AutoDiff::detail {
 template <typename T>
 using Unqualified_t = std::remove_cv_t<std::remove_reference_t<T>>;
 
+// the number of coefficients of an object with the given shape
+inline auto flatSize(internal::Shape const& shape) -> std::size_t
+{
+    auto size = std::size_t{1};
+    for (std::size_t i = 0; i != shape.size(); ++i) {
+        size *= shape[i];
+    }
+    return size;
+}
+
+// a map viewing no memory, with the compile-time dimensions if any
+template <typename Map>
+auto emptyMap() -> Map
+{
+    constexpr auto rows = Map::RowsAtCompileTime;
+    constexpr auto cols = Map::ColsAtCompileTime;
+    return Map(nullptr, rows < 0 ? 0 : rows, cols < 0 ? 0 : cols);
+}
+
 } // namespace AutoDiff::detail
 
 namespace AutoDiff::internal {
@@ -82,11 +117,18 @@ struct Evaluated<Dense, std::enable_if_t<EigenAD::isDense_v<Dense>>> {
     using type = detail::Unqualified_t<decltype(std::declval<Dense>().eval())>;
 };
 
+// Tensor expressions evaluate to column-major tensors of the same rank.
+template <typename Tensor>
+struct Evaluated<Tensor, std::enable_if_t<EigenAD::isTensor_v<Tensor>>> {
+    using type = Eigen::Tensor<std::remove_const_t<typename Tensor::Scalar>,
+        Tensor::NumDimensions, 0, std::ptrdiff_t>;
+};
+
 // For arrays, values and derivatives must have the same type
 // (or at least same dimensions at runtime).
 template <typename Array>
 struct DefaultDerivative<Array, std::enable_if_t<EigenAD::isArray_v<Array>>> {
-    using type = Array;
+    using type = typename Array::PlainObject;
 };
 
 // By default, floats are paired with float derivatives...
@@ -98,7 +140,8 @@ struct DefaultDerivative<float> {
 
 template <typename Matrix>
 struct DefaultDerivative<Matrix,
-    std::enable_if_t<EigenAD::isMatrixBase_v<Matrix>
+    std::enable_if_t<(EigenAD::isMatrixBase_v<Matrix>
+                         || EigenAD::isTensor_v<Matrix>)
                      && std::is_same_v<typename Matrix::Scalar, float>>> {
     using type = Eigen::MatrixXf;
 };
@@ -113,11 +156,16 @@ struct DefaultDerivative<T,
 
 template <typename T>
 struct DefaultDerivative<T,
-    std::enable_if_t<EigenAD::isMatrixBase_v<T>
+    std::enable_if_t<(EigenAD::isMatrixBase_v<T> || EigenAD::isTensor_v<T>)
                      && !std::is_same_v<typename T::Scalar, float>>> {
     using type = Eigen::MatrixXd;
 };
 
+// Maps view external memory and are rebound on assignment.
+template <typename Map>
+struct IsView<Map, std::enable_if_t<EigenAD::isMap_v<Map>>> : std::true_type {
+};
+
 } // namespace AutoDiff::internal
 
 // implementation of type-specific operations
@@ -143,25 +191,43 @@ struct TypeImpl<MatrixBase,
         return {static_cast<std::size_t>(matrix.rows())};
     }
 
+    static auto emptyView() -> MatrixBase
+    {
+        return detail::emptyMap<MatrixBase>();
+    }
+
     static void generate(MatrixBase& matrix, MapDescription const& descr)
     {
+        auto const rows = detail::flatSize(descr.codomainShape);
+        auto const cols = detail::flatSize(descr.domainShape);
         if (descr.state == MapDescription::zero) {
-            matrix.setZero(descr.codomainShape[0], descr.domainShape[0]);
+            matrix.setZero(rows, cols);
         } else if (descr.state == MapDescription::identity) {
-            matrix.setIdentity(descr.codomainShape[0], descr.domainShape[0]);
+            matrix.setIdentity(rows, cols);
         }
     }
 
+    // derivatives of lower precision are promoted on accumulation
+
     template <typename Other>
     static void assign(MatrixBase& matrix, Other const& other)
     {
-        matrix.noalias() = other;
+        if constexpr (EigenAD::isBlockColumns_v<Other>) {
+            matrix.setZero(other.rows(), other.cols());
+            other.functor().addTo(matrix);
+        } else {
+            matrix.noalias() = EigenAD::promote<MatrixBase>(other);
+        }
     }
 
     template <typename Other>
     static void addTo(MatrixBase& matrix, Other const& other)
     {
-        matrix.noalias() += other;
+        if constexpr (EigenAD::isBlockColumns_v<Other>) {
+            other.functor().addTo(matrix);
+        } else {
+            matrix.noalias() += EigenAD::promote<MatrixBase>(other);
+        }
     }
 };
 
@@ -179,6 +245,8 @@ struct TypeImpl<Array, std::enable_if_t<EigenAD::isArray_v<Array>>> {
             static_cast<std::size_t>(array.cols())};
     }
 
+    static auto emptyView() -> Array { return detail::emptyMap<Array>(); }
+
     static void generate(Array& array, MapDescription const& descr)
     {
         if (descr.state == MapDescription::zero) {
@@ -191,13 +259,162 @@ struct TypeImpl<Array, std::enable_if_t<EigenAD::isArray_v<Array>>> {
     template <typename Other>
     static void assign(Array& array, Other const& other)
     {
-        array = other;
+        array = EigenAD::promote<Array>(other);
     }
 
     template <typename Other>
     static void addTo(Array& array, Other const& other)
     {
-        array += other;
+        array += EigenAD::promote<Array>(other);
+    }
+};
+
+// Tensors are only values; their derivatives are matrices
+// acting on the (column-major) flattened coefficients.
+template <typename Tensor>
+struct TypeImpl<Tensor, std::enable_if_t<EigenAD::isTensor_v<Tensor>>> {
+    static_assert(Tensor::NumDimensions <= 8, "AT MOST 8 DIMENSIONS");
+
+    static auto getShape(Tensor const& tensor) -> Shape
+    {
+        auto shape = Shape();
+        for (auto const dimension : tensor.dimensions()) {
+            shape.push_back(static_cast<std::size_t>(dimension));
+        }
+        return shape;
+    }
+
+    template <typename Other>
+    static void assign(Tensor& tensor, Other const& other)
+    {
+        tensor = other;
+    }
+};
+
+template <typename Scalar>
+struct TypeImpl<EigenAD::StructuredMatrix<Scalar>> {
+    using Matrix = EigenAD::StructuredMatrix<Scalar>;
+
+    static auto codomainShape(Matrix const& matrix) -> Shape
+    {
+        return {static_cast<std::size_t>(matrix.rows())};
+    }
+
+    // zero and identity maps are not materialized
+    static void generate(Matrix& matrix, MapDescription const& descr)
+    {
+        auto const rows
+            = static_cast<std::ptrdiff_t>(detail::flatSize(descr.codomainShape));
+        auto const cols
+            = static_cast<std::ptrdiff_t>(detail::flatSize(descr.domainShape));
+        if (descr.state == MapDescription::zero) {
+            matrix = Matrix::Zero(rows, cols);
+        } else if (descr.state == MapDescription::identity) {
+            matrix = Matrix::Identity(rows, cols);
+        }
+    }
+
+    static void assign(Matrix& matrix, Matrix const& other) { matrix = other; }
+
+    template <typename Derived>
+    static void assign(Matrix& matrix, Eigen::MatrixBase<Derived> const& other)
+    {
+        matrix = Matrix(other);
+    }
+
+    template <typename Other>
+    static void addTo(Matrix& matrix, Other const& other)
+    {
+        matrix += other;
+    }
+};
+
+// Inline matrices keep their storage when resized to a smaller size.
+template <typename Scalar, int InlineSize>
+struct TypeImpl<EigenAD::InlineMatrix<Scalar, InlineSize>> {
+    using Matrix = EigenAD::InlineMatrix<Scalar, InlineSize>;
+
+    static auto codomainShape(Matrix const& matrix) -> Shape
+    {
+        return {static_cast<std::size_t>(matrix.rows())};
+    }
+
+    static void generate(Matrix& matrix, MapDescription const& descr)
+    {
+        auto const rows
+            = static_cast<std::ptrdiff_t>(detail::flatSize(descr.codomainShape));
+        auto const cols
+            = static_cast<std::ptrdiff_t>(detail::flatSize(descr.domainShape));
+        if (descr.state == MapDescription::zero) {
+            matrix.setZero(rows, cols);
+        } else if (descr.state == MapDescription::identity) {
+            matrix.setIdentity(rows, cols);
+        }
+    }
+
+    // resizing before evaluating could free storage that the expression reads
+    template <typename Other>
+    static void assign(Matrix& matrix, Other const& other)
+    {
+        if (other.rows() == matrix.rows() && other.cols() == matrix.cols()) {
+            matrix.noalias() = EigenAD::promote<Matrix>(other);
+        } else {
+            matrix = EigenAD::promote<Matrix>(other);
+        }
+    }
+
+    template <typename Other>
+    static void addTo(Matrix& matrix, Other const& other)
+    {
+        matrix.noalias() += EigenAD::promote<Matrix>(other);
+    }
+};
+
+template <typename Sparse>
+struct TypeImpl<Sparse, std::enable_if_t<EigenAD::isSparse_v<Sparse>>> {
+    static auto codomainShape(Sparse const& matrix) -> Shape
+    {
+        return {static_cast<std::size_t>(matrix.rows())};
+    }
+
+    // zero maps have no nonzeros
+    static void generate(Sparse& matrix, MapDescription const& descr)
+    {
+        auto const rows = detail::flatSize(descr.codomainShape);
+        auto const cols = detail::flatSize(descr.domainShape);
+        if (descr.state == MapDescription::zero) {
+            matrix.resize(rows, cols);
+        } else if (descr.state == MapDescription::identity) {
+            matrix.resize(rows, cols);
+            matrix.setIdentity();
+        }
+    }
+
+    template <typename Other>
+    static void assign(Sparse& matrix, Other const& other)
+    {
+        if constexpr (EigenAD::isSparse_v<Other>) {
+            matrix = other;
+        } else {
+            matrix = other.sparseView();
+        }
+    }
+
+    // row-sparse gradients (e.g., of embedding tables) are accumulated in
+    // row-major matrices, whose sums require the same storage order
+    template <typename Other>
+    static void addTo(Sparse& matrix, Other const& other)
+    {
+        if constexpr (EigenAD::isSparse_v<Other>) {
+            if constexpr (bool(Other::IsRowMajor) == bool(Sparse::IsRowMajor)) {
+                matrix += other;
+            } else {
+                matrix += Sparse(other);
+            }
+        } else {
+            // only the nonzeros of the dense derivative are added
+            matrix += Sparse(other.sparseView());
+        }
     }
 };
 
@@ -242,6 +459,57 @@ using ArrayXX = Variable<Eigen::ArrayXXd, Eigen::ArrayXXd>;
 using ArrayXf  = Variable<Eigen::ArrayXf, Eigen::ArrayXf>;
 using ArrayXXf = Variable<Eigen::ArrayXXf, Eigen::ArrayXXf>;
 
+// mixed precision: float values with double derivatives
+
+using RealFD    = Variable<float, Eigen::MatrixXd>;
+using VectorXfd = Variable<Eigen::VectorXf, Eigen::MatrixXd>;
+using MatrixXfd = Variable<Eigen::MatrixXf, Eigen::MatrixXd>;
+
+using ArrayXfd  = Variable<Eigen::ArrayXf, Eigen::ArrayXd>;
+using ArrayXXfd = Variable<Eigen::ArrayXXf, Eigen::ArrayXXd>;
+
+// small fixed-size values with derivatives stored inline (no heap allocation),
+// where MaxSize bounds the number of coefficients of all values in a graph
+
+template <int MaxSize>
+using FixedDerivative = Eigen::Matrix<double, -1, -1, 0, MaxSize, MaxSize>;
+
+template <int MaxSize>
+using FixedReal = Variable<double, FixedDerivative<MaxSize>>;
+
+template <int MaxSize>
+using FixedVector2d = Variable<Eigen::Vector2d, FixedDerivative<MaxSize>>;
+template <int MaxSize>
+using FixedVector3d = Variable<Eigen::Vector3d, FixedDerivative<MaxSize>>;
+template <int MaxSize>
+using FixedVector4d = Variable<Eigen::Vector4d, FixedDerivative<MaxSize>>;
+template <int MaxSize>
+using FixedMatrix2d = Variable<Eigen::Matrix2d, FixedDerivative<MaxSize>>;
+template <int MaxSize>
+using FixedMatrix3d = Variable<Eigen::Matrix3d, FixedDerivative<MaxSize>>;
+template <int MaxSize>
+using FixedMatrix4d = Variable<Eigen::Matrix4d, FixedDerivative<MaxSize>>;
+
+// views of external memory: assigning a new map rebinds without copying
+
+template <typename Plain>
+using ConstMap = Eigen::Map<Plain const, 0, Eigen::Stride<0, 0>>;
+
+using VectorMap  = Variable<ConstMap<Eigen::VectorXd>, Eigen::MatrixXd>;
+using MatrixMap  = Variable<ConstMap<Eigen::MatrixXd>, Eigen::MatrixXd>;
+using ArrayMap   = Variable<ConstMap<Eigen::ArrayXd>, Eigen::ArrayXd>;
+using ArrayXXMap = Variable<ConstMap<Eigen::ArrayXXd>, Eigen::ArrayXXd>;
+
+using Tensor3 = Variable<Eigen::Tensor<double, 3, 0, std::ptrdiff_t>,
+    Eigen::MatrixXd>;
+using Tensor4 = Variable<Eigen::Tensor<double, 4, 0, std::ptrdiff_t>,
+    Eigen::MatrixXd>;
+
+using Tensor3f = Variable<Eigen::Tensor<float, 3, 0, std::ptrdiff_t>,
+    Eigen::MatrixXf>;
+using Tensor4f = Variable<Eigen::Tensor<float, 4, 0, std::ptrdiff_t>,
+    Eigen::MatrixXf>;
+
 } // namespace AutoDiff
 
 #endif // AUTODIFF_SRC_EIGEN_MODULE_HPP
@@ -13,12 +13,15 @@
 
 #include "../Core/Expression.hpp" // ValueType
 
-#include <type_traits> // is_arithmetic is_base_of true_type false_type
+#include <type_traits> // is_arithmetic is_base_of is_same true_type false_type
 
 // forward-declare Eigen types
 
 namespace Eigen {
 
+struct half;
+struct bfloat16;
+
 template <typename Derived>
 class DenseBase;
 
@@ -28,6 +31,18 @@ class ArrayBase;
 template <typename Derived>
 class MatrixBase;
 
+template <typename Derived>
+class SparseMatrixBase;
+
+template <typename Derived, int AccessLevel>
+class TensorBase;
+
+template <typename PlainObjectType, int MapOptions, typename StrideType>
+class Map;
+
+template <typename Derived>
+class PlainObjectBase;
+
 } // namespace Eigen
 
 namespace AutoDiff::EigenAD {
@@ -67,10 +82,41 @@ namespace detail {
     }
     auto testMatrix(void const*) -> std::false_type;
 
+    template <typename X, typename Y>
+    auto testBroadcast(
+        Eigen::DenseBase<X> const* /*x*/, Eigen::DenseBase<Y> const* /*y*/)
+    {
+        constexpr bool isSameKind
+            = std::is_base_of_v<Eigen::ArrayBase<X>, X>
+           == std::is_base_of_v<Eigen::ArrayBase<Y>, Y>;
+        if constexpr (isSameKind
+                      && bool(X::IsVectorAtCompileTime)
+                             != bool(Y::IsVectorAtCompileTime)) {
+            return std::true_type();
+        } else {
+            return std::false_type();
+        }
+    }
+    auto testBroadcast(void const*, void const*) -> std::false_type;
+
+    template <typename PlainObjectType, int MapOptions, typename StrideType>
+    auto testMap(
+        Eigen::Map<PlainObjectType, MapOptions, StrideType> const* /*map*/)
+        -> std::true_type;
+    auto testMap(void const*) -> std::false_type;
+
+    template <typename Derived>
+    auto testPlain(Eigen::PlainObjectBase<Derived> const* /*plain*/)
+        -> std::true_type;
+    auto testPlain(void const*) -> std::false_type;
+
 } // namespace detail
 
+// Eigen's half-precision types serve as compact storage for values.
 template <typename T>
-constexpr bool isScalar_v = std::is_arithmetic_v<T>;
+constexpr bool isScalar_v = std::is_arithmetic_v<T>
+                         || std::is_same_v<T, Eigen::half>
+                         || std::is_same_v<T, Eigen::bfloat16>;
 
 template <typename T>
 constexpr bool isDense_v = std::is_base_of_v<Eigen::DenseBase<T>, T>;
@@ -81,6 +127,13 @@ constexpr bool isArray_v = std::is_base_of_v<Eigen::ArrayBase<T>, T>;
 template <typename T>
 constexpr bool isMatrixBase_v = std::is_base_of_v<Eigen::MatrixBase<T>, T>;
 
+template <typename T>
+constexpr bool isSparse_v = std::is_base_of_v<Eigen::SparseMatrixBase<T>, T>;
+
+// all tensor expressions derive from TensorBase<Derived, ReadOnlyAccessors>
+template <typename T>
+constexpr bool isTensor_v = std::is_base_of_v<Eigen::TensorBase<T, 0>, T>;
+
 template <typename T>
 constexpr bool isColVector_v
     = decltype(detail::testColVector(std::declval<T*>()))::value;
@@ -93,6 +146,26 @@ template <typename T>
 constexpr bool isMatrix_v
     = decltype(detail::testMatrix(std::declval<T*>()))::value;
 
+// dense objects viewing external memory
+template <typename T>
+constexpr bool isMap_v = decltype(detail::testMap(std::declval<T*>()))::value;
+
+// matrices and arrays owning their coefficients
+template <typename T>
+constexpr bool isPlain_v
+    = decltype(detail::testPlain(std::declval<T*>()))::value;
+
+// plain matrices and arrays returned by value, of which views would dangle
+template <typename T>
+constexpr bool isTemporary_v
+    = !std::is_reference_v<T> && isPlain_v<std::remove_reference_t<T>>;
+
+// A matrix and a vector (or two such arrays), where the vector is broadcast
+// along the matrix; both are distinguished at compile time.
+template <typename X, typename Y>
+constexpr bool isBroadcast_v = decltype(detail::testBroadcast(
+    std::declval<X*>(), std::declval<Y*>()))::value;
+
 template <typename Expr>
 constexpr bool hasScalarValue_v = isScalar_v<ValueType_t<Expr>>;
 
@@ -102,6 +175,9 @@ constexpr bool hasArrayValue_v = isArray_v<ValueType_t<Expr>>;
 template <typename Expr>
 constexpr bool hasMatrixBaseValue_v = isMatrixBase_v<ValueType_t<Expr>>;
 
+template <typename Expr>
+constexpr bool hasTensorValue_v = isTensor_v<ValueType_t<Expr>>;
+
 template <typename Expr>
 constexpr bool hasColVectorValue_v = isColVector_v<ValueType_t<Expr>>;
 
@@ -111,6 +187,10 @@ constexpr bool hasRowVectorValue_v = isRowVector_v<ValueType_t<Expr>>;
 template <typename Expr>
 constexpr bool hasMatrixValue_v = isMatrix_v<ValueType_t<Expr>>;
 
+template <typename X, typename Y>
+constexpr bool hasBroadcastValues_v
+    = isBroadcast_v<ValueType_t<X>, ValueType_t<Y>>;
+
 } // namespace AutoDiff::EigenAD
 
 #endif // AUTODIFF_SRC_EIGEN_TRAITS_HPP
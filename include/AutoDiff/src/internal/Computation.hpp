@@ -10,11 +10,29 @@
 #include "Evaluator.hpp"
 #include "TypeImpl.hpp"
 
+#include <algorithm> // max
+#include <atomic>
 #include <cassert>
+#include <cstddef> // size_t
 #include <memory>
+#include <mutex>
+#include <thread>      // hardware_concurrency
 #include <type_traits> // is_same
 #include <utility>     // move
 
+namespace AutoDiff::detail {
+
+// consecutive indices of the threads that accumulate gradients,
+// so that they are spread evenly over the gradient shards
+inline auto threadIndex() -> std::size_t
+{
+    static auto next              = std::atomic<std::size_t>{0};
+    thread_local auto const index = next++;
+    return index;
+}
+
+} // namespace AutoDiff::detail
+
 namespace AutoDiff::internal {
 
 /**
@@ -43,7 +61,7 @@ public:
     {
         releaseChildren();
         mEvaluator.release(); // NOLINT(*-unused-return-value)
-        mValue = std::move(value);
+        replace(mValue, std::move(value));
     }
 
     /**
@@ -81,24 +99,35 @@ public:
      * @brief The cached derivative.
      *
      * Evaluates the derivative if necessary.
+     * With concurrent accumulation, first moves the gradients accumulated
+     * in the shards to the derivative.
      */
     auto derivative() -> Derivative const&
     {
-        if (mDerivativeDescr.state != MapDescription::evaluated) {
-            // lazy evaluation
-            generate(mDerivative, mDerivativeDescr);
-            mDerivativeDescr.state = MapDescription::evaluated;
+        if (mGradientShards) {
+            auto const lock = std::lock_guard(mDerivativeMutex);
+            reduceGradientShards();
+            generateIfNecessary();
+            return mDerivative;
         }
+        generateIfNecessary();
         return mDerivative;
     }
 
     /**
      * @brief Manually set the derivative.
      *
+     * With concurrent accumulation, discards the gradients accumulated in
+     * the shards, so that later gradients are added to this derivative.
+     *
      * @param  derivative  the derivative to store
      */
     void setDerivative(Derivative derivative)
     {
+        auto const lock = std::lock_guard(mDerivativeMutex);
+        if (mGradientShards) {
+            clearGradientShards();
+        }
         mDerivative            = std::move(derivative);
         mDerivativeDescr.state = MapDescription::evaluated;
     }
@@ -114,14 +143,61 @@ public:
     template <typename OtherDerivative>
     void addGradient(OtherDerivative const& gradient)
     {
-        if (mDerivativeDescr.state == MapDescription::zero) {
-            assign(mDerivative, gradient);
-            mDerivativeDescr.state = MapDescription::evaluated;
+        if (mGradientShards) {
+            auto& shard     = threadShard();
+            auto const lock = std::lock_guard(shard.mutex);
+            accumulate(shard.gradient, shard.descr, gradient);
         } else {
-            addTo(mDerivative, gradient);
+            accumulate(mDerivative, mDerivativeDescr, gradient);
         }
     }
 
+    /**
+     * @brief Enable or disable concurrent gradient accumulation.
+     *
+     * When enabled, gradients pulled back by concurrent reverse-mode passes
+     * are accumulated into per-thread shards, which are moved to the
+     * derivative when it is read.
+     * Threads only contend for a shard if there are more threads than
+     * hardware threads.
+     * The gradient is no longer reset by @c setGradientZero;
+     * it is accumulated across passes until reset by @c resetGradient.
+     *
+     * Enabling the accumulation resets the gradient; disabling it keeps the
+     * accumulated gradient.
+     *
+     * @param  enabled     whether to accumulate concurrently
+     */
+    void setConcurrentAccumulation(bool enabled)
+    {
+        auto const lock = std::lock_guard(mDerivativeMutex);
+        if (enabled && !mGradientShards) {
+            mNumShards      = std::max(std::thread::hardware_concurrency(), 1U);
+            mGradientShards = std::make_unique<GradientShard[]>(mNumShards);
+
+            mDerivativeDescr.state       = MapDescription::zero;
+            mDerivativeDescr.domainShape = getShape(mValue);
+            for (std::size_t i = 0; i != mNumShards; ++i) {
+                mGradientShards[i].descr = mDerivativeDescr;
+            }
+        } else if (!enabled && mGradientShards) {
+            reduceGradientShards();
+            mGradientShards.reset();
+        }
+    }
+
+    /**
+     * @brief Reset the accumulated gradient to zero.
+     */
+    void resetGradient()
+    {
+        auto const lock = std::lock_guard(mDerivativeMutex);
+        if (mGradientShards) {
+            clearGradientShards();
+        }
+        mDerivativeDescr.state = MapDescription::zero;
+    }
+
     // AbstractComputation implementation ====================================
 
     void evaluate() final
@@ -149,6 +225,21 @@ public:
 #ifndef AUTODIFF_NO_REVERSE_MODE
     void setGradientZero(Shape codomainShape) final
     {
+        if (mGradientShards) {
+            // accumulated across passes until reset explicitly
+            auto& shard            = threadShard();
+            auto const lock        = std::lock_guard(shard.mutex);
+            auto const domainShape = getShape(mValue);
+            // gradients of different shapes cannot be summed
+            assert((shard.descr.state != MapDescription::evaluated
+                       || (shard.descr.domainShape == domainShape
+                           && shard.descr.codomainShape == codomainShape))
+                && "GRADIENT SHAPE MISMATCH");
+            shard.descr.domainShape   = domainShape;
+            shard.descr.codomainShape = codomainShape;
+            shard.hasCodomainShape    = true;
+            return;
+        }
         mDerivativeDescr.state         = MapDescription::zero;
         mDerivativeDescr.domainShape   = getShape(mValue);
         mDerivativeDescr.codomainShape = codomainShape;
@@ -157,7 +248,10 @@ public:
     void pullGradient() final
     {
         assert(mEvaluator && "LITERALS CANNOT BE DIFFERENTIATED");
-        mEvaluator->pullBack(derivative());
+        // the shards are only read explicitly, after all passes
+        assert(!mGradientShards && "ONLY SOURCES ACCUMULATE CONCURRENTLY");
+        generateIfNecessary();
+        mEvaluator->pullBack(mDerivative);
     }
 #endif
 
@@ -180,9 +274,80 @@ public:
     }
 
 private:
-    Value mValue{};
+    void generateIfNecessary()
+    {
+        if (mDerivativeDescr.state != MapDescription::evaluated) {
+            // lazy evaluation
+            generate(mDerivative, mDerivativeDescr);
+            mDerivativeDescr.state = MapDescription::evaluated;
+        }
+    }
+
+    template <typename OtherDerivative>
+    static void accumulate(Derivative& derivative, MapDescription& descr,
+        OtherDerivative const& gradient)
+    {
+        if (descr.state == MapDescription::zero) {
+            assign(derivative, gradient);
+            descr.state = MapDescription::evaluated;
+        } else {
+            addTo(derivative, gradient);
+        }
+    }
+
+    // the gradient accumulated by the threads with the same shard index;
+    // aligned to a cache line, so shards do not share one
+    struct alignas(64) GradientShard {
+        std::mutex mutex;
+        Derivative gradient{};
+        MapDescription descr{};
+        bool hasCodomainShape{false};
+    };
+
+    [[nodiscard]] auto threadShard() -> GradientShard&
+    {
+        return mGradientShards[detail::threadIndex() % mNumShards];
+    }
+
+    // moves the gradients of the shards to the derivative, so that each
+    // gradient is added exactly once; requires the derivative mutex
+    void reduceGradientShards()
+    {
+        for (std::size_t i = 0; i != mNumShards; ++i) {
+            auto& shard     = mGradientShards[i];
+            auto const lock = std::lock_guard(shard.mutex);
+            if (shard.hasCodomainShape
+                && mDerivativeDescr.state != MapDescription::evaluated) {
+                // the shapes of the latest pass, to generate a zero gradient
+                mDerivativeDescr.domainShape   = shard.descr.domainShape;
+                mDerivativeDescr.codomainShape = shard.descr.codomainShape;
+            }
+            if (shard.descr.state == MapDescription::evaluated) {
+                accumulate(mDerivative, mDerivativeDescr, shard.gradient);
+                shard.descr.state = MapDescription::zero;
+            }
+        }
+    }
+
+    // discards the gradients of the shards; requires the derivative mutex
+    void clearGradientShards()
+    {
+        for (std::size_t i = 0; i != mNumShards; ++i) {
+            auto& shard       = mGradientShards[i];
+            auto const lock   = std::lock_guard(shard.mutex);
+            shard.descr.state = MapDescription::zero;
+        }
+    }
+
+    Value mValue{initialValue<Value>()};
     Derivative mDerivative{};
     MapDescription mDerivativeDescr{};
+    // guards the derivative while the shards are reduced
+    std::mutex mDerivativeMutex;
+
+    // only allocated for concurrent gradient accumulation
+    std::unique_ptr<GradientShard[]> mGradientShards{};
+    std::size_t mNumShards{0};
 
     std::unique_ptr<AbstractEvaluator<Value, Derivative>> mEvaluator{};
 };
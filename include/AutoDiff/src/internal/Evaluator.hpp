@@ -137,15 +137,16 @@ public:
 
     void evaluateTo(Value& value) final
     {
-        assign(value, mExpression._value());
+        // Values cached during the previous evaluation are outdated.
+        // The new ones are kept for the subsequent differentiation.
         mExpression._releaseCache();
+        assign(value, mExpression._value());
     }
 
 #ifndef AUTODIFF_NO_FORWARD_MODE
     void pushForwardTo(Derivative& tangent) final
     {
         assign(tangent, mExpression._pushForward());
-        mExpression._releaseCache();
     }
 #endif
 
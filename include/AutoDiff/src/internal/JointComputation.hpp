@@ -0,0 +1,292 @@
+// Copyright (c) 2024 Matthias Krippner
+//
+// This software is released under the MIT License.
+// https://opensource.org/licenses/MIT
+
+#ifndef AUTODIFF_SRC_INTERNAL_JOINT_COMPUTATION_HPP
+#define AUTODIFF_SRC_INTERNAL_JOINT_COMPUTATION_HPP
+
+#include "../Core/Expression.hpp"
+#include "AbstractComputation.hpp"
+#include "Node.hpp" // NodeOwner
+#include "TypeImpl.hpp"
+
+#include <array>
+#include <cassert>
+#include <cstddef> // size_t
+#include <memory>
+#include <tuple>
+#include <utility> // index_sequence move swap
+
+namespace AutoDiff::internal {
+
+/**
+ * @class JointComputation
+ * @brief Computation node shared by the outputs of a multi-output operation.
+ *
+ * Evaluates the operation once for all outputs and caches their values and
+ * derivatives.
+ * Each output is a separate variable, whose computation node depends on
+ * this node (see @c JointOutput).
+ * In forward mode, the tangents of all outputs are pushed forward at once.
+ * In reverse mode, the output variables accumulate their gradients in this
+ * node before the joint pullback combines them.
+ *
+ * The node is hidden from the user. It is never a source or target of a
+ * function with variable operands.
+ *
+ * @tparam Operation   the multi-output operation, see MultiOutputOperation
+ */
+template <typename Operation>
+class JointComputation : public AbstractComputation {
+public:
+    using Values     = typename Operation::Values;
+    using Derivative = typename Operation::Derivative;
+    using Gradients  = typename Operation::Gradients;
+
+    static constexpr std::size_t outputCount = Operation::outputCount;
+
+    template <std::size_t K>
+    using Value = std::tuple_element_t<K, Values>;
+
+    /**
+     * @brief Create a node that stores a copy of the operation and takes
+     * ownership of its child computations.
+     *
+     * @param  operation   the multi-output operation
+     */
+    explicit JointComputation(Operation const& operation)
+        : mOperation{operation}
+    {
+        mOperation._transferChildrenToImpl(*this);
+    }
+
+    /**
+     * @brief The cached value of output K.
+     */
+    template <std::size_t K>
+    [[nodiscard]] auto value() const -> Value<K> const&
+    {
+        return std::get<K>(mValues);
+    }
+
+    /**
+     * @brief The cached derivative of output K.
+     *
+     * Evaluates the derivative if necessary.
+     */
+    auto derivative(std::size_t k) -> Derivative const&
+    {
+        if (mDerivativeDescrs[k].state != MapDescription::evaluated) {
+            // lazy evaluation
+            generate(mDerivatives[k], mDerivativeDescrs[k]);
+            mDerivativeDescrs[k].state = MapDescription::evaluated;
+        }
+        return mDerivatives[k];
+    }
+
+    /**
+     * @brief Add a gradient to the current derivative of output k.
+     *
+     * @param  k           the index of the output
+     * @param  gradient    the gradient to be added
+     */
+    template <typename OtherDerivative>
+    void addGradient(std::size_t k, OtherDerivative const& gradient)
+    {
+        if (mDerivativeDescrs[k].state == MapDescription::zero) {
+            assign(mDerivatives[k], gradient);
+            mDerivativeDescrs[k].state = MapDescription::evaluated;
+        } else {
+            addTo(mDerivatives[k], gradient);
+        }
+    }
+
+    // AbstractComputation implementation ====================================
+
+    void evaluate() final
+    {
+        // Values cached during the previous evaluation are outdated.
+        mOperation._releaseCacheImpl();
+        assignOutputs(mValues, mOperation._valueImpl(), Indices{});
+    }
+
+#ifndef AUTODIFF_NO_FORWARD_MODE
+    void setTangentZero(Shape domainShape) final
+    {
+        forEachOutput(
+            [&](std::size_t k, Shape valueShape) {
+                mDerivativeDescrs[k].state         = MapDescription::zero;
+                mDerivativeDescrs[k].domainShape   = domainShape;
+                mDerivativeDescrs[k].codomainShape = valueShape;
+            },
+            Indices{});
+    }
+
+    void pushTangent() final
+    {
+        assignOutputs(mDerivatives, mOperation._pushForwardImpl(), Indices{});
+        for (auto& descr : mDerivativeDescrs) {
+            descr.state = MapDescription::evaluated;
+        }
+    }
+#endif
+
+#ifndef AUTODIFF_NO_REVERSE_MODE
+    void setGradientZero(Shape codomainShape) final
+    {
+        forEachOutput(
+            [&](std::size_t k, Shape valueShape) {
+                mDerivativeDescrs[k].state         = MapDescription::zero;
+                mDerivativeDescrs[k].domainShape   = valueShape;
+                mDerivativeDescrs[k].codomainShape = codomainShape;
+            },
+            Indices{});
+    }
+
+    void pullGradient() final
+    {
+        // outputs without gradient (e.g., not part of the function)
+        // are passed as null
+        auto gradients   = Gradients{};
+        auto hasGradient = false;
+        for (std::size_t k = 0; k != outputCount; ++k) {
+            if (mDerivativeDescrs[k].state != MapDescription::zero) {
+                gradients[k] = &derivative(k);
+                hasGradient  = true;
+            }
+        }
+        if (hasGradient) {
+            mOperation._pullBackImpl(gradients);
+        }
+    }
+#endif
+
+    // The node is not a variable, so it cannot be seeded.
+    void setDerivativeIdentity() final
+    {
+        assert(false && "OUTPUTS MUST BE SEEDED INDIVIDUALLY");
+    }
+
+    [[nodiscard]] auto valueShape() const -> Shape final
+    {
+        return getShape(value<0>());
+    }
+
+    [[nodiscard]] auto derivativeCodomainShape() const -> Shape final
+    {
+        return codomainShape(mDerivatives[0]);
+    }
+
+private:
+    using Indices = std::make_index_sequence<outputCount>;
+
+    template <typename Targets, typename Results, std::size_t... K>
+    static void assignOutputs(
+        Targets& targets, Results const& results, std::index_sequence<K...>)
+    {
+        (assign(std::get<K>(targets), std::get<K>(results)), ...);
+    }
+
+    template <typename Fn, std::size_t... K>
+    void forEachOutput(Fn const& fn, std::index_sequence<K...>) const
+    {
+        (fn(K, getShape(value<K>())), ...);
+    }
+
+    Operation mOperation;
+    Values mValues{};
+    std::array<Derivative, outputCount> mDerivatives{};
+    std::array<MapDescription, outputCount> mDerivativeDescrs{};
+};
+
+/**
+ * @class JointOutput
+ * @brief Expression of output K of a multi-output operation.
+ *
+ * The expression of a variable that refers to one output of a shared
+ * @c JointComputation.
+ * Like a variable, the expression holds a shared pointer to the node, whose
+ * ownership is transferred when the expression is bound to a variable.
+ *
+ * @tparam Operation   the multi-output operation
+ * @tparam K           the index of the output
+ */
+template <typename Operation, std::size_t K>
+class JointOutput : public Expression<JointOutput<Operation, K>> {
+public:
+    using Joint      = JointComputation<Operation>;
+    using Value      = typename Joint::template Value<K>;
+    using Derivative = typename Operation::Derivative;
+
+    explicit JointOutput(std::shared_ptr<Joint> joint)
+        : mJoint{std::move(joint)}
+    {
+        mJoint->addParentOwner(mOwner);
+    }
+
+    JointOutput(JointOutput const& other)
+        : mJoint{other.mJoint}
+        , mJointPtr{other.mJointPtr}
+    {
+        mJoint->addParentOwner(mOwner); // owner is unique
+    }
+
+    auto operator=(JointOutput other) -> JointOutput&
+    {
+        using std::swap;
+        swap(mOwner, other.mOwner);
+        swap(mJoint, other.mJoint);
+        swap(mJointPtr, other.mJointPtr);
+        return *this;
+    }
+
+    ~JointOutput()
+    {
+        if (static_cast<bool>(mJoint)) {
+            mJoint->removeParentOwner(mOwner);
+        } // else _transferChildrenToImpl was called
+    }
+
+    JointOutput(JointOutput&&) noexcept                    = default;
+    auto operator=(JointOutput&&) noexcept -> JointOutput& = default;
+
+    // Expression implementation ===============================================
+
+    // Must return Value by reference to avoid dangling references to
+    // temporaries in expressions!
+    [[nodiscard]] auto _valueImpl() const -> Value const&
+    {
+        return mJointPtr->template value<K>();
+    }
+
+    [[nodiscard]] auto _pushForwardImpl() const -> Derivative const&
+    {
+        return mJointPtr->derivative(K);
+    }
+
+    template <typename OtherDerivative>
+    void _pullBackImpl(OtherDerivative const& gradient) const
+    {
+        mJointPtr->addGradient(K, gradient);
+    }
+
+    void _transferChildrenToImpl(Node& node)
+    {
+        // unregister ownership and transfer owning pointer to node
+        mJoint->removeParentOwner(mOwner);
+        node.addChild(mJoint);
+        mJoint.reset();
+    }
+
+    void _releaseCacheImpl() const { } // the joint node is evaluated itself
+
+private:
+    std::unique_ptr<NodeOwner> mOwner{std::make_unique<NodeOwner>()};
+    std::shared_ptr<Joint> mJoint;
+    Joint* mJointPtr{mJoint.get()};
+};
+
+} // namespace AutoDiff::internal
+
+#endif // AUTODIFF_SRC_INTERNAL_JOINT_COMPUTATION_HPP
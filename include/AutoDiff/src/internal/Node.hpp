@@ -9,6 +9,7 @@
 #include "range_algorithm.hpp"
 
 #include <memory>
+#include <mutex>
 #include <queue>
 #include <unordered_set>
 #include <utility> // move
@@ -29,6 +30,10 @@ struct NodeOwner { };
  *
  * On destruction, child nodes are guaranteed to be destroyed iteratively.
  * This prevents stack-overflow when destructing large graphs.
+ *
+ * The ownership bookkeeping is thread-safe: a node can be shared by graphs
+ * that are built and destructed concurrently on different threads.
+ * The children of a node must not be modified concurrently.
  */
 class Node {
 public:
@@ -36,9 +41,11 @@ public:
     using PtrSet   = std::unordered_set<NodePtr>;
     using OwnerPtr = std::unique_ptr<NodeOwner>;
 
-    // Nodes are unique
+    // Nodes are unique and referenced by their address
     Node(Node const&)                    = delete;
+    Node(Node&&)                         = delete;
     auto operator=(Node const&) -> Node& = delete;
+    auto operator=(Node&&) -> Node&      = delete;
 
     /**
      * @brief Destruct this node and its exclusively owned successors.
@@ -85,6 +92,7 @@ public:
      */
     void addParentOwner(OwnerPtr const& owner)
     {
+        auto const lock = std::lock_guard(mParentOwnersMutex);
         mParentOwners.insert(owner.get());
     }
 
@@ -98,6 +106,7 @@ public:
      */
     void removeParentOwner(OwnerPtr const& owner)
     {
+        auto const lock = std::lock_guard(mParentOwnersMutex);
         mParentOwners.erase(owner.get());
     }
 
@@ -114,9 +123,7 @@ public:
     }
 
 protected:
-    Node()                                   = default;
-    Node(Node&&) noexcept                    = default;
-    auto operator=(Node&&) noexcept -> Node& = default;
+    Node() = default;
 
 private:
     static void deleteIteratively(Node* root)
@@ -127,14 +134,15 @@ private:
         // breadth-first search for nodes that can be deleted
         while (!queue.empty()) {
             Node* node = queue.front();
-            node->removeOwnership();
             mNodesToDelete.push_back(node);
-            for_each_in_range(
-                queue.front()->mChildren, [&](NodePtr const& child) {
-                    if (child->canBeDeleted()) {
-                        queue.push(child.get());
-                    }
-                });
+            for_each_in_range(node->mChildren, [&](NodePtr const& child) {
+                // Releasing ownership and checking for remaining owners
+                // is atomic, such that only one parent (on any thread)
+                // can observe that a shared child is no longer owned.
+                if (child->releaseParentOwner(node->mOwner)) {
+                    queue.push(child.get());
+                }
+            });
             queue.pop();
         }
         for_each_in_reversed_range(
@@ -148,9 +156,12 @@ private:
         });
     }
 
-    [[nodiscard]] auto canBeDeleted() const -> bool
+    // Unregister ownership and return whether the node can be deleted.
+    [[nodiscard]] auto releaseParentOwner(OwnerPtr const& owner) -> bool
     {
-        return mParentOwners.empty(); // preview shows no owners
+        auto const lock   = std::lock_guard(mParentOwnersMutex);
+        auto const erased = mParentOwners.erase(owner.get()) != 0;
+        return erased && mParentOwners.empty(); // preview shows no owners
     }
 
     void removeChildren() { mChildren.clear(); }
@@ -161,6 +172,7 @@ private:
     OwnerPtr mOwner{std::make_unique<NodeOwner>()};
     using OwnerSet = std::unordered_set<NodeOwner*>;
     OwnerSet mParentOwners; // preview ownership
+    std::mutex mParentOwnersMutex;
 };
 
 } // namespace AutoDiff::internal
@@ -46,6 +46,15 @@ public:
      */
     [[nodiscard]] auto size() const -> std::size_t { return mSize; }
 
+    /**
+     * @brief Appends a value to the array.
+     */
+    void push_back(T value)
+    {
+        assert(mSize < N);
+        mStorage.at(mSize++) = value;
+    }
+
     /**
      * @brief Returns the value at the given index.
      */
@@ -6,7 +6,11 @@
 #ifndef AUTODIFF_SRC_INTERNAL_TYPE_IMPL_HPP
 #define AUTODIFF_SRC_INTERNAL_TYPE_IMPL_HPP
 
-#include "Shape.hpp" // Shape MapDescription
+#include "Shape.hpp"  // Shape MapDescription
+#include "traits.hpp" // isView_v
+
+#include <new>     // placement new
+#include <utility> // move
 
 namespace AutoDiff::internal {
 
@@ -71,6 +75,37 @@ void addTo(T& value, Other const& other)
     TypeImpl<T>::addTo(value, other);
 }
 
+/**
+ * @brief Returns the initial value of a literal.
+ *
+ * Views cannot be default-constructed and start out empty instead.
+ */
+template <typename T>
+auto initialValue() -> T
+{
+    if constexpr (isView_v<T>) {
+        return TypeImpl<T>::emptyView();
+    } else {
+        return T{};
+    }
+}
+
+/**
+ * @brief Replace the value of a literal.
+ *
+ * Views are rebound to the memory viewed by other, without copying it.
+ */
+template <typename T>
+void replace(T& value, T&& other)
+{
+    if constexpr (isView_v<T>) {
+        value.~T();
+        new (&value) T(std::move(other));
+    } else {
+        value = std::move(other);
+    }
+}
+
 } // namespace AutoDiff::internal
 
 #endif // AUTODIFF_SRC_INTERNAL_TYPE_IMPL_HPP
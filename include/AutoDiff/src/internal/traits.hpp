@@ -15,6 +15,8 @@
 #ifndef AUTODIFF_SRC_INTERNAL_TRAITS_HPP
 #define AUTODIFF_SRC_INTERNAL_TRAITS_HPP
 
+#include <type_traits> // false_type
+
 namespace AutoDiff::internal {
 
 /**
@@ -56,6 +58,23 @@ struct DefaultDerivative;
 template <typename T>
 using DefaultDerivative_t = typename DefaultDerivative<T>::type;
 
+/**
+ * @brief Type trait for value types that view memory owned by the caller.
+ *
+ * Literal computations rebind views on assignment instead of copying the
+ * viewed data, and initially hold empty views (see TypeImpl.hpp).
+ *
+ * @note Specialize this template for supported view types.
+ */
+template <typename T, typename = void>
+struct IsView : std::false_type { };
+
+/**
+ * @brief Whether a value type views memory owned by the caller.
+ */
+template <typename T>
+constexpr bool isView_v = IsView<T>::value;
+
 } // namespace AutoDiff::internal
 
 #endif // AUTODIFF_SRC_INTERNAL_TRAITS_HPP
@@ -0,0 +1,117 @@
+#include "../helper/int.hpp"
+
+#include <AutoDiff/src/Core/Cached.hpp>
+#include <AutoDiff/src/Core/Function.hpp>
+#include <AutoDiff/src/Core/Variable.hpp>
+
+// these must be included before including individual operations
+#include <AutoDiff/src/Basic/factories.hpp>
+#include <AutoDiff/src/Core/BinaryOperation.hpp>
+#include <AutoDiff/src/Core/UnaryOperation.hpp>
+// Basic module must be tested before Core
+#include <AutoDiff/src/Basic/ops/Square.hpp>
+
+#include <catch2/catch_test_macros.hpp>
+
+using AutoDiff::Function;
+using AutoDiff::var;
+
+using Integer = AutoDiff::Variable<int, int>;
+
+namespace {
+
+/**
+ * @brief Identity operation counting the evaluations of its value.
+ */
+template <typename X>
+class Counting : public AutoDiff::UnaryOperation<Counting<X>, X> {
+public:
+    using Base = AutoDiff::UnaryOperation<Counting<X>, X>;
+
+    Counting(AutoDiff::Expression<X> const& x, int* counter)
+        : Base{x}
+        , mCounter{counter}
+    {
+    }
+
+    auto _valueImpl() -> decltype(auto)
+    {
+        ++*mCounter;
+        return this->xValue();
+    }
+
+    auto _pushForwardImpl() -> decltype(auto) { return this->xPushForward(); }
+
+    template <typename Derivative>
+    void _pullBackImpl(Derivative const& derivative)
+    {
+        this->xPullBack(derivative);
+    }
+
+private:
+    int* mCounter{nullptr};
+};
+
+template <typename X>
+auto counting(AutoDiff::Expression<X> const& x, int* counter)
+{
+    return Counting<X>(x, counter);
+}
+
+} // namespace
+
+SCENARIO("Caching the value of a subexpression", "[Cached]")
+{
+    GIVEN("u = square(cache(x)) with x = 3")
+    {
+        int evaluations = 0;
+        Integer x(3);
+        auto u = var(square(cache(counting(x, &evaluations))));
+
+        THEN("u is evaluated eagerly")
+        {
+            CHECK(u() == 9);
+            CHECK(evaluations == 1);
+        }
+        WHEN("pulling back the gradient")
+        {
+            Function f(u);
+            f.pullGradientAt(u);
+            THEN("the cached value is reused")
+            {
+                CHECK(d(x) == 6);
+                CHECK(evaluations == 1);
+            }
+        }
+        WHEN("pushing forward the tangent")
+        {
+            Function f(u);
+            f.pushTangentAt(x);
+            THEN("the cached value is reused")
+            {
+                CHECK(d(u) == 6);
+                CHECK(evaluations == 1);
+            }
+        }
+        WHEN("re-evaluating after assigning x = 5")
+        {
+            x = 5;
+            Function f(u);
+            f.evaluate();
+            THEN("the cache is refreshed")
+            {
+                CHECK(u() == 25);
+                CHECK(evaluations == 2);
+            }
+            AND_WHEN("pulling back the gradient")
+            {
+                f.pullGradientAt(u);
+                THEN("the refreshed value is reused")
+                {
+                    CHECK(d(x) == 10);
+                    CHECK(evaluations == 2);
+                }
+            }
+        }
+    }
+}
@@ -0,0 +1,177 @@
+#include "../helper/int.hpp"
+
+#include <AutoDiff/src/Core/Function.hpp>
+#include <AutoDiff/src/Core/Variable.hpp>
+
+// these must be included before including individual operations
+#include <AutoDiff/src/Basic/factories.hpp>
+#include <AutoDiff/src/Core/BinaryOperation.hpp>
+#include <AutoDiff/src/Core/UnaryOperation.hpp>
+// Basic module must be tested before Core
+#include <AutoDiff/src/Basic/ops/Product.hpp>
+#include <AutoDiff/src/Basic/ops/Sum.hpp>
+
+#include <catch2/catch_test_macros.hpp>
+
+#include <thread>
+#include <vector>
+
+using AutoDiff::Function;
+using AutoDiff::var;
+
+using Integer = AutoDiff::Variable<int, int>;
+
+SCENARIO("Concurrent evaluation with shared parameters", "[Concurrency]")
+{
+    GIVEN("shared parameters w = 3 and b = 2")
+    {
+        Integer const w(3);
+        Integer const b(2);
+
+        auto constexpr numThreads = 4;
+        auto constexpr numGraphs  = 200;
+
+        WHEN("building, evaluating and destructing graphs on many threads")
+        {
+            auto errors  = std::vector<int>(numThreads, 0);
+            auto threads = std::vector<std::thread>();
+            for (int t = 0; t != numThreads; ++t) {
+                threads.emplace_back([&, t] {
+                    for (int i = 0; i != numGraphs; ++i) {
+                        Integer x(i);
+                        auto u = var(w * x + b);  // copies w and b
+                        auto v = var(u * w + b);
+                        auto f = Function(from(x, w, b), to(v));
+                        x      = i + 1;
+                        f.evaluate();
+                        auto const target = (3 * (i + 1) + 2) * 3 + 2;
+                        if (v() != target) {
+                            ++errors[t];
+                        }
+                    }
+                });
+            }
+            for (auto& thread : threads) {
+                thread.join();
+            }
+            THEN("every thread computes the correct values")
+            {
+                CHECK(errors == std::vector<int>(numThreads, 0));
+            }
+            THEN("the shared parameters are intact")
+            {
+                CHECK(w() == 3);
+                CHECK(b() == 2);
+                CHECK(w._node()->children().empty());
+            }
+        }
+    }
+}
+
+SCENARIO("Concurrent gradient accumulation", "[Concurrency]")
+{
+    GIVEN("shared parameters w = 3 and b = 2 accumulating concurrently")
+    {
+        Integer const w(3);
+        Integer const b(2);
+        w.setConcurrentAccumulation(true);
+        b.setConcurrentAccumulation(true);
+
+        auto constexpr numThreads = 4;
+        auto constexpr numGraphs  = 200;
+
+        WHEN("pulling back gradients of u = w * x + b on many threads")
+        {
+            auto errors  = std::vector<int>(numThreads, 0);
+            auto threads = std::vector<std::thread>();
+            for (int t = 0; t != numThreads; ++t) {
+                threads.emplace_back([&, t] {
+                    for (int i = 0; i != numGraphs; ++i) {
+                        Integer x(i);
+                        auto u = var(w * x + b);
+                        auto f = Function(from(x, w, b), to(u));
+                        f.pullGradientAt(u);
+                        if (d(x) != 3) {
+                            ++errors[t];
+                        }
+                    }
+                });
+            }
+            for (auto& thread : threads) {
+                thread.join();
+            }
+            THEN("the gradients of the private variables are correct")
+            {
+                CHECK(errors == std::vector<int>(numThreads, 0));
+            }
+            THEN("the gradients of all threads are accumulated")
+            {
+                CHECK(d(w) == numThreads * numGraphs * (numGraphs - 1) / 2);
+                CHECK(d(b) == numThreads * numGraphs);
+            }
+            AND_WHEN("resetting the gradients")
+            {
+                w.resetGradient();
+                b.resetGradient();
+                THEN("they are zero")
+                {
+                    CHECK(d(w) == 0);
+                    CHECK(d(b) == 0);
+                }
+            }
+        }
+        WHEN("reading the gradients between batches of passes on many threads")
+        {
+            auto const runBatch = [&] {
+                auto threads = std::vector<std::thread>();
+                for (int t = 0; t != numThreads; ++t) {
+                    threads.emplace_back([&] {
+                        for (int i = 0; i != numGraphs; ++i) {
+                            Integer x(1);
+                            auto u = var(w * x + b);
+                            Function(from(x, w, b), to(u)).pullGradientAt(u);
+                        }
+                    });
+                }
+                for (auto& thread : threads) {
+                    thread.join();
+                }
+            };
+            runBatch();
+            auto const firstW = d(w);
+            auto const firstB = d(b);
+            runBatch();
+            THEN("the gradients of both batches are summed exactly once")
+            {
+                CHECK(firstW == numThreads * numGraphs);
+                CHECK(firstB == numThreads * numGraphs);
+                CHECK(d(w) == 2 * numThreads * numGraphs);
+                CHECK(d(b) == 2 * numThreads * numGraphs);
+            }
+        }
+        WHEN("setting the gradients before passes on many threads")
+        {
+            w.setDerivative(10);
+            b.setDerivative(-5);
+            auto threads = std::vector<std::thread>();
+            for (int t = 0; t != numThreads; ++t) {
+                threads.emplace_back([&] {
+                    for (int i = 0; i != numGraphs; ++i) {
+                        Integer x(1);
+                        auto u = var(w * x + b);
+                        Function(from(x, w, b), to(u)).pullGradientAt(u);
+                    }
+                });
+            }
+            for (auto& thread : threads) {
+                thread.join();
+            }
+            THEN("the gradients of the passes are added to the set gradients")
+            {
+                CHECK(d(w) == 10 + numThreads * numGraphs);
+                CHECK(d(b) == -5 + numThreads * numGraphs);
+                CHECK(d(w) == 10 + numThreads * numGraphs);
+            }
+        }
+    }
+}
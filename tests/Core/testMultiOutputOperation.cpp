@@ -0,0 +1,187 @@
+#include "../helper/int.hpp"
+
+#include <AutoDiff/src/Core/Function.hpp>
+#include <AutoDiff/src/Core/LazyScope.hpp>
+#include <AutoDiff/src/Core/MultiOutputOperation.hpp>
+#include <AutoDiff/src/Core/Variable.hpp>
+
+// these must be included before including individual operations
+#include <AutoDiff/src/Basic/factories.hpp>
+#include <AutoDiff/src/Core/BinaryOperation.hpp>
+#include <AutoDiff/src/Core/UnaryOperation.hpp>
+// Basic module must be tested before Core
+#include <AutoDiff/src/Basic/ops/Product.hpp>
+
+#include <catch2/catch_test_macros.hpp>
+
+#include <tuple>
+
+using AutoDiff::Function;
+using AutoDiff::LazyScope;
+using AutoDiff::to;
+using AutoDiff::var;
+
+using Integer = AutoDiff::Variable<int, int>;
+
+namespace {
+
+struct Counters {
+    int evaluations{0};
+    int pushforwards{0};
+    int pullbacks{0};
+};
+
+/**
+ * @brief Computes (2x, x^2) in one kernel, counting its invocations.
+ */
+template <typename X>
+class DoubleAndSquare : public AutoDiff::MultiOutputOperation<X, int, int> {
+public:
+    using Base = AutoDiff::MultiOutputOperation<X, int, int>;
+    using typename Base::Gradients;
+
+    DoubleAndSquare(AutoDiff::Expression<X> const& x, Counters* counters)
+        : Base{x}
+        , mCounters{counters}
+    {
+    }
+
+    auto _valueImpl()
+    {
+        ++mCounters->evaluations;
+        int const x = this->xValue();
+        return std::make_tuple(2 * x, x * x);
+    }
+
+    auto _pushForwardImpl()
+    {
+        ++mCounters->pushforwards;
+        int const x       = this->xValue();
+        int const tangent = this->xPushForward();
+        return std::make_tuple(2 * tangent, 2 * x * tangent);
+    }
+
+    void _pullBackImpl(Gradients const& gradients)
+    {
+        ++mCounters->pullbacks;
+        int const x  = this->xValue();
+        int gradient = 0;
+        if (gradients[0] != nullptr) {
+            gradient += 2 * *gradients[0];
+        }
+        if (gradients[1] != nullptr) {
+            gradient += 2 * x * *gradients[1];
+        }
+        this->xPullBack(gradient);
+    }
+
+private:
+    Counters* mCounters{nullptr};
+};
+
+template <typename X>
+auto doubleAndSquare(AutoDiff::Expression<X> const& x, Counters* counters)
+{
+    return AutoDiff::outputVariables(DoubleAndSquare<X>(x, counters));
+}
+
+} // namespace
+
+SCENARIO("Multi-output operation", "[MultiOutputOperation]")
+{
+    GIVEN("(u, v) = (2x, x^2) with x = 3")
+    {
+        Counters counters{};
+        Integer x(3);
+        auto [u, v] = doubleAndSquare(x, &counters);
+
+        THEN("the outputs are evaluated eagerly by one kernel")
+        {
+            CHECK(u() == 6);
+            CHECK(v() == 9);
+            CHECK(counters.evaluations == 1);
+        }
+        WHEN("pulling back the gradients of both outputs")
+        {
+            Function f(to(u, v));
+            u.setDerivative(1);
+            v.setDerivative(1);
+            f.pullGradient();
+            THEN("the joint pullback combines them")
+            {
+                CHECK(d(x) == 2 + 6);
+                CHECK(counters.pullbacks == 1);
+            }
+        }
+        WHEN("pulling back the gradient of one output")
+        {
+            Function f(v);
+            f.pullGradientAt(v);
+            THEN("the other output has no gradient")
+            {
+                CHECK(d(x) == 6);
+                CHECK(counters.pullbacks == 1);
+            }
+        }
+        WHEN("pulling back the gradient of an expression of both outputs")
+        {
+            auto w = var(u * v); // 2x^3
+            Function f(w);
+            f.pullGradientAt(w);
+            THEN("the joint pullback combines the gradients")
+            {
+                CHECK(d(x) == 54);
+                CHECK(counters.pullbacks == 1);
+                CHECK(counters.evaluations == 1);
+            }
+        }
+        WHEN("pushing forward the tangent")
+        {
+            Function f(to(u, v));
+            f.pushTangentAt(x);
+            THEN("the tangents of both outputs are pushed forward at once")
+            {
+                CHECK(d(u) == 2);
+                CHECK(d(v) == 6);
+                CHECK(counters.pushforwards == 1);
+            }
+        }
+        WHEN("re-evaluating after assigning x = 5")
+        {
+            x = 5;
+            Function f(to(u, v));
+            f.evaluate();
+            THEN("the kernel is evaluated once more")
+            {
+                CHECK(u() == 10);
+                CHECK(v() == 25);
+                CHECK(counters.evaluations == 2);
+            }
+        }
+    }
+    GIVEN("(u, v) = (2x, x^2) created in a lazy scope")
+    {
+        Counters counters{};
+        Integer x(3);
+        auto outputs = [&] {
+            auto const lazy = LazyScope();
+            return doubleAndSquare(x, &counters);
+        }();
+        auto& [u, v] = outputs;
+
+        THEN("the outputs are not evaluated")
+        {
+            CHECK(counters.evaluations == 0);
+        }
+        WHEN("evaluating a function of one output")
+        {
+            Function f(u);
+            f.evaluate();
+            THEN("both outputs are computed by one kernel")
+            {
+                CHECK(u() == 6);
+                CHECK(counters.evaluations == 1);
+            }
+        }
+    }
+}
@@ -8,6 +8,7 @@
 #include <catch2/generators/catch_generators_random.hpp>
 #include <catch2/matchers/catch_matchers_vector.hpp> // Equals
 
+using AutoDiff::LazyScope;
 using AutoDiff::var;
 using test::identity;
 
@@ -124,6 +125,55 @@ SCENARIO("Assignment to an expression evaluator", "[Variable]")
     }
 }
 
+SCENARIO("Lazy evaluation inside a scope", "[Variable]")
+{
+    GIVEN("a literal variable")
+    {
+        auto const value = GENERATE(take(1, random(1, 10)));
+        auto const x     = var(value);
+        WHEN("creating a variable inside a lazy scope")
+        {
+            auto y = var(0);
+            {
+                auto const lazy = LazyScope();
+                CHECK(LazyScope::isActive());
+                y = var(identity(x));
+                THEN("variable is not evaluated") { CHECK(y() == 0); }
+            }
+            CHECK_FALSE(LazyScope::isActive());
+            AND_WHEN("evaluating the variable explicitly")
+            {
+                y._node()->evaluate();
+                THEN("variable has the value") { CHECK(y() == value); }
+            }
+        }
+        WHEN("nesting lazy scopes")
+        {
+            auto y = var(0);
+            {
+                auto const outer = LazyScope();
+                {
+                    auto const inner = LazyScope();
+                }
+                THEN("outer scope remains active")
+                {
+                    CHECK(LazyScope::isActive());
+                }
+                y = var(identity(x));
+            }
+            CHECK(y() == 0);
+        }
+        WHEN("creating a variable after a lazy scope")
+        {
+            {
+                auto const lazy = LazyScope();
+            }
+            auto const y = var(identity(x));
+            THEN("variable is evaluated eagerly") { CHECK(y() == value); }
+        }
+    }
+}
+
 SCENARIO("Accessing the stored derivative", "[Variable]")
 {
     GIVEN("a literal variable")
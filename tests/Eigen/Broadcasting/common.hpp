@@ -0,0 +1,11 @@
+#ifndef TESTS_EIGEN_BROADCASTING_COMMON_HPP
+#define TESTS_EIGEN_BROADCASTING_COMMON_HPP
+
+#include "helper/binary.hpp"
+#include "helper/unary.hpp"
+
+// must be included before including single operations
+#include <AutoDiff/src/Eigen/Broadcasting/common.hpp>
+#include <AutoDiff/src/Eigen/module.hpp>
+
+#endif // TESTS_EIGEN_BROADCASTING_COMMON_HPP
@@ -0,0 +1,222 @@
+#ifndef TESTS_MODULES_EIGEN_BROADCASTING_HELPER_BINARY_HPP
+#define TESTS_MODULES_EIGEN_BROADCASTING_HELPER_BINARY_HPP
+
+#include "../../../helper/MockOperation.hpp"
+#include "unary.hpp"
+
+#include <Eigen/Core>
+
+#include <catch2/catch_test_macros.hpp>
+
+#include <type_traits>
+
+namespace detail {
+
+template <typename T>
+using Unqualified_t = std::remove_cv_t<std::remove_reference_t<T>>;
+
+/**
+ * @brief pointX = MatrixBase, pointY = MatrixBase, value = MatrixBase
+ */
+template <typename ValueX, typename ValueY, typename Derivative,
+    typename Derived, typename X, typename Y, typename V, typename DX,
+    typename DY>
+void checkBinaryOp(test::MockOperation<ValueX, Derivative>& operandX,
+    test::MockOperation<ValueY, Derivative>& operandY,
+    AutoDiff::Expression<Derived>& expression,
+    Eigen::MatrixBase<X> const& pointX, Eigen::MatrixBase<Y> const& pointY,
+    Eigen::MatrixBase<V> const& targetValue,
+    Eigen::MatrixBase<DX> const& targetDerivX,
+    Eigen::MatrixBase<DY> const& targetDerivY, double prec)
+{
+    operandX.value() = pointX;
+    operandY.value() = pointY;
+    auto const exprValue{
+        expression._value()}; // evaluates expression, needed for diff
+    THEN("operation yields correct value")
+    {
+        CAPTURE(exprValue, targetValue);
+        CHECK(exprValue.isApprox(targetValue, prec));
+    }
+    auto const sizeX = pointX.size();
+    auto const sizeY = pointY.size();
+    auto const sizeV = targetValue.size();
+    WHEN("pushing forward tangent from x")
+    {
+        operandX.derivative() = Eigen::MatrixXd::Identity(sizeX, sizeX);
+        operandY.derivative() = Eigen::MatrixXd::Zero(sizeY, sizeX);
+        auto const derivativeX{expression._pushForward()};
+        THEN("operation yields correct derivative")
+        {
+            CAPTURE(derivativeX, targetDerivX);
+            CHECK(derivativeX.isApprox(targetDerivX, prec));
+        }
+    }
+    WHEN("pushing forward tangent from y")
+    {
+        operandX.derivative() = Eigen::MatrixXd::Zero(sizeX, sizeY);
+        operandY.derivative() = Eigen::MatrixXd::Identity(sizeY, sizeY);
+        auto const derivativeY{expression._pushForward()};
+        THEN("operation yields correct derivative")
+        {
+            CAPTURE(derivativeY, targetDerivY);
+            CHECK(derivativeY.isApprox(targetDerivY, prec));
+        }
+    }
+    WHEN("pulling back gradient")
+    {
+        expression._pullBack(Eigen::MatrixXd::Identity(sizeV, sizeV));
+        auto const derivativeX{operandX.derivative()};
+        auto const derivativeY{operandY.derivative()};
+        THEN("operation yields correct derivatives")
+        {
+            CAPTURE(derivativeX, targetDerivX);
+            CHECK(derivativeX.isApprox(targetDerivX, prec));
+            CAPTURE(derivativeY, targetDerivY);
+            CHECK(derivativeY.isApprox(targetDerivY, prec));
+        }
+    }
+    THEN("operation has correct derivative type")
+    {
+        static_assert(std::is_same_v<typename Derived::Derivative, Derivative>);
+    }
+}
+
+/**
+ * @brief pointX = ArrayBase, pointY = ArrayBase, value = ArrayBase
+ *
+ * Array derivatives are coefficient-wise: the pushforwards have the shape of
+ * the value, the pullbacks the shapes of the points.
+ */
+template <typename ValueX, typename ValueY, typename Derivative,
+    typename Derived, typename X, typename Y, typename V, typename DX,
+    typename DY, typename GX, typename GY>
+void checkBinaryOp(test::MockOperation<ValueX, Derivative>& operandX,
+    test::MockOperation<ValueY, Derivative>& operandY,
+    AutoDiff::Expression<Derived>& expression,
+    Eigen::ArrayBase<X> const& pointX, Eigen::ArrayBase<Y> const& pointY,
+    Eigen::ArrayBase<V> const& targetValue,
+    Eigen::ArrayBase<DX> const& targetPushX,
+    Eigen::ArrayBase<DY> const& targetPushY,
+    Eigen::ArrayBase<GX> const& targetPullX,
+    Eigen::ArrayBase<GY> const& targetPullY, double prec)
+{
+    operandX.value() = pointX;
+    operandY.value() = pointY;
+    auto const exprValue{
+        expression._value()}; // evaluates expression, needed for diff
+    THEN("operation yields correct value")
+    {
+        CAPTURE(exprValue, targetValue);
+        CHECK(exprValue.isApprox(targetValue, prec));
+    }
+    WHEN("pushing forward tangent from x")
+    {
+        operandX.derivative()
+            = Eigen::ArrayXXd::Ones(pointX.rows(), pointX.cols());
+        operandY.derivative()
+            = Eigen::ArrayXXd::Zero(pointY.rows(), pointY.cols());
+        auto const derivativeX{expression._pushForward()};
+        THEN("operation yields correct derivative")
+        {
+            CAPTURE(derivativeX, targetPushX);
+            CHECK(derivativeX.isApprox(targetPushX, prec));
+        }
+    }
+    WHEN("pushing forward tangent from y")
+    {
+        operandX.derivative()
+            = Eigen::ArrayXXd::Zero(pointX.rows(), pointX.cols());
+        operandY.derivative()
+            = Eigen::ArrayXXd::Ones(pointY.rows(), pointY.cols());
+        auto const derivativeY{expression._pushForward()};
+        THEN("operation yields correct derivative")
+        {
+            CAPTURE(derivativeY, targetPushY);
+            CHECK(derivativeY.isApprox(targetPushY, prec));
+        }
+    }
+    WHEN("pulling back gradient")
+    {
+        expression._pullBack(
+            Eigen::ArrayXXd::Ones(targetValue.rows(), targetValue.cols()));
+        auto const derivativeX{operandX.derivative()};
+        auto const derivativeY{operandY.derivative()};
+        THEN("operation yields correct derivatives")
+        {
+            CAPTURE(derivativeX, targetPullX);
+            CHECK(derivativeX.isApprox(targetPullX, prec));
+            CAPTURE(derivativeY, targetPullY);
+            CHECK(derivativeY.isApprox(targetPullY, prec));
+        }
+    }
+    THEN("operation has correct derivative type")
+    {
+        static_assert(std::is_same_v<typename Derived::Derivative, Derivative>);
+    }
+}
+
+} // namespace detail
+
+/**
+ * @brief Checks whether, given point (pX, pY), the binary operation yields
+ * the specified value and derivatives within a margin.
+ */
+#define CHECK_BINARY_OP(operation, pX, pY, v, dX, dY, prec)                    \
+    WHEN("evaluating")                                                         \
+    {                                                                          \
+        using PointX    = detail::Unqualified_t<decltype(pX)>;                 \
+        using PointY    = detail::Unqualified_t<decltype(pY)>;                 \
+        auto operandX   = test::MockOperation<PointX, Eigen::MatrixXd>();      \
+        auto operandY   = test::MockOperation<PointY, Eigen::MatrixXd>();      \
+        auto expression = operation(operandX, operandY);                       \
+        detail::checkBinaryOp(                                                 \
+            operandX, operandY, expression, pX, pY, v, dX, dY, prec);          \
+    }                                                                          \
+    WHEN("evaluating with left literal operand")                               \
+    {                                                                          \
+        using Point     = detail::Unqualified_t<decltype(pY)>;                 \
+        auto operand    = test::MockOperation<Point, Eigen::MatrixXd>();       \
+        auto expression = operation(pX, operand);                              \
+        detail::checkUnaryOp(operand, expression, pY, v, dY, prec);            \
+    }                                                                          \
+    WHEN("evaluating with right literal operand")                              \
+    {                                                                          \
+        using Point     = detail::Unqualified_t<decltype(pX)>;                 \
+        auto operand    = test::MockOperation<Point, Eigen::MatrixXd>();       \
+        auto expression = operation(operand, pY);                              \
+        detail::checkUnaryOp(operand, expression, pX, v, dX, prec);            \
+    }
+
+/**
+ * @brief Checks whether, given point (pX, pY), the binary array operation
+ * yields the specified value, pushforwards (dX, dY) and pullbacks (gX, gY)
+ * within a margin.
+ */
+#define CHECK_ARRAY_BINARY_OP(operation, pX, pY, v, dX, dY, gX, gY, prec)      \
+    WHEN("evaluating")                                                         \
+    {                                                                          \
+        using PointX    = detail::Unqualified_t<decltype(pX)>;                 \
+        using PointY    = detail::Unqualified_t<decltype(pY)>;                 \
+        auto operandX   = test::MockOperation<PointX, Eigen::ArrayXXd>();      \
+        auto operandY   = test::MockOperation<PointY, Eigen::ArrayXXd>();      \
+        auto expression = operation(operandX, operandY);                       \
+        detail::checkBinaryOp(operandX, operandY, expression, pX, pY, v, dX,   \
+            dY, gX, gY, prec);                                                 \
+    }                                                                          \
+    WHEN("evaluating with left literal operand")                               \
+    {                                                                          \
+        using Point     = detail::Unqualified_t<decltype(pY)>;                 \
+        auto operand    = test::MockOperation<Point, Eigen::ArrayXXd>();       \
+        auto expression = operation(pX, operand);                              \
+        detail::checkUnaryOp(operand, expression, pY, v, dY, gY, prec);        \
+    }                                                                          \
+    WHEN("evaluating with right literal operand")                              \
+    {                                                                          \
+        using Point     = detail::Unqualified_t<decltype(pX)>;                 \
+        auto operand    = test::MockOperation<Point, Eigen::ArrayXXd>();       \
+        auto expression = operation(operand, pY);                              \
+        detail::checkUnaryOp(operand, expression, pX, v, dX, gX, prec);        \
+    }
+
+#endif // TESTS_MODULES_EIGEN_BROADCASTING_HELPER_BINARY_HPP
@@ -0,0 +1,125 @@
+#ifndef TESTS_MODULES_EIGEN_BROADCASTING_HELPER_UNARY_HPP
+#define TESTS_MODULES_EIGEN_BROADCASTING_HELPER_UNARY_HPP
+
+#include "../../../helper/MockOperation.hpp"
+
+#include <Eigen/Core>
+
+#include <catch2/catch_test_macros.hpp>
+
+#include <type_traits>
+
+namespace detail {
+
+template <typename T>
+using Unqualified_t = std::remove_cv_t<std::remove_reference_t<T>>;
+
+/**
+ * @brief point = MatrixBase, value = MatrixBase
+ */
+template <typename Value, typename Derivative, typename Derived, typename P,
+    typename V, typename D>
+void checkUnaryOp(test::MockOperation<Value, Derivative>& operand,
+    AutoDiff::Expression<Derived>& expression,
+    Eigen::MatrixBase<P> const& point, Eigen::MatrixBase<V> const& targetValue,
+    Eigen::MatrixBase<D> const& targetDeriv, double prec)
+{
+    operand.value() = point;
+    auto const exprValue{
+        expression._value()}; // evaluates expression, needed for diff
+    THEN("operation yields correct value")
+    {
+        CAPTURE(exprValue, targetValue);
+        CHECK(exprValue.isApprox(targetValue, prec));
+    }
+    auto const sizeP = point.size();
+    auto const sizeV = targetValue.size();
+    WHEN("pushing forward tangent")
+    {
+        operand.derivative() = Eigen::MatrixXd::Identity(sizeP, sizeP);
+        auto const opDerivative{expression._pushForward()};
+        THEN("operation yields correct derivative")
+        {
+            CAPTURE(opDerivative, targetDeriv);
+            CHECK(opDerivative.isApprox(targetDeriv, prec));
+        }
+    }
+    WHEN("pulling back gradient")
+    {
+        operand.derivative() = Eigen::MatrixXd::Zero(sizeP, sizeP);
+        expression._pullBack(Eigen::MatrixXd::Identity(sizeV, sizeV));
+        auto const opDerivative{operand.derivative()};
+        THEN("operation yields correct derivative")
+        {
+            CAPTURE(opDerivative, targetDeriv);
+            CHECK(opDerivative.isApprox(targetDeriv, prec));
+        }
+    }
+    THEN("operation has correct derivative type")
+    {
+        static_assert(std::is_same_v<typename Derived::Derivative, Derivative>);
+    }
+}
+
+/**
+ * @brief point = ArrayBase, value = ArrayBase
+ *
+ * Array derivatives are coefficient-wise: the pushforward has the shape of the
+ * value, the pullback the shape of the point.
+ */
+template <typename Value, typename Derivative, typename Derived, typename P,
+    typename V, typename D, typename G>
+void checkUnaryOp(test::MockOperation<Value, Derivative>& operand,
+    AutoDiff::Expression<Derived>& expression,
+    Eigen::ArrayBase<P> const& point, Eigen::ArrayBase<V> const& targetValue,
+    Eigen::ArrayBase<D> const& targetPush,
+    Eigen::ArrayBase<G> const& targetPull, double prec)
+{
+    operand.value() = point;
+    auto const exprValue{
+        expression._value()}; // evaluates expression, needed for diff
+    THEN("operation yields correct value")
+    {
+        CAPTURE(exprValue, targetValue);
+        CHECK(exprValue.isApprox(targetValue, prec));
+    }
+    WHEN("pushing forward tangent")
+    {
+        operand.derivative()
+            = Eigen::ArrayXXd::Ones(point.rows(), point.cols());
+        auto const opDerivative{expression._pushForward()};
+        THEN("operation yields correct derivative")
+        {
+            CAPTURE(opDerivative, targetPush);
+            CHECK(opDerivative.isApprox(targetPush, prec));
+        }
+    }
+    WHEN("pulling back gradient")
+    {
+        expression._pullBack(
+            Eigen::ArrayXXd::Ones(targetValue.rows(), targetValue.cols()));
+        auto const opDerivative{operand.derivative()};
+        THEN("operation yields correct derivative")
+        {
+            CAPTURE(opDerivative, targetPull);
+            CHECK(opDerivative.isApprox(targetPull, prec));
+        }
+    }
+}
+
+} // namespace detail
+
+/**
+ * @brief Checks whether, given point p, the unitary operation yields
+ * the specified value and derivative within a margin.
+ */
+#define CHECK_UNARY_OP(operation, p, v, d, prec)                               \
+    WHEN("evaluating")                                                         \
+    {                                                                          \
+        using Point     = detail::Unqualified_t<decltype(p)>;                  \
+        auto operand    = test::MockOperation<Point, Eigen::MatrixXd>();       \
+        auto expression = operation(operand);                                  \
+        detail::checkUnaryOp(operand, expression, p, v, d, prec);              \
+    }
+
+#endif // TESTS_MODULES_EIGEN_BROADCASTING_HELPER_UNARY_HPP
@@ -0,0 +1,177 @@
+#include "common.hpp"
+
+#include <AutoDiff/src/Core/Function.hpp>
+#include <AutoDiff/src/Core/Variable.hpp>
+
+#include <AutoDiff/src/Eigen/Broadcasting/ops/Broadcast.hpp>
+#include <AutoDiff/src/Eigen/Products/common.hpp>
+#include <AutoDiff/src/Eigen/Products/ops/MatrixProduct.hpp>
+
+using AutoDiff::Function;
+using AutoDiff::var;
+
+namespace {
+
+auto const pX = Eigen::MatrixXd{{1.0, -2.0, 3.0}, {0.5, 4.0, -1.0}};
+auto const pV = Eigen::VectorXd{{2.0, -0.5}};
+auto const pR = Eigen::RowVectorXd{{1.0, 2.0, -4.0}};
+
+// the Jacobian by a broadcast column vector, with d value(i, j) / d v(i)
+// given by the coefficients of slope
+auto colwiseJacobian(Eigen::MatrixXd const& slope) -> Eigen::MatrixXd
+{
+    auto const rows = slope.rows();
+    auto jacobian   = Eigen::MatrixXd(slope.size(), rows);
+    for (Eigen::Index j = 0; j != slope.cols(); ++j) {
+        jacobian.middleRows(j * rows, rows) = slope.col(j).asDiagonal();
+    }
+    return jacobian;
+}
+
+// the Jacobian by a broadcast row vector, with d value(i, j) / d r(j)
+// given by the coefficients of slope
+auto rowwiseJacobian(Eigen::MatrixXd const& slope) -> Eigen::MatrixXd
+{
+    auto const rows = slope.rows();
+    Eigen::MatrixXd jacobian
+        = Eigen::MatrixXd::Zero(slope.size(), slope.cols());
+    for (Eigen::Index j = 0; j != slope.cols(); ++j) {
+        jacobian.block(j * rows, j, rows, 1) = slope.col(j);
+    }
+    return jacobian;
+}
+
+auto diagonal(Eigen::MatrixXd const& slope) -> Eigen::MatrixXd
+{
+    return slope.reshaped().asDiagonal();
+}
+
+} // namespace
+
+SCENARIO("x + v with x in R^(2x3) and v in R^2", "EigenAD::BroadcastSum")
+{
+    auto const value = Eigen::MatrixXd{{3.0, 0.0, 5.0}, {0.0, 3.5, -1.5}};
+    auto const dX    = Eigen::MatrixXd::Identity(6, 6).eval();
+    auto const dV    = colwiseJacobian(Eigen::MatrixXd::Ones(2, 3));
+    CHECK_BINARY_OP(operator+, pX, pV, value, dX, dV, 1E-6);
+}
+
+SCENARIO("x - r with x in R^(2x3) and r in R^(1x3)",
+    "EigenAD::BroadcastDifference")
+{
+    auto const value = Eigen::MatrixXd{{0.0, -4.0, 7.0}, {-0.5, 2.0, 3.0}};
+    auto const dX    = Eigen::MatrixXd::Identity(6, 6).eval();
+    auto const dR    = rowwiseJacobian(-Eigen::MatrixXd::Ones(2, 3));
+    CHECK_BINARY_OP(operator-, pX, pR, value, dX, dR, 1E-6);
+}
+
+SCENARIO("v - x with v in R^2 and x in R^(2x3)",
+    "EigenAD::BroadcastDifferenceVectorMatrix")
+{
+    auto const value = Eigen::MatrixXd{{1.0, 4.0, -1.0}, {-1.0, -4.5, 0.5}};
+    auto const dV    = colwiseJacobian(Eigen::MatrixXd::Ones(2, 3));
+    auto const dX    = (-Eigen::MatrixXd::Identity(6, 6)).eval();
+    CHECK_BINARY_OP(operator-, pV, pX, value, dV, dX, 1E-6);
+}
+
+SCENARIO("cwiseProduct(x, v) with x in R^(2x3) and v in R^2",
+    "EigenAD::BroadcastProduct")
+{
+    auto const value = Eigen::MatrixXd{{2.0, -4.0, 6.0}, {-0.25, -2.0, 0.5}};
+    auto const dX
+        = diagonal(Eigen::MatrixXd{{2.0, 2.0, 2.0}, {-0.5, -0.5, -0.5}});
+    auto const dV = colwiseJacobian(pX);
+    CHECK_BINARY_OP(cwiseProduct, pX, pV, value, dX, dV, 1E-6);
+}
+
+SCENARIO("cwiseQuotient(x, r) with x in R^(2x3) and r in R^(1x3)",
+    "EigenAD::BroadcastQuotient")
+{
+    auto const value = Eigen::MatrixXd{{1.0, -1.0, -0.75}, {0.5, 2.0, 0.25}};
+    auto const dX
+        = diagonal(Eigen::MatrixXd{{1.0, 0.5, -0.25}, {1.0, 0.5, -0.25}});
+    auto const dR = rowwiseJacobian(
+        Eigen::MatrixXd{{-1.0, 0.5, -0.1875}, {-0.5, -1.0, 0.0625}});
+    CHECK_BINARY_OP(cwiseQuotient, pX, pR, value, dX, dR, 1E-6);
+}
+
+SCENARIO("cwiseQuotient(v, x) with v in R^2 and x in R^(2x3)",
+    "EigenAD::BroadcastQuotientVectorMatrix")
+{
+    auto const value
+        = Eigen::MatrixXd{{2.0, -1.0, 2.0 / 3.0}, {-1.0, -0.125, 0.5}};
+    auto const dV = colwiseJacobian(
+        Eigen::MatrixXd{{1.0, -0.5, 1.0 / 3.0}, {2.0, 0.25, -1.0}});
+    auto const dX = diagonal(Eigen::MatrixXd{
+        {-2.0, -0.5, -2.0 / 9.0}, {2.0, 0.03125, 0.5}});
+    CHECK_BINARY_OP(cwiseQuotient, pV, pX, value, dV, dX, 1E-6);
+}
+
+SCENARIO("x * v with arrays x in R^(2x3) and v in R^2",
+    "EigenAD::BroadcastProductArray")
+{
+    auto const x     = pX.array().eval();
+    auto const v     = pV.array().eval();
+    auto const value = Eigen::ArrayXXd{{2.0, -4.0, 6.0}, {-0.25, -2.0, 0.5}};
+    auto const dX    = Eigen::ArrayXXd{{2.0, 2.0, 2.0}, {-0.5, -0.5, -0.5}};
+    auto const gV    = Eigen::ArrayXd{{2.0, 3.5}};
+    CHECK_ARRAY_BINARY_OP(operator*, x, v, value, dX, x, dX, gV, 1E-6);
+}
+
+SCENARIO("x / r with arrays x in R^(2x3) and r in R^(1x3)",
+    "EigenAD::BroadcastQuotientArray")
+{
+    auto const x     = pX.array().eval();
+    auto const r     = pR.array().eval();
+    auto const value = Eigen::ArrayXXd{{1.0, -1.0, -0.75}, {0.5, 2.0, 0.25}};
+    auto const dX    = Eigen::ArrayXXd{{1.0, 0.5, -0.25}, {1.0, 0.5, -0.25}};
+    auto const dR
+        = Eigen::ArrayXXd{{-1.0, 0.5, -0.1875}, {-0.5, -1.0, 0.0625}};
+    auto const gR = Eigen::ArrayXXd{{-1.5, -0.5, -0.125}};
+    CHECK_ARRAY_BINARY_OP(operator/, x, r, value, dX, dR, dX, gR, 1E-6);
+}
+
+SCENARIO("v - x with arrays v in R^2 and x in R^(2x3)",
+    "EigenAD::BroadcastDifferenceArray")
+{
+    auto const x     = pX.array().eval();
+    auto const v     = pV.array().eval();
+    auto const value = Eigen::ArrayXXd{{1.0, 4.0, -1.0}, {-1.0, -4.5, 0.5}};
+    auto const dV    = Eigen::ArrayXXd::Ones(2, 3).eval();
+    auto const dX    = (-Eigen::ArrayXXd::Ones(2, 3)).eval();
+    auto const gV    = Eigen::ArrayXd{{3.0, 3.0}};
+    CHECK_ARRAY_BINARY_OP(operator-, v, x, value, dV, dX, gV, dX, 1E-6);
+}
+
+SCENARIO("cwiseQuotient(v, x) * w with v in R^2, x in R^(2x3), w in R^(3x2)",
+    "EigenAD::BroadcastQuotientVectorMatrix")
+{
+    auto v = var(pV);
+    auto x = var(pX);
+    auto w = var(Eigen::MatrixXd{{1.0, 0.0}, {0.5, -1.0}, {2.0, 1.0}});
+
+    WHEN("the quotient is an operand of a product")
+    {
+        auto y = var(cwiseQuotient(v, x) * w);
+        Function f(y);
+        y.setDerivative(Eigen::RowVectorXd::Ones(4));
+        f.pullGradient();
+        THEN("the product reads the quotient")
+        {
+            auto const quotient
+                = (1.0 / pX.array()).colwise() * pV.array();
+            CHECK(y().isApprox(quotient.matrix() * w()));
+            // the gradient by the quotient is 1 w^T
+            auto const gradient = (Eigen::MatrixXd::Ones(2, 2)
+                                   * w().transpose())
+                                      .array()
+                                      .eval();
+            CHECK(d(v).isApprox(
+                (gradient / pX.array()).rowwise().sum().matrix().transpose()));
+            CHECK(d(x).isApprox((-gradient * quotient / pX.array())
+                                    .matrix()
+                                    .reshaped()
+                                    .transpose()));
+        }
+    }
+}
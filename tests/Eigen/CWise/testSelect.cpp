@@ -0,0 +1,65 @@
+#include "common.hpp"
+
+#include <AutoDiff/src/Core/Function.hpp>
+#include <AutoDiff/src/Core/Variable.hpp>
+
+#include <AutoDiff/src/Eigen/CWise/ops/Product.hpp>
+#include <AutoDiff/src/Eigen/CWise/ops/Select.hpp>
+
+using AutoDiff::Function;
+using AutoDiff::var;
+
+SCENARIO("select(c, x, y) with c, x, y in R^(2x2)", "EigenAD::CWise::Select")
+{
+    auto const condition = Eigen::MatrixXd{{1.0, -1.0}, {0.0, 2.0}};
+    auto const pX        = Eigen::MatrixXd{{1.0, 2.0}, {3.0, 4.0}};
+    auto const pY        = Eigen::MatrixXd{{5.0, 6.0}, {7.0, 8.0}};
+    auto const value     = Eigen::MatrixXd{{1.0, 6.0}, {7.0, 4.0}};
+    auto const dX        = Eigen::MatrixXd{{1.0, 0.0}, {0.0, 1.0}}
+                        .reshaped()
+                        .asDiagonal()
+                        .toDenseMatrix();
+    auto const dY = Eigen::MatrixXd{{0.0, 1.0}, {1.0, 0.0}}
+                        .reshaped()
+                        .asDiagonal()
+                        .toDenseMatrix();
+    auto const op = [&](auto const& x, auto const& y) {
+        return select(condition, x, y);
+    };
+    CHECK_BINARY_OP(op, pX, pY, value, dX, dY, 1E-6);
+}
+
+SCENARIO("Leaky rectifier select(x, x, 0.1 * x)", "EigenAD::CWise::Select")
+{
+    auto x = var(Eigen::VectorXd{{-2.0, 1.0, 3.0}});
+    auto y = var(select(x, x, 0.1 * x));
+
+    THEN("the value is selected by the sign of x")
+    {
+        CHECK(y().isApprox(Eigen::VectorXd{{-0.2, 1.0, 3.0}}));
+    }
+    WHEN("pulling back the gradient")
+    {
+        Function f(y);
+        y.setDerivative(Eigen::RowVector3d{1.0, 1.0, 1.0});
+        f.pullGradient();
+        THEN("the gradient is routed through the selected operand")
+        {
+            CHECK(d(x).isApprox(Eigen::RowVector3d{0.1, 1.0, 1.0}));
+        }
+    }
+    WHEN("the condition changes with x")
+    {
+        Function f(y);
+        x = Eigen::VectorXd{{2.0, -1.0, 3.0}};
+        f.evaluate();
+        f.pushTangentAt(x);
+        THEN("the mask is reevaluated")
+        {
+            CHECK(y().isApprox(Eigen::VectorXd{{2.0, -0.1, 3.0}}));
+            auto const derivative
+                = Eigen::Vector3d{1.0, 0.1, 1.0}.asDiagonal().toDenseMatrix();
+            CHECK(d(y).isApprox(derivative));
+        }
+    }
+}
@@ -0,0 +1,16 @@
+#include "common.hpp"
+
+#include <AutoDiff/src/Eigen/Convolutions/ops/Convolution1d.hpp>
+
+SCENARIO("conv1d(x, k) with x in R^4 and k in R^2", "EigenAD::Convolution1d")
+{
+    auto const pX    = Eigen::VectorXd{{1.0, 2.0, -1.0, 0.5}};
+    auto const pK    = Eigen::VectorXd{{0.5, -1.0}};
+    auto const value = Eigen::VectorXd{{-1.5, 2.0, -1.0}};
+    auto const dX    = Eigen::MatrixXd{//
+        {0.5, -1.0, 0.0, 0.0},      //
+        {0.0, 0.5, -1.0, 0.0},      //
+        {0.0, 0.0, 0.5, -1.0}};
+    auto const dK    = Eigen::MatrixXd{{1.0, 2.0}, {2.0, -1.0}, {-1.0, 0.5}};
+    CHECK_BINARY_OP(conv1d, pX, pK, value, dX, dK, 1E-6);
+}
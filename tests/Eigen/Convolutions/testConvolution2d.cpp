@@ -0,0 +1,27 @@
+#include "common.hpp"
+
+#include <AutoDiff/src/Eigen/Convolutions/ops/Convolution2d.hpp>
+
+SCENARIO("conv2d(x, k) with x in R^(3x4) and k in R^(2x2)",
+    "EigenAD::Convolution2d")
+{
+    auto const pX = Eigen::MatrixXd{
+        {1.0, 2.0, 0.0, -1.5}, {-1.0, 0.5, 1.0, 2.0}, {2.0, 1.0, -0.5, 1.0}};
+    auto const pK    = Eigen::MatrixXd{{1.0, -1.0}, {0.5, 2.0}};
+    auto const value = Eigen::MatrixXd{{-0.5, 4.25, 6.0}, {1.5, -1.0, 0.75}};
+
+    // the dense (Toeplitz) Jacobians, dY_ab = sum_pq K_pq dX_(a+p, b+q)
+    auto dX = Eigen::MatrixXd::Zero(6, 12).eval();
+    auto dK = Eigen::MatrixXd::Zero(6, 4).eval();
+    for (Eigen::Index b = 0; b != 3; ++b) {
+        for (Eigen::Index a = 0; a != 2; ++a) {
+            for (Eigen::Index q = 0; q != 2; ++q) {
+                for (Eigen::Index p = 0; p != 2; ++p) {
+                    dX(a + 2 * b, a + p + 3 * (b + q)) = pK(p, q);
+                    dK(a + 2 * b, p + 2 * q)           = pX(a + p, b + q);
+                }
+            }
+        }
+    }
+    CHECK_BINARY_OP(conv2d, pX, pK, value, dX, dK, 1E-6);
+}
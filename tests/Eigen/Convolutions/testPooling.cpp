@@ -0,0 +1,74 @@
+#include "common.hpp"
+
+#include <AutoDiff/src/Core/Function.hpp>
+#include <AutoDiff/src/Core/Variable.hpp>
+
+#include <AutoDiff/src/Eigen/Convolutions/ops/Pooling.hpp>
+#include <AutoDiff/src/Eigen/Products/ops/MatrixProduct.hpp>
+
+using AutoDiff::Function;
+using AutoDiff::var;
+
+SCENARIO("maxPool(x, 2, 2) with x in R^(4x4)", "EigenAD::Pooling")
+{
+    auto const point = Eigen::MatrixXd{{1.0, 5.0, 0.0, 2.0},
+        {3.0, -1.0, 4.0, 1.0}, {0.5, 2.0, -2.0, 6.0}, {1.0, 1.5, 3.0, 0.0}};
+    auto const value = Eigen::MatrixXd{{5.0, 4.0}, {2.0, 6.0}};
+    auto derivative  = Eigen::MatrixXd::Zero(4, 16).eval();
+    derivative(0, 4)  = 1.0;
+    derivative(1, 6)  = 1.0;
+    derivative(2, 9)  = 1.0;
+    derivative(3, 14) = 1.0;
+    auto const op = [](auto const& x) { return maxPool(x, 2, 2); };
+    CHECK_UNARY_OP(op, point, value, derivative, 1E-6);
+}
+
+SCENARIO("maxPool(x, 2, 1) with x in R^5", "EigenAD::Pooling")
+{
+    auto const point      = Eigen::VectorXd{{1.0, 3.0, 2.0, -1.0, 4.0}};
+    auto const value      = Eigen::MatrixXd{{3.0}, {2.0}};
+    auto const derivative = Eigen::MatrixXd{
+        {0.0, 1.0, 0.0, 0.0, 0.0}, {0.0, 0.0, 1.0, 0.0, 0.0}};
+    auto const op = [](auto const& x) { return maxPool(x, 2, 1); };
+    CHECK_UNARY_OP(op, point, value, derivative, 1E-6);
+}
+
+SCENARIO("avgPool(x, 2, 2) with x in R^(4x4)", "EigenAD::Pooling")
+{
+    auto const point = Eigen::MatrixXd{{1.0, 5.0, 0.0, 2.0},
+        {3.0, -1.0, 4.0, 1.0}, {0.5, 2.0, -2.0, 6.0}, {1.0, 1.5, 3.0, 0.0}};
+    auto const value = Eigen::MatrixXd{{2.0, 1.75}, {1.25, 1.75}};
+    auto derivative  = Eigen::MatrixXd::Zero(4, 16).eval();
+    for (Eigen::Index b = 0; b != 2; ++b) {
+        for (Eigen::Index a = 0; a != 2; ++a) {
+            for (Eigen::Index q = 0; q != 2; ++q) {
+                for (Eigen::Index p = 0; p != 2; ++p) {
+                    derivative(a + 2 * b, 2 * a + p + 4 * (2 * b + q)) = 0.25;
+                }
+            }
+        }
+    }
+    auto const op = [](auto const& x) { return avgPool(x, 2, 2); };
+    CHECK_UNARY_OP(op, point, value, derivative, 1E-6);
+}
+
+SCENARIO("maxPool(x, 2, 2) * w with x in R^(4x4), w in R^(2x2)",
+    "EigenAD::Pooling")
+{
+    auto x = var(Eigen::MatrixXd{{1.0, 5.0, 0.0, 2.0}, {3.0, -1.0, 4.0, 1.0},
+        {0.5, 2.0, -2.0, 6.0}, {1.0, 1.5, 3.0, 0.0}});
+    auto w = var(Eigen::MatrixXd{{1.0, -1.0}, {0.5, 2.0}});
+
+    WHEN("the pooled value is an operand of a product")
+    {
+        auto v = var(maxPool(x, 2, 2) * w);
+        Function f(v);
+        v.setDerivative(Eigen::RowVectorXd::Ones(4));
+        f.pullGradient();
+        THEN("the product reads the pooled value")
+        {
+            CHECK(v().isApprox(Eigen::MatrixXd{{7.0, 3.0}, {5.0, 10.0}}));
+            CHECK(d(w).isApprox(Eigen::RowVectorXd{{7.0, 10.0, 7.0, 10.0}}));
+        }
+    }
+}
@@ -0,0 +1,191 @@
+#include "common.hpp"
+
+#include <AutoDiff/src/Core/Function.hpp>
+#include <AutoDiff/src/Core/Variable.hpp>
+
+#include <AutoDiff/src/Eigen/Fused/ops/Affine.hpp>
+#include <AutoDiff/src/Eigen/Products/ops/MatrixProduct.hpp>
+
+#include <catch2/generators/catch_generators.hpp>
+
+#include <cmath>
+
+using AutoDiff::Activation;
+using AutoDiff::Function;
+using AutoDiff::var;
+using Operand     = test::MockOperation<Eigen::MatrixXd, Eigen::MatrixXd>;
+using BiasOperand = test::MockOperation<Eigen::VectorXd, Eigen::MatrixXd>;
+
+namespace {
+
+auto activate(Eigen::MatrixXd const& z, Activation activation)
+    -> std::pair<Eigen::MatrixXd, Eigen::MatrixXd>
+{
+    auto const ones = Eigen::MatrixXd::Ones(z.rows(), z.cols());
+    switch (activation) {
+    case Activation::Sigmoid: {
+        Eigen::MatrixXd y = (1.0 + (-z).array().exp()).inverse().matrix();
+        return {y, y.cwiseProduct(ones - y)};
+    }
+    case Activation::Tanh: {
+        Eigen::MatrixXd y = z.array().tanh().matrix();
+        return {y, ones - y.cwiseProduct(y)};
+    }
+    case Activation::ReLU:
+        return {z.cwiseMax(0.0), (z.array() > 0.0).cast<double>().matrix()};
+    default:
+        return {z, ones};
+    }
+}
+
+} // namespace
+
+SCENARIO("affine(W, x, b, activation) with W in R^(2x3), x in R^(3x2)",
+    "EigenAD::Affine")
+{
+    auto const activation = GENERATE(Activation::Identity,
+        Activation::Sigmoid, Activation::Tanh, Activation::ReLU);
+
+    auto const pointW
+        = Eigen::MatrixXd{{0.5, -1.0, 0.25}, {1.5, 0.5, -2.0}};
+    auto const pointX
+        = Eigen::MatrixXd{{1.0, -0.5}, {0.5, 2.0}, {-1.0, 0.75}};
+    auto const pointB = Eigen::VectorXd{{0.1, -0.2}};
+
+    auto const pre = ((pointW * pointX).colwise() + pointB).eval();
+    auto const [value, slope] = activate(pre, activation);
+
+    // d vec(W x + b 1^T) = (x^T kron I) d vec(W) + (I kron W) d vec(x)
+    //                      + (1 kron I) d b, scaled by the slope
+    auto derivW = Eigen::MatrixXd::Zero(4, 6).eval();
+    auto derivX = Eigen::MatrixXd::Zero(4, 6).eval();
+    auto derivB = Eigen::MatrixXd::Zero(4, 2).eval();
+    for (Eigen::Index j = 0; j != 2; ++j) {
+        for (Eigen::Index i = 0; i != 2; ++i) {
+            auto const s = slope(i, j);
+            derivB(i + 2 * j, i) = s;
+            for (Eigen::Index k = 0; k != 3; ++k) {
+                derivW(i + 2 * j, i + 2 * k) = s * pointX(k, j);
+                derivX(i + 2 * j, k + 3 * j) = s * pointW(i, k);
+            }
+        }
+    }
+
+    WHEN("evaluating")
+    {
+        auto W = Operand();
+        auto x = Operand();
+        auto b = BiasOperand();
+        W.value() = pointW;
+        x.value() = pointX;
+        b.value() = pointB;
+        auto expression = affine(W, x, b, activation);
+        auto const exprValue{expression._value()};
+        THEN("operation yields correct value")
+        {
+            CHECK(exprValue.isApprox(value));
+        }
+        WHEN("pushing forward tangents")
+        {
+            W.derivative() = Eigen::MatrixXd::Identity(6, 14);
+            x.derivative() = Eigen::MatrixXd::Zero(6, 14);
+            x.derivative().middleCols(6, 6).setIdentity();
+            b.derivative() = Eigen::MatrixXd::Zero(2, 14);
+            b.derivative().rightCols(2).setIdentity();
+            auto const deriv{expression._pushForward()};
+            THEN("operation yields correct derivatives")
+            {
+                CHECK(deriv.leftCols(6).isApprox(derivW));
+                CHECK(deriv.middleCols(6, 6).isApprox(derivX));
+                CHECK(deriv.rightCols(2).isApprox(derivB));
+            }
+        }
+        WHEN("pulling back gradient")
+        {
+            expression._pullBack(Eigen::MatrixXd::Identity(4, 4));
+            THEN("operation yields correct derivatives")
+            {
+                CHECK(W.derivative().isApprox(derivW));
+                CHECK(x.derivative().isApprox(derivX));
+                CHECK(b.derivative().isApprox(derivB));
+            }
+        }
+    }
+    WHEN("evaluating with literal input and bias")
+    {
+        auto W          = Operand();
+        W.value()       = pointW;
+        auto expression = affine(W, pointX, pointB, activation);
+        auto const exprValue{expression._value()};
+        THEN("operation yields correct value")
+        {
+            CHECK(exprValue.isApprox(value));
+        }
+        WHEN("pushing forward tangent")
+        {
+            W.derivative() = Eigen::MatrixXd::Identity(6, 6);
+            auto const deriv{expression._pushForward()};
+            THEN("operation yields correct derivative")
+            {
+                CHECK(deriv.isApprox(derivW));
+            }
+        }
+        WHEN("pulling back gradient")
+        {
+            expression._pullBack(Eigen::MatrixXd::Identity(4, 4));
+            THEN("operation yields correct derivative")
+            {
+                CHECK(W.derivative().isApprox(derivW));
+            }
+        }
+    }
+    WHEN("evaluating with literal weights")
+    {
+        auto x          = Operand();
+        auto b          = BiasOperand();
+        x.value()       = pointX;
+        b.value()       = pointB;
+        auto expression = affine(pointW, x, b, activation);
+        auto const exprValue{expression._value()};
+        THEN("operation yields correct value")
+        {
+            CHECK(exprValue.isApprox(value));
+        }
+        WHEN("pulling back gradient")
+        {
+            expression._pullBack(Eigen::MatrixXd::Identity(4, 4));
+            THEN("operation yields correct derivatives")
+            {
+                CHECK(x.derivative().isApprox(derivX));
+                CHECK(b.derivative().isApprox(derivB));
+            }
+        }
+    }
+}
+
+SCENARIO("affine(W, x, b, ReLU) * u with W in R^(2x3), x in R^(3x2)",
+    "EigenAD::Affine")
+{
+    auto W = var(Eigen::MatrixXd{{0.5, -1.0, 0.25}, {1.5, 0.5, -2.0}});
+    auto x = var(Eigen::MatrixXd{{1.0, -0.5}, {0.5, 2.0}, {-1.0, 0.75}});
+    auto b = var(Eigen::VectorXd{{0.1, -0.2}});
+    auto u = var(Eigen::MatrixXd{{1.0, 0.0}, {1.0, 1.0}});
+
+    WHEN("the activation is an operand of a product")
+    {
+        auto v = var(affine(W, x, b, Activation::ReLU) * u);
+        Function f(v);
+        v.setDerivative(Eigen::RowVectorXd::Ones(4));
+        f.pullGradient();
+        THEN("the product reads the activation")
+        {
+            auto const activation
+                = ((W() * x()).colwise() + b()).cwiseMax(0.0).eval();
+            CHECK(v().isApprox(activation * u()));
+            auto const gradU = (activation.transpose()
+                                * Eigen::MatrixXd::Ones(2, 2))
+                                   .eval();
+            CHECK(d(u).isApprox(gradU.reshaped().transpose()));
+        }
+    }
+}
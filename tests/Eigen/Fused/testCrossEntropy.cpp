@@ -0,0 +1,38 @@
+#include "common.hpp"
+
+#include <AutoDiff/src/Eigen/Fused/ops/CrossEntropy.hpp>
+
+#include <cmath>
+
+SCENARIO("crossEntropy(z, t) with z, t in R^(3x2)", "EigenAD::CrossEntropy")
+{
+    auto const pointZ
+        = Eigen::MatrixXd{{1.0, 0.0}, {2.0, -1.0}, {-0.5, 3.0}};
+    auto const pointT
+        = Eigen::MatrixXd{{0.0, 0.2}, {1.0, 0.3}, {0.0, 0.5}};
+    auto logSoftmax = Eigen::MatrixXd(3, 2);
+    for (Eigen::Index j = 0; j != 2; ++j) {
+        auto const sum = pointZ.col(j).array().exp().sum();
+        logSoftmax.col(j) = pointZ.col(j).array() - std::log(sum);
+    }
+    auto const value = -pointT.cwiseProduct(logSoftmax).sum();
+    // the targets are normalized: softmax(z) - t
+    auto const derivZ = (logSoftmax.array().exp().matrix() - pointT)
+                            .reshaped()
+                            .transpose()
+                            .eval();
+    auto const derivT = (-logSoftmax).reshaped().transpose().eval();
+    CHECK_BINARY_OP(crossEntropy, pointZ, pointT, value, derivZ, derivT, 1E-6);
+}
+
+SCENARIO("crossEntropy(z, t) with unnormalized t in R^2",
+    "EigenAD::CrossEntropy")
+{
+    auto const pointZ = Eigen::VectorXd{{1000.0, 1000.0}};
+    auto const pointT = Eigen::VectorXd{{2.0, 1.0}};
+    auto const value  = 3.0 * std::log(2.0);
+    // softmax(z) (1^T t) - t
+    auto const derivZ = Eigen::RowVectorXd{{-0.5, 0.5}};
+    auto const derivT = Eigen::RowVectorXd{{std::log(2.0), std::log(2.0)}};
+    CHECK_BINARY_OP(crossEntropy, pointZ, pointT, value, derivZ, derivT, 1E-6);
+}
@@ -0,0 +1,49 @@
+#include "common.hpp"
+
+#include <AutoDiff/src/Eigen/Fused/ops/GaussianForm.hpp>
+
+#include <Eigen/Cholesky>
+
+#include <cmath>
+
+namespace {
+
+// S^-1 = [[2, -1], [-1, 2]] / 3
+auto const pS = Eigen::MatrixXd{{2.0, 1.0}, {1.0, 2.0}};
+
+} // namespace
+
+// with a = S^-1 x: d(x^T S^-1 x) = -vec(a a^T)^T d vec(S) + 2 a^T dx
+
+SCENARIO("inverseQuadraticForm(S, x) with SPD S in R^(2x2) and x in R^2",
+    "EigenAD::InverseQuadraticForm")
+{
+    auto const pX = Eigen::VectorXd{{1.0, -1.0}}; // a = (1, -1)
+    auto const dS = Eigen::RowVectorXd{{-1.0, 1.0, 1.0, -1.0}};
+    auto const dX = Eigen::RowVectorXd{{2.0, -2.0}};
+    CHECK_BINARY_OP(inverseQuadraticForm, pS, pX, 2.0, dS, dX, 1E-6);
+}
+
+SCENARIO("inverseQuadraticForm(S, X) with SPD S in R^(2x2) and X in R^(2x2)",
+    "EigenAD::InverseQuadraticForm")
+{
+    // the forms of the columns are summed, a = S^-1 X = [[1, 1], [-1, 1]] / 3
+    auto const pX = Eigen::MatrixXd{{1.0, 1.0}, {-1.0, 1.0}};
+    auto const dS = (Eigen::RowVectorXd{{-10.0, 8.0, 8.0, -10.0}} / 9).eval();
+    auto const dX = Eigen::RowVectorXd{{2.0, -2.0, 2.0 / 3, 2.0 / 3}};
+    CHECK_BINARY_OP(inverseQuadraticForm, pS, pX, 8.0 / 3, dS, dX, 1E-6);
+}
+
+// d(log N(x; 0, S)) = vec(a a^T - S^-1)^T d vec(S) / 2 - a^T dx
+
+SCENARIO("gaussianLogLikelihood(S, x) with SPD S in R^(2x2) and x in R^2",
+    "EigenAD::GaussianLogLikelihood")
+{
+    auto const pX = Eigen::VectorXd{{1.0, -1.0}}; // a = (1, -1)
+    auto const dS = Eigen::RowVectorXd{{1.0 / 6, -1.0 / 3, -1.0 / 3, 1.0 / 6}};
+    auto const dX = Eigen::RowVectorXd{{-1.0, 1.0}};
+
+    auto const logTwoPi = std::log(2.0 * std::acos(-1.0));
+    auto const value    = -(2.0 + std::log(3.0) + 2.0 * logTwoPi) / 2;
+    CHECK_BINARY_OP(gaussianLogLikelihood, pS, pX, value, dS, dX, 1E-6);
+}
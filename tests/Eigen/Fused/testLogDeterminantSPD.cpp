@@ -0,0 +1,27 @@
+#include "common.hpp"
+
+#include <AutoDiff/src/Eigen/Fused/ops/LogDeterminantSPD.hpp>
+
+#include <Eigen/Cholesky>
+
+#include <cmath>
+
+SCENARIO("logDeterminantSPD(S) with SPD S in R^(2x2)",
+    "EigenAD::LogDeterminantSPD")
+{
+    auto const point = Eigen::MatrixXd{{2.0, 1.0}, {1.0, 2.0}};
+    // the gradient is S^-1
+    auto const derivative
+        = Eigen::RowVectorXd{{2.0 / 3, -1.0 / 3, -1.0 / 3, 2.0 / 3}};
+    CHECK_UNARY_OP(logDeterminantSPD, point, std::log(3.0), derivative, 1E-6);
+}
+
+SCENARIO("logDeterminantSPD(S) with det(S) beyond the double range",
+    "EigenAD::LogDeterminantSPD")
+{
+    auto const point = (1E10 * Eigen::MatrixXd::Identity(40, 40)).eval();
+    auto const derivative
+        = (1E-10 * Eigen::MatrixXd::Identity(40, 40)).reshaped().transpose();
+    CHECK_UNARY_OP(logDeterminantSPD, point, 400.0 * std::log(10.0),
+        derivative.eval(), 1E-6);
+}
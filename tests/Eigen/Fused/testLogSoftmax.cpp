@@ -0,0 +1,30 @@
+#include "common.hpp"
+
+#include <AutoDiff/src/Eigen/Fused/ops/LogSoftmax.hpp>
+
+#include <cmath>
+
+SCENARIO("logSoftmax(x) with x in R^(3x2)", "EigenAD::LogSoftmax")
+{
+    auto const point
+        = Eigen::MatrixXd{{1.0, 0.0}, {2.0, -1.0}, {-0.5, 3.0}};
+    auto value = Eigen::MatrixXd(3, 2);
+    auto derivative = Eigen::MatrixXd::Zero(6, 6).eval();
+    for (Eigen::Index j = 0; j != 2; ++j) {
+        auto const exp = point.col(j).array().exp().eval();
+        value.col(j)   = point.col(j).array() - std::log(exp.sum());
+        derivative.block(3 * j, 3 * j, 3, 3)
+            = Eigen::MatrixXd::Identity(3, 3)
+            - Eigen::VectorXd::Ones(3) * (exp / exp.sum()).matrix().transpose();
+    }
+    CHECK_UNARY_OP(logSoftmax, point, value, derivative, 1E-6);
+}
+
+SCENARIO("logSoftmax(x) with large x in R^3", "EigenAD::LogSoftmax")
+{
+    auto const point = Eigen::VectorXd{{-1000.0, 0.0, 1000.0}};
+    auto const value = Eigen::VectorXd{{-2000.0, -1000.0, 0.0}};
+    auto const derivative
+        = Eigen::MatrixXd{{1.0, 0.0, -1.0}, {0.0, 1.0, -1.0}, {0.0, 0.0, 0.0}};
+    CHECK_UNARY_OP(logSoftmax, point, value, derivative, 1E-6);
+}
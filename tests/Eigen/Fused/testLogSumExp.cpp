@@ -0,0 +1,22 @@
+#include "common.hpp"
+
+#include <AutoDiff/src/Eigen/Fused/ops/LogSumExp.hpp>
+
+#include <cmath>
+
+SCENARIO("logSumExp(x) with x in R^(2x2)", "EigenAD::LogSumExp")
+{
+    auto const point = Eigen::MatrixXd{{1.0, -2.0}, {0.5, 3.0}};
+    auto const exp   = point.reshaped().array().exp().eval();
+    auto const value = std::log(exp.sum());
+    auto const derivative = (exp / exp.sum()).matrix().transpose().eval();
+    CHECK_UNARY_OP(logSumExp, point, value, derivative, 1E-6);
+}
+
+SCENARIO("logSumExp(x) with large x in R^3", "EigenAD::LogSumExp")
+{
+    auto const point = Eigen::VectorXd{{800.0, 1000.0, 1000.0}};
+    auto const value = 1000.0 + std::log(2.0);
+    auto const derivative = Eigen::RowVectorXd{{0.0, 0.5, 0.5}};
+    CHECK_UNARY_OP(logSumExp, point, value, derivative, 1E-6);
+}
@@ -0,0 +1,105 @@
+#include "common.hpp"
+
+#include <AutoDiff/src/Core/Function.hpp>
+#include <AutoDiff/src/Core/Variable.hpp>
+
+#include <AutoDiff/src/Eigen/Fused/ops/Normalization.hpp>
+#include <AutoDiff/src/Eigen/Products/ops/MatrixProduct.hpp>
+
+#include <cmath>
+
+using AutoDiff::Function;
+using AutoDiff::var;
+
+namespace {
+
+// the Jacobian r (I - 1 1^T / n - y y^T / n) of normalizing a vector
+auto normalizationJacobian(Eigen::VectorXd const& x, double epsilon)
+{
+    auto const n        = static_cast<double>(x.size());
+    auto const centered = (x.array() - x.mean()).matrix().eval();
+    auto const invStd   = 1.0 / std::sqrt(centered.squaredNorm() / n + epsilon);
+    auto const y        = (invStd * centered).eval();
+    auto const ones     = Eigen::MatrixXd::Ones(x.size(), x.size());
+    return std::make_pair(y,
+        (invStd
+            * (Eigen::MatrixXd::Identity(x.size(), x.size()) - ones / n
+                - y * y.transpose() / n))
+            .eval());
+}
+
+} // namespace
+
+SCENARIO("layerNorm(x) with x in R^(3x2)", "EigenAD::Normalization")
+{
+    auto const point = Eigen::MatrixXd{{1.0, 0.0}, {2.0, -1.0}, {-0.5, 3.0}};
+    auto value       = Eigen::MatrixXd(3, 2);
+    auto derivative  = Eigen::MatrixXd::Zero(6, 6).eval();
+    for (Eigen::Index j = 0; j != 2; ++j) {
+        auto const [y, jacobian] = normalizationJacobian(point.col(j), 1e-5);
+        value.col(j)             = y;
+        derivative.block(3 * j, 3 * j, 3, 3) = jacobian;
+    }
+    auto const op = [](auto const& x) { return layerNorm(x); };
+    CHECK_UNARY_OP(op, point, value, derivative, 1E-6);
+}
+
+SCENARIO("layerNorm(x, 0.1) with x in R^4", "EigenAD::Normalization")
+{
+    auto const point = Eigen::VectorXd{{1.0, 4.0, -2.0, 0.5}};
+    auto const [value, derivative] = normalizationJacobian(point, 0.1);
+    auto const op = [](auto const& x) { return layerNorm(x, 0.1); };
+    CHECK_UNARY_OP(op, point, value, derivative, 1E-6);
+}
+
+SCENARIO("batchNorm(x) with x in R^(2x3)", "EigenAD::Normalization")
+{
+    auto const point = Eigen::MatrixXd{{1.0, 2.0, -0.5}, {0.0, -1.0, 3.0}};
+    auto value       = Eigen::MatrixXd(2, 3);
+    auto derivative  = Eigen::MatrixXd::Zero(6, 6).eval();
+    for (Eigen::Index i = 0; i != 2; ++i) {
+        auto const [y, jacobian]
+            = normalizationJacobian(point.row(i).transpose(), 1e-5);
+        value.row(i) = y.transpose();
+        // the coefficients of row i are (i, i + 2, i + 4)
+        for (Eigen::Index k = 0; k != 3; ++k) {
+            for (Eigen::Index l = 0; l != 3; ++l) {
+                derivative(i + 2 * k, i + 2 * l) = jacobian(k, l);
+            }
+        }
+    }
+    auto const op = [](auto const& x) { return batchNorm(x); };
+    CHECK_UNARY_OP(op, point, value, derivative, 1E-6);
+}
+
+SCENARIO("batchNorm(x) with large offset x in R^(1x3)",
+    "EigenAD::Normalization")
+{
+    // the one-pass statistics do not cancel catastrophically
+    auto const point = Eigen::MatrixXd{{1e8 + 1.0, 1e8 + 2.0, 1e8 + 3.0}};
+    auto const [y, jacobian]
+        = normalizationJacobian(Eigen::VectorXd{{1.0, 2.0, 3.0}}, 1e-5);
+    auto const value = Eigen::MatrixXd(y.transpose());
+    auto const op    = [](auto const& x) { return batchNorm(x); };
+    CHECK_UNARY_OP(op, point, value, jacobian, 1E-6);
+}
+
+SCENARIO("layerNorm(x, 0) * w with x in R^(2x1), w in R^(1x2)",
+    "EigenAD::Normalization")
+{
+    auto x = var(Eigen::MatrixXd{{1.0}, {3.0}});
+    auto w = var(Eigen::MatrixXd{{2.0, -1.0}});
+
+    WHEN("the normalized value is an operand of a product")
+    {
+        auto v = var(layerNorm(x, 0.0) * w);
+        Function f(v);
+        v.setDerivative(Eigen::RowVectorXd::LinSpaced(4, 1.0, 4.0));
+        f.pullGradient();
+        THEN("the product reads the normalized value")
+        {
+            CHECK(v().isApprox(Eigen::MatrixXd{{-2.0, 1.0}, {2.0, -1.0}}));
+            CHECK(d(w).isApprox(Eigen::RowVectorXd{{1.0, 1.0}}));
+        }
+    }
+}
@@ -0,0 +1,76 @@
+#include "common.hpp"
+
+#include <AutoDiff/src/Core/Function.hpp>
+#include <AutoDiff/src/Core/Variable.hpp>
+
+#include <AutoDiff/src/Eigen/CWise/common.hpp>
+#include <AutoDiff/src/Eigen/CWise/ops/Sum.hpp>
+#include <AutoDiff/src/Eigen/Fused/ops/Softmax.hpp>
+
+#include <cmath>
+
+using AutoDiff::Function;
+using AutoDiff::var;
+
+SCENARIO("softmax(x) with x in R^3", "EigenAD::Softmax")
+{
+    auto const point = Eigen::VectorXd{{1.0, 2.0, -0.5}};
+    auto const value = (point.array().exp() / point.array().exp().sum())
+                           .matrix()
+                           .eval();
+    auto const derivative = (Eigen::MatrixXd(value.asDiagonal())
+                             - value * value.transpose())
+                                .eval();
+    CHECK_UNARY_OP(softmax, point, value, derivative, 1E-6);
+}
+
+SCENARIO("softmax(x) with x in R^(3x2)", "EigenAD::Softmax")
+{
+    auto const point
+        = Eigen::MatrixXd{{1.0, 0.0}, {2.0, -1.0}, {-0.5, 3.0}};
+    auto value = Eigen::MatrixXd(3, 2);
+    auto derivative = Eigen::MatrixXd::Zero(6, 6).eval();
+    for (Eigen::Index j = 0; j != 2; ++j) {
+        auto const exp = point.col(j).array().exp().eval();
+        value.col(j)   = exp / exp.sum();
+        derivative.block(3 * j, 3 * j, 3, 3)
+            = Eigen::MatrixXd(value.col(j).asDiagonal())
+            - value.col(j) * value.col(j).transpose();
+    }
+    CHECK_UNARY_OP(softmax, point, value, derivative, 1E-6);
+}
+
+SCENARIO("softmax(x) with large x in R^3", "EigenAD::Softmax")
+{
+    // exp(1000) overflows without shifting by the maximum
+    auto const point = Eigen::VectorXd{{1000.0, 999.0, 1000.0}};
+    auto const e     = std::exp(-1.0);
+    auto const value
+        = (Eigen::VectorXd{{1.0, e, 1.0}} / (2.0 + e)).eval();
+    auto const derivative = (Eigen::MatrixXd(value.asDiagonal())
+                             - value * value.transpose())
+                                .eval();
+    CHECK_UNARY_OP(softmax, point, value, derivative, 1E-6);
+}
+
+SCENARIO("softmax(x) + y with x, y in R^3", "EigenAD::Softmax")
+{
+    auto x = var(Eigen::VectorXd{{1.0, 2.0, -0.5}});
+    auto y = var(Eigen::VectorXd{{0.5, -1.0, 2.0}});
+
+    WHEN("the softmax is an operand of a sum")
+    {
+        auto v = var(softmax(x) + y);
+        Function f(v);
+        v.setDerivative(Eigen::RowVectorXd::Ones(3));
+        f.pullGradient();
+        THEN("the sum reads the softmax")
+        {
+            auto const exp = x().array().exp().matrix().eval();
+            CHECK(v().isApprox(exp / exp.sum() + y()));
+            // the coefficients of the softmax sum to one
+            CHECK(d(x).isZero(1E-12));
+            CHECK(d(y).isApprox(Eigen::RowVectorXd::Ones(3)));
+        }
+    }
+}
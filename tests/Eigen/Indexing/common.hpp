@@ -0,0 +1,16 @@
+// Copyright (c) 2024 Matthias Krippner
+//
+// This software is released under the MIT License.
+// https://opensource.org/licenses/MIT
+
+#ifndef TESTS_EIGEN_INDEXING_COMMON_HPP
+#define TESTS_EIGEN_INDEXING_COMMON_HPP
+
+#include "../helper/binary.hpp"
+#include "../helper/unary.hpp"
+
+// must be included before including single operations
+#include <AutoDiff/src/Eigen/Indexing/common.hpp>
+#include <AutoDiff/src/Eigen/module.hpp>
+
+#endif // TESTS_EIGEN_INDEXING_COMMON_HPP
@@ -0,0 +1,102 @@
+#include "common.hpp"
+
+#include <AutoDiff/src/Core/Function.hpp>
+#include <AutoDiff/src/Core/Variable.hpp>
+
+#include <AutoDiff/src/Eigen/Indexing/ops/Block.hpp>
+
+using AutoDiff::Function;
+using AutoDiff::var;
+using AutoDiff::EigenAD::hasColVectorValue_v;
+using AutoDiff::EigenAD::hasRowVectorValue_v;
+
+namespace {
+
+// the rows of the identity of the selected coefficients (flat indices)
+auto selection(std::initializer_list<Eigen::Index> indices, Eigen::Index size)
+    -> Eigen::MatrixXd
+{
+    auto result    = Eigen::MatrixXd::Zero(indices.size(), size).eval();
+    Eigen::Index i = 0;
+    for (auto const index : indices) {
+        result(i++, index) = 1.0;
+    }
+    return result;
+}
+
+} // namespace
+
+SCENARIO("block(x, 1, 0, 2, 2) with x in R^(3x3)", "EigenAD::Block")
+{
+    auto const point = Eigen::MatrixXd{
+        {1.0, 2.0, 3.0}, {4.0, 5.0, 6.0}, {7.0, 8.0, 9.0}};
+    auto const value      = Eigen::MatrixXd{{4.0, 5.0}, {7.0, 8.0}};
+    auto const derivative = selection({1, 2, 4, 5}, 9);
+    auto const op = [](auto const& x) { return block(x, 1, 0, 2, 2); };
+    CHECK_UNARY_OP(op, point, value, derivative, 1E-6);
+}
+
+SCENARIO("segment(x, 1, 2) with x in R^4", "EigenAD::Block")
+{
+    auto const point      = Eigen::VectorXd{{1.0, 2.0, 3.0, 4.0}};
+    auto const value      = Eigen::VectorXd{{2.0, 3.0}};
+    auto const derivative = selection({1, 2}, 4);
+    auto const op         = [](auto const& x) { return segment(x, 1, 2); };
+    CHECK_UNARY_OP(op, point, value, derivative, 1E-6);
+}
+
+SCENARIO("row(x, 1) with x in R^(2x3)", "EigenAD::Block")
+{
+    auto const point = Eigen::MatrixXd{{1.0, 2.0, 3.0}, {4.0, 5.0, 6.0}};
+    auto const value      = Eigen::RowVectorXd{{4.0, 5.0, 6.0}};
+    auto const derivative = selection({1, 3, 5}, 6);
+    auto const op         = [](auto const& x) { return row(x, 1); };
+    CHECK_UNARY_OP(op, point, value, derivative, 1E-6);
+}
+
+SCENARIO("col(x, 2) with x in R^(2x3)", "EigenAD::Block")
+{
+    auto const point = Eigen::MatrixXd{{1.0, 2.0, 3.0}, {4.0, 5.0, 6.0}};
+    auto const value      = Eigen::VectorXd{{3.0, 6.0}};
+    auto const derivative = selection({4, 5}, 6);
+    auto const op         = [](auto const& x) { return col(x, 2); };
+    CHECK_UNARY_OP(op, point, value, derivative, 1E-6);
+}
+
+SCENARIO("Blocks are views of the operand", "EigenAD::Block")
+{
+    auto x = var(Eigen::MatrixXd{{1.0, 2.0, 3.0}, {4.0, 5.0, 6.0}});
+    THEN("the value of a block is not copied")
+    {
+        auto expression = block(x, 1, 1, 1, 2);
+        CHECK(expression._value().data() == &x()(1, 1));
+    }
+    THEN("rows and columns are vectors")
+    {
+        static_assert(hasRowVectorValue_v<decltype(row(x, 0))>);
+        static_assert(hasColVectorValue_v<decltype(col(x, 0))>);
+        auto y = var(segment(row(x, 1), 1, 2));
+        CHECK(y().isApprox(Eigen::RowVectorXd{{5.0, 6.0}}));
+    }
+}
+
+SCENARIO("Pulling back the gradients of several blocks", "EigenAD::Block")
+{
+    auto x = var(Eigen::MatrixXd::Zero(3, 3).eval());
+    auto y = var(block(x, 1, 1, 2, 2));
+    auto z = var(col(x, 1));
+    Function f(from(x), to(y, z));
+    WHEN("pulling back the gradients of both blocks")
+    {
+        y.setDerivative(Eigen::RowVectorXd{{1.0, 2.0, 3.0, 4.0}});
+        z.setDerivative(Eigen::RowVectorXd{{5.0, 6.0, 7.0}});
+        f.pullGradient();
+        THEN("each gradient is accumulated into the columns of its block")
+        {
+            // coefficients of y: x11, x21, x12, x22; of z: x01, x11, x21
+            auto const gradient = Eigen::RowVectorXd{
+                {0.0, 0.0, 0.0, 5.0, 7.0, 9.0, 0.0, 3.0, 4.0}};
+            CHECK(d(x).isApprox(gradient));
+        }
+    }
+}
@@ -0,0 +1,149 @@
+#include "common.hpp"
+
+#include <AutoDiff/src/Core/Function.hpp>
+#include <AutoDiff/src/Core/Variable.hpp>
+
+#include <AutoDiff/src/Eigen/CWise/common.hpp>
+#include <AutoDiff/src/Eigen/CWise/ops/Sum.hpp>
+#include <AutoDiff/src/Eigen/Indexing/ops/Concatenation.hpp>
+#include <AutoDiff/src/Eigen/Indexing/ops/Transpose.hpp>
+
+using AutoDiff::Function;
+using AutoDiff::var;
+using AutoDiff::EigenAD::hasColVectorValue_v;
+using AutoDiff::EigenAD::hasRowVectorValue_v;
+
+// concatenation has no literal operands
+#define CHECK_CONCATENATION(operation, pX, pY, v, dX, dY)                      \
+    WHEN("evaluating")                                                         \
+    {                                                                          \
+        using PointX    = detail::Unqualified_t<decltype(pX)>;                 \
+        using PointY    = detail::Unqualified_t<decltype(pY)>;                 \
+        auto operandX   = test::MockOperation<PointX, Eigen::MatrixXd>();      \
+        auto operandY   = test::MockOperation<PointY, Eigen::MatrixXd>();      \
+        auto expression = operation(operandX, operandY);                       \
+        detail::checkBinaryOp(                                                 \
+            operandX, operandY, expression, pX, pY, v, dX, dY, 1E-6);          \
+    }
+
+namespace {
+
+// the rows of the identity of the selected coefficients (flat indices)
+auto selection(std::initializer_list<Eigen::Index> indices, Eigen::Index size)
+    -> Eigen::MatrixXd
+{
+    auto result    = Eigen::MatrixXd::Zero(indices.size(), size).eval();
+    Eigen::Index i = 0;
+    for (auto const index : indices) {
+        result(i++, index) = 1.0;
+    }
+    return result;
+}
+
+} // namespace
+
+SCENARIO("vcat(x, y) with x in R^(2x2), y in R^(1x2)",
+    "EigenAD::Concatenation")
+{
+    auto const pointX = Eigen::MatrixXd{{1.0, 2.0}, {3.0, 4.0}};
+    auto const pointY = Eigen::MatrixXd{{5.0, 6.0}};
+    auto const value
+        = Eigen::MatrixXd{{1.0, 2.0}, {3.0, 4.0}, {5.0, 6.0}};
+    // coefficients of the value: x00, x10, y0, x01, x11, y1
+    Eigen::MatrixXd const derivX = selection({0, 1, 3, 4}, 6).transpose();
+    Eigen::MatrixXd const derivY = selection({2, 5}, 6).transpose();
+    auto const op = [](auto const& x, auto const& y) { return vcat(x, y); };
+    CHECK_CONCATENATION(op, pointX, pointY, value, derivX, derivY);
+}
+
+SCENARIO("vcat(x, y) with x in R^2, y in R^3", "EigenAD::Concatenation")
+{
+    auto const pointX = Eigen::VectorXd{{1.0, 2.0}};
+    auto const pointY = Eigen::VectorXd{{3.0, 4.0, 5.0}};
+    auto const value  = Eigen::VectorXd{{1.0, 2.0, 3.0, 4.0, 5.0}};
+    auto const derivX = Eigen::MatrixXd::Identity(5, 2).eval();
+    auto derivY       = Eigen::MatrixXd::Zero(5, 3).eval();
+    derivY.bottomRows(3).setIdentity();
+    auto const op = [](auto const& x, auto const& y) { return vcat(x, y); };
+    CHECK_CONCATENATION(op, pointX, pointY, value, derivX, derivY);
+}
+
+SCENARIO("hcat(x, y) with x in R^(2x2), y in R^2", "EigenAD::Concatenation")
+{
+    auto const pointX = Eigen::MatrixXd{{1.0, 2.0}, {3.0, 4.0}};
+    auto const pointY = Eigen::VectorXd{{5.0, 6.0}};
+    auto const value
+        = Eigen::MatrixXd{{1.0, 2.0, 5.0}, {3.0, 4.0, 6.0}};
+    auto const derivX = Eigen::MatrixXd::Identity(6, 4).eval();
+    auto derivY       = Eigen::MatrixXd::Zero(6, 2).eval();
+    derivY.bottomRows(2).setIdentity();
+    auto const op = [](auto const& x, auto const& y) { return hcat(x, y); };
+    CHECK_CONCATENATION(op, pointX, pointY, value, derivX, derivY);
+}
+
+SCENARIO("Concatenating three vectors", "EigenAD::Concatenation")
+{
+    auto a = var(Eigen::VectorXd{{1.0, 2.0}});
+    auto b = var(Eigen::VectorXd{{3.0}});
+    auto c = var(Eigen::VectorXd{{4.0, 5.0, 6.0}});
+
+    THEN("the vertical concatenation is a column vector")
+    {
+        auto v = vcat(a, b, c);
+        static_assert(hasColVectorValue_v<decltype(v)>);
+        CHECK(v._value().isApprox(
+            Eigen::VectorXd{{1.0, 2.0, 3.0, 4.0, 5.0, 6.0}}));
+    }
+    THEN("the horizontal concatenation of transposes is a row vector")
+    {
+        auto h = hcat(transpose(a), transpose(b), transpose(c));
+        static_assert(hasRowVectorValue_v<decltype(h)>);
+        CHECK(h._value().isApprox(
+            Eigen::RowVectorXd{{1.0, 2.0, 3.0, 4.0, 5.0, 6.0}}));
+    }
+    WHEN("pulling back the gradient")
+    {
+        auto v = var(vcat(a, b, c));
+        Function f(v);
+        v.setDerivative(Eigen::RowVectorXd::LinSpaced(6, 1.0, 6.0));
+        f.pullGradient();
+        THEN("each operand receives its columns of the gradient")
+        {
+            CHECK(d(a).isApprox(Eigen::RowVectorXd{{1.0, 2.0}}));
+            CHECK(d(b).isApprox(Eigen::RowVectorXd{{3.0}}));
+            CHECK(d(c).isApprox(Eigen::RowVectorXd{{4.0, 5.0, 6.0}}));
+        }
+    }
+    WHEN("pushing forward the tangent")
+    {
+        auto v = var(vcat(a, b, c));
+        Function f(v);
+        f.pushTangentAt(c);
+        THEN("the tangent of each operand is moved to its rows")
+        {
+            auto derivative = Eigen::MatrixXd::Zero(6, 3).eval();
+            derivative.bottomRows(3).setIdentity();
+            CHECK(d(v).isApprox(derivative));
+        }
+    }
+}
+
+SCENARIO("vcat(x, y) + vcat(y, x) with x, y in R^2", "EigenAD::Concatenation")
+{
+    auto x = var(Eigen::VectorXd{{1.0, 2.0}});
+    auto y = var(Eigen::VectorXd{{-3.0, 0.5}});
+
+    WHEN("the concatenations are operands of a sum")
+    {
+        auto v = var(vcat(x, y) + vcat(y, x));
+        Function f(v);
+        v.setDerivative(Eigen::RowVectorXd::LinSpaced(4, 1.0, 4.0));
+        f.pullGradient();
+        THEN("the sum reads both concatenations")
+        {
+            CHECK(v().isApprox(Eigen::VectorXd{{-2.0, 2.5, -2.0, 2.5}}));
+            CHECK(d(x).isApprox(Eigen::RowVectorXd{{4.0, 6.0}}));
+            CHECK(d(y).isApprox(Eigen::RowVectorXd{{4.0, 6.0}}));
+        }
+    }
+}
@@ -0,0 +1,66 @@
+#include "common.hpp"
+
+#include <AutoDiff/src/Core/Function.hpp>
+#include <AutoDiff/src/Core/Variable.hpp>
+
+#include <AutoDiff/src/Eigen/CWise/common.hpp>
+#include <AutoDiff/src/Eigen/CWise/ops/Sum.hpp>
+#include <AutoDiff/src/Eigen/Indexing/ops/Gather.hpp>
+#include <AutoDiff/src/Eigen/Indexing/ops/ScatterAdd.hpp>
+
+using AutoDiff::Function;
+using AutoDiff::var;
+
+SCENARIO("gather(x, {2, 0, 2}) with x in R^(3x2)", "EigenAD::Gather")
+{
+    auto const point = Eigen::MatrixXd{{1.0, 2.0}, {3.0, 4.0}, {5.0, 6.0}};
+    auto const value = Eigen::MatrixXd{{5.0, 6.0}, {1.0, 2.0}, {5.0, 6.0}};
+
+    auto derivative  = Eigen::MatrixXd::Zero(6, 6).eval();
+    derivative(0, 2) = 1.0;
+    derivative(1, 0) = 1.0;
+    derivative(2, 2) = 1.0;
+    derivative(3, 5) = 1.0;
+    derivative(4, 3) = 1.0;
+    derivative(5, 5) = 1.0;
+
+    auto const op = [](auto const& x) { return gather(x, {2, 0, 2}); };
+    CHECK_UNARY_OP(op, point, value, derivative, 1E-6);
+}
+
+SCENARIO("gather(x, {1, 1}) with x in R^(2x2)", "EigenAD::Gather")
+{
+    // the gradients of repeated rows are summed
+    auto const point = Eigen::MatrixXd{{1.0, 2.0}, {3.0, 4.0}};
+    auto const value = Eigen::MatrixXd{{3.0, 4.0}, {3.0, 4.0}};
+
+    auto derivative  = Eigen::MatrixXd::Zero(4, 4).eval();
+    derivative(0, 1) = 1.0;
+    derivative(1, 1) = 1.0;
+    derivative(2, 3) = 1.0;
+    derivative(3, 3) = 1.0;
+
+    auto const op = [](auto const& x) { return gather(x, {1, 1}); };
+    CHECK_UNARY_OP(op, point, value, derivative, 1E-6);
+}
+
+SCENARIO("gather(x, {2, 0}) + scatterAdd(y, {1}, 2)", "EigenAD::Gather")
+{
+    auto x = var(Eigen::MatrixXd{{1.0, 2.0}, {3.0, 4.0}, {5.0, 6.0}});
+    auto y = var(Eigen::MatrixXd{{0.5, -1.0}});
+
+    WHEN("the gathered and scattered values are operands of a sum")
+    {
+        auto v = var(gather(x, {2, 0}) + scatterAdd(y, {1}, 2));
+        Function f(v);
+        v.setDerivative(Eigen::RowVectorXd::LinSpaced(4, 1.0, 4.0));
+        f.pullGradient();
+        THEN("the sum reads both values")
+        {
+            CHECK(v().isApprox(Eigen::MatrixXd{{5.0, 6.0}, {1.5, 1.0}}));
+            CHECK(d(x).isApprox(
+                Eigen::RowVectorXd{{2.0, 0.0, 1.0, 4.0, 0.0, 3.0}}));
+            CHECK(d(y).isApprox(Eigen::RowVectorXd{{2.0, 4.0}}));
+        }
+    }
+}
@@ -0,0 +1,21 @@
+#include "common.hpp"
+
+#include <AutoDiff/src/Eigen/Indexing/ops/Reshaped.hpp>
+
+SCENARIO("reshaped(x, 3, 2) with x in R^(2x3)", "EigenAD::Reshaped")
+{
+    auto const point = Eigen::MatrixXd{{1.0, 2.0, 3.0}, {4.0, 5.0, 6.0}};
+    auto const value = Eigen::MatrixXd{{1.0, 5.0}, {4.0, 3.0}, {2.0, 6.0}};
+    auto const derivative = Eigen::MatrixXd::Identity(6, 6).eval();
+    auto const op = [](auto const& x) { return reshaped(x, 3, 2); };
+    CHECK_UNARY_OP(op, point, value, derivative, 1E-6);
+}
+
+SCENARIO("reshaped(x, 1, 4) with x in R^(2x2)", "EigenAD::Reshaped")
+{
+    auto const point      = Eigen::MatrixXd{{1.0, 2.0}, {3.0, 4.0}};
+    auto const value      = Eigen::MatrixXd{{1.0, 3.0, 2.0, 4.0}};
+    auto const derivative = Eigen::MatrixXd::Identity(4, 4).eval();
+    auto const op = [](auto const& x) { return reshaped(x, 1, 4); };
+    CHECK_UNARY_OP(op, point, value, derivative, 1E-6);
+}
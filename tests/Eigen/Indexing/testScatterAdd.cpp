@@ -0,0 +1,36 @@
+#include "common.hpp"
+
+#include <AutoDiff/src/Eigen/Indexing/ops/ScatterAdd.hpp>
+
+SCENARIO("scatterAdd(x, {2, 0, 2}, 3) with x in R^(3x2)", "EigenAD::ScatterAdd")
+{
+    auto const point = Eigen::MatrixXd{{1.0, 2.0}, {3.0, 4.0}, {5.0, 6.0}};
+    auto const value = Eigen::MatrixXd{{3.0, 4.0}, {0.0, 0.0}, {6.0, 8.0}};
+
+    auto derivative  = Eigen::MatrixXd::Zero(6, 6).eval();
+    derivative(0, 1) = 1.0;
+    derivative(2, 0) = 1.0;
+    derivative(2, 2) = 1.0;
+    derivative(3, 4) = 1.0;
+    derivative(5, 3) = 1.0;
+    derivative(5, 5) = 1.0;
+
+    auto const op = [](auto const& x) { return scatterAdd(x, {2, 0, 2}, 3); };
+    CHECK_UNARY_OP(op, point, value, derivative, 1E-6);
+}
+
+SCENARIO("scatterAdd(x, {1, 1}, 2) with x in R^(2x2)", "EigenAD::ScatterAdd")
+{
+    // rows scattered to the same index are summed
+    auto const point = Eigen::MatrixXd{{1.0, 2.0}, {3.0, 4.0}};
+    auto const value = Eigen::MatrixXd{{0.0, 0.0}, {4.0, 6.0}};
+
+    auto derivative  = Eigen::MatrixXd::Zero(4, 4).eval();
+    derivative(1, 0) = 1.0;
+    derivative(1, 1) = 1.0;
+    derivative(3, 2) = 1.0;
+    derivative(3, 3) = 1.0;
+
+    auto const op = [](auto const& x) { return scatterAdd(x, {1, 1}, 2); };
+    CHECK_UNARY_OP(op, point, value, derivative, 1E-6);
+}
@@ -0,0 +1,27 @@
+#include "common.hpp"
+
+#include <AutoDiff/src/Eigen/Indexing/ops/Transpose.hpp>
+
+SCENARIO("transpose(x) with x in R^(2x3)", "EigenAD::Transpose")
+{
+    auto const point = Eigen::MatrixXd{{1.0, 2.0, 3.0}, {4.0, 5.0, 6.0}};
+    auto const value = Eigen::MatrixXd{{1.0, 4.0}, {2.0, 5.0}, {3.0, 6.0}};
+    // the commutation matrix
+    auto derivative = Eigen::MatrixXd::Zero(6, 6).eval();
+    for (Eigen::Index i = 0; i != 2; ++i) {
+        for (Eigen::Index j = 0; j != 3; ++j) {
+            derivative(j + 3 * i, i + 2 * j) = 1.0;
+        }
+    }
+    auto const op = [](auto const& x) { return transpose(x); };
+    CHECK_UNARY_OP(op, point, value, derivative, 1E-6);
+}
+
+SCENARIO("transpose(x) with x in R^3", "EigenAD::Transpose")
+{
+    auto const point      = Eigen::VectorXd{{1.0, 2.0, 3.0}};
+    auto const value      = Eigen::RowVectorXd{{1.0, 2.0, 3.0}};
+    auto const derivative = Eigen::MatrixXd::Identity(3, 3).eval();
+    auto const op         = [](auto const& x) { return transpose(x); };
+    CHECK_UNARY_OP(op, point, value, derivative, 1E-6);
+}
@@ -0,0 +1,34 @@
+// Copyright (c) 2024 Matthias Krippner
+//
+// This software is released under the MIT License.
+// https://opensource.org/licenses/MIT
+
+#ifndef TESTS_EIGEN_LINEAR_ALGEBRA_COMMON_HPP
+#define TESTS_EIGEN_LINEAR_ALGEBRA_COMMON_HPP
+
+#include "../helper/binary.hpp"
+#include "../helper/unary.hpp"
+
+#include <Eigen/Eigenvalues>
+#include <Eigen/LU>
+#include <Eigen/QR>
+
+// must be included before including single operations
+#include <AutoDiff/src/Eigen/LinearAlgebra/common.hpp>
+#include <AutoDiff/src/Eigen/module.hpp>
+
+// the Kronecker product x kron y
+inline auto kron(Eigen::MatrixXd const& x, Eigen::MatrixXd const& y)
+    -> Eigen::MatrixXd
+{
+    auto result = Eigen::MatrixXd(x.rows() * y.rows(), x.cols() * y.cols());
+    for (Eigen::Index i = 0; i != x.rows(); ++i) {
+        for (Eigen::Index j = 0; j != x.cols(); ++j) {
+            result.block(i * y.rows(), j * y.cols(), y.rows(), y.cols())
+                = x(i, j) * y;
+        }
+    }
+    return result;
+}
+
+#endif // TESTS_EIGEN_LINEAR_ALGEBRA_COMMON_HPP
@@ -0,0 +1,47 @@
+#include "common.hpp"
+
+#include <AutoDiff/src/Eigen/LinearAlgebra/ops/Determinant.hpp>
+
+#include <cmath>
+
+// d det(A) = det(A) vec(A^-T)^T d vec(A)
+
+SCENARIO("determinant(A) with A in R^(2x2)", "EigenAD::Determinant")
+{
+    auto const point      = Eigen::MatrixXd{{4.0, 1.0}, {2.0, 1.0}};
+    auto const derivative = Eigen::RowVectorXd{{1.0, -1.0, -2.0, 4.0}};
+    CHECK_UNARY_OP(determinant, point, 2.0, derivative, 1E-6);
+}
+
+SCENARIO("determinant(A) with A in R^(2x2) requiring pivoting",
+    "EigenAD::Determinant")
+{
+    auto const point      = Eigen::MatrixXd{{1.0, 2.0}, {3.0, 4.0}};
+    auto const derivative = Eigen::RowVectorXd{{4.0, -2.0, -3.0, 1.0}};
+    CHECK_UNARY_OP(determinant, point, -2.0, derivative, 1E-6);
+}
+
+SCENARIO("logDeterminant(A) with A in R^(2x2)", "EigenAD::LogDeterminant")
+{
+    auto const point      = Eigen::MatrixXd{{4.0, 1.0}, {2.0, 1.0}};
+    auto const derivative = Eigen::RowVectorXd{{0.5, -0.5, -1.0, 2.0}};
+    CHECK_UNARY_OP(logDeterminant, point, std::log(2.0), derivative, 1E-6);
+}
+
+SCENARIO("logDeterminant(A) with det(A) < 0", "EigenAD::LogDeterminant")
+{
+    auto const point      = Eigen::MatrixXd{{1.0, 2.0}, {3.0, 4.0}};
+    auto const derivative = Eigen::RowVectorXd{{-2.0, 1.0, 1.5, -0.5}};
+    CHECK_UNARY_OP(logDeterminant, point, std::log(2.0), derivative, 1E-6);
+}
+
+SCENARIO("logDeterminant(A) with det(A) beyond the double range",
+    "EigenAD::LogDeterminant")
+{
+    // det(A) = 10^400 overflows as product of the pivots
+    auto const point = (1E10 * Eigen::MatrixXd::Identity(40, 40)).eval();
+    auto const derivative
+        = (1E-10 * Eigen::MatrixXd::Identity(40, 40)).reshaped().transpose();
+    CHECK_UNARY_OP(logDeterminant, point, 400.0 * std::log(10.0),
+        derivative.eval(), 1E-6);
+}
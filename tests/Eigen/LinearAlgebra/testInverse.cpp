@@ -0,0 +1,49 @@
+#include "common.hpp"
+
+#include <AutoDiff/src/Core/Function.hpp>
+#include <AutoDiff/src/Core/Variable.hpp>
+
+#include <AutoDiff/src/Eigen/LinearAlgebra/ops/Inverse.hpp>
+#include <AutoDiff/src/Eigen/Products/ops/MatrixProduct.hpp>
+
+using AutoDiff::Function;
+using AutoDiff::var;
+
+// d vec(A^-1) = -(A^-T kron A^-1) d vec(A)
+
+SCENARIO("inverse(A) with A in R^(2x2)", "EigenAD::Inverse")
+{
+    auto const point      = Eigen::MatrixXd{{4.0, 1.0}, {2.0, 1.0}};
+    auto const value      = Eigen::MatrixXd{{0.5, -0.5}, {-1.0, 2.0}};
+    auto const derivative = (-kron(value.transpose(), value)).eval();
+    CHECK_UNARY_OP(inverse, point, value, derivative, 1E-6);
+}
+
+SCENARIO("inverse(A) with A in R^(3x3) requiring pivoting", "EigenAD::Inverse")
+{
+    auto const point
+        = Eigen::MatrixXd{{0.0, 1.0, 2.0}, {1.0, 0.0, 3.0}, {4.0, -3.0, 8.0}};
+    auto const value = Eigen::MatrixXd{
+        {-4.5, 7.0, -1.5}, {-2.0, 4.0, -1.0}, {1.5, -2.0, 0.5}};
+    auto const derivative = (-kron(value.transpose(), value)).eval();
+    CHECK_UNARY_OP(inverse, point, value, derivative, 1E-6);
+}
+
+SCENARIO("inverse(A) * y with A, y in R^(2x2)", "EigenAD::Inverse")
+{
+    auto a = var(Eigen::MatrixXd{{4.0, 1.0}, {2.0, 1.0}});
+    auto y = var(Eigen::MatrixXd{{1.0, 0.0}, {2.0, 1.0}});
+
+    WHEN("the inverse is an operand of a product")
+    {
+        auto v = var(inverse(a) * y);
+        Function f(v);
+        v.setDerivative(Eigen::RowVectorXd::Ones(4));
+        f.pullGradient();
+        THEN("the product reads the inverse")
+        {
+            CHECK(v().isApprox(Eigen::MatrixXd{{-0.5, -0.5}, {3.0, 2.0}}));
+            CHECK(d(y).isApprox(Eigen::RowVectorXd{{-0.5, 1.5, -0.5, 1.5}}));
+        }
+    }
+}
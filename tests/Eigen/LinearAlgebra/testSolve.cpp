@@ -0,0 +1,30 @@
+#include "common.hpp"
+
+#include <AutoDiff/src/Eigen/LinearAlgebra/ops/Solve.hpp>
+
+namespace {
+
+auto const pA       = Eigen::MatrixXd{{4.0, 1.0}, {2.0, 1.0}};
+auto const inverseA = Eigen::MatrixXd{{0.5, -0.5}, {-1.0, 2.0}};
+
+} // namespace
+
+// d vec(A^-1 B) = -(X^T kron A^-1) d vec(A) + (I kron A^-1) d vec(B)
+
+SCENARIO("solve(A, b) with A in R^(2x2) and b in R^2", "EigenAD::Solve")
+{
+    auto const pB    = Eigen::VectorXd{{1.0, -1.0}};
+    auto const value = Eigen::VectorXd{{1.0, -3.0}};
+    auto const dA    = (-kron(value.transpose(), inverseA)).eval();
+    auto const dB    = inverseA;
+    CHECK_BINARY_OP(solve, pA, pB, value, dA, dB, 1E-6);
+}
+
+SCENARIO("solve(A, B) with A, B in R^(2x2)", "EigenAD::Solve")
+{
+    auto const pB    = Eigen::MatrixXd{{1.0, 2.0}, {0.0, -1.0}};
+    auto const value = Eigen::MatrixXd{{0.5, 1.5}, {-1.0, -4.0}};
+    auto const dA    = (-kron(value.transpose(), inverseA)).eval();
+    auto const dB    = kron(Eigen::MatrixXd::Identity(2, 2), inverseA);
+    CHECK_BINARY_OP(solve, pA, pB, value, dA, dB, 1E-6);
+}
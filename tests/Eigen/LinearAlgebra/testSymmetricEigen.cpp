@@ -0,0 +1,124 @@
+#include "common.hpp"
+
+#include <AutoDiff/src/Core/Function.hpp>
+#include <AutoDiff/src/Core/Variable.hpp>
+
+#include <AutoDiff/src/Eigen/LinearAlgebra/ops/SymmetricEigen.hpp>
+
+using AutoDiff::Function;
+using AutoDiff::to;
+using AutoDiff::var;
+
+// d lambda_i = v_i^T dS v_i,   dV = V (F o V^T dS V)
+
+namespace {
+
+auto eigenvalues(Eigen::MatrixXd const& s) -> Eigen::VectorXd
+{
+    return Eigen::SelfAdjointEigenSolver<Eigen::MatrixXd>(s).eigenvalues();
+}
+
+auto eigenvectors(Eigen::MatrixXd const& s) -> Eigen::MatrixXd
+{
+    return Eigen::SelfAdjointEigenSolver<Eigen::MatrixXd>(s).eigenvectors();
+}
+
+// central differences along symmetric perturbations (E_ij + E_ji) / 2
+template <typename Fn>
+auto symmetricDifferences(Fn const& fn, Eigen::MatrixXd const& s)
+    -> Eigen::MatrixXd
+{
+    auto const eps  = 1E-6;
+    auto const size = s.rows();
+    auto jacobian   = Eigen::MatrixXd(fn(s).size(), size * size);
+    for (Eigen::Index k = 0; k != size * size; ++k) {
+        Eigen::MatrixXd perturbation = Eigen::MatrixXd::Zero(size, size);
+        perturbation(k % size, k / size) += eps / 2;
+        perturbation(k / size, k % size) += eps / 2;
+        jacobian.col(k)
+            = (fn(s + perturbation) - fn(s - perturbation)).reshaped()
+            / (2 * eps);
+    }
+    return jacobian;
+}
+
+} // namespace
+
+SCENARIO("symmetricEigen(S) with S in R^(2x2)", "EigenAD::SymmetricEigen")
+{
+    auto const point = Eigen::MatrixXd{{2.0, 1.0}, {1.0, 2.0}};
+    auto S           = var(point);
+    auto [values, vectors] = symmetricEigen(S);
+
+    THEN("the eigenvalues are in increasing order")
+    {
+        CHECK(values().isApprox(Eigen::VectorXd{{1.0, 3.0}}));
+    }
+    THEN("the eigenvectors diagonalize S")
+    {
+        CHECK((vectors().transpose() * vectors())
+                  .isApprox(Eigen::MatrixXd::Identity(2, 2)));
+        CHECK((vectors() * values().asDiagonal() * vectors().transpose())
+                  .isApprox(point));
+    }
+    WHEN("pushing forward the tangent")
+    {
+        Function f(to(values, vectors));
+        f.pushTangentAt(S);
+        THEN("the derivative of the eigenvalues is v_i^T dS v_i")
+        {
+            auto const derivative = Eigen::MatrixXd{
+                {0.5, -0.5, -0.5, 0.5}, {0.5, 0.5, 0.5, 0.5}};
+            CHECK(d(values).isApprox(derivative));
+        }
+    }
+}
+
+SCENARIO("symmetricEigen(S) with S in R^(3x3)", "EigenAD::SymmetricEigen")
+{
+    auto const point = Eigen::MatrixXd{
+        {4.0, 1.0, 0.5}, {1.0, 3.0, 0.2}, {0.5, 0.2, 1.0}};
+    auto S                 = var(point);
+    auto [values, vectors] = symmetricEigen(S);
+
+    auto const valuesDerivative  = symmetricDifferences(eigenvalues, point);
+    auto const vectorsDerivative = symmetricDifferences(eigenvectors, point);
+
+    WHEN("pushing forward the tangent")
+    {
+        Function f(to(values, vectors));
+        f.pushTangentAt(S);
+        THEN("the derivatives are correct")
+        {
+            CHECK(d(values).isApprox(valuesDerivative, 1E-6));
+            CHECK(d(vectors).isApprox(vectorsDerivative, 1E-6));
+        }
+    }
+    WHEN("pulling back the gradient of each output")
+    {
+        THEN("the derivatives are correct")
+        {
+            Function(values).pullGradientAt(values);
+            CHECK(d(S).isApprox(valuesDerivative, 1E-6));
+            Function(vectors).pullGradientAt(vectors);
+            CHECK(d(S).isApprox(vectorsDerivative, 1E-6));
+        }
+    }
+    WHEN("pulling back the gradients of both outputs")
+    {
+        auto const valuesGradient = Eigen::RowVector3d{1.0, -2.0, 0.5};
+        auto const vectorsGradient
+            = Eigen::RowVectorXd::LinSpaced(9, -1.0, 1.0).eval();
+        Function f(to(values, vectors));
+        values.setDerivative(valuesGradient);
+        vectors.setDerivative(vectorsGradient);
+        f.pullGradient();
+        THEN("the joint pullback combines them")
+        {
+            Eigen::MatrixXd const gradient
+                = valuesGradient * valuesDerivative
+                + vectorsGradient * vectorsDerivative;
+            CHECK(d(S).isApprox(gradient, 1E-6));
+        }
+    }
+}
@@ -0,0 +1,114 @@
+#include "common.hpp"
+
+#include <AutoDiff/src/Core/Function.hpp>
+#include <AutoDiff/src/Core/Variable.hpp>
+
+#include <AutoDiff/src/Eigen/LinearAlgebra/ops/ThinQR.hpp>
+
+#include <utility> // pair
+
+using AutoDiff::Function;
+using AutoDiff::to;
+using AutoDiff::var;
+
+// dR = U R,   dQ = dA R^-1 - Q U,   U = triu(X) + tril(X, -1)^T,
+// X = Q^T dA R^-1
+
+namespace {
+
+// the unique thin QR decomposition with nonnegative diagonal of R
+auto factors(Eigen::MatrixXd const& a)
+    -> std::pair<Eigen::MatrixXd, Eigen::MatrixXd>
+{
+    auto const qr = Eigen::HouseholderQR<Eigen::MatrixXd>(a);
+    Eigen::MatrixXd q
+        = qr.householderQ() * Eigen::MatrixXd::Identity(a.rows(), a.cols());
+    Eigen::MatrixXd r
+        = qr.matrixQR().topRows(a.cols()).triangularView<Eigen::Upper>();
+    for (Eigen::Index i = 0; i != a.cols(); ++i) {
+        if (r(i, i) < 0) {
+            r.row(i) *= -1;
+            q.col(i) *= -1;
+        }
+    }
+    return {q, r};
+}
+
+// central differences along the coefficients
+template <typename Fn>
+auto differences(Fn const& fn, Eigen::MatrixXd const& a) -> Eigen::MatrixXd
+{
+    auto const eps = 1E-6;
+    auto jacobian  = Eigen::MatrixXd(fn(a).size(), a.size());
+    for (Eigen::Index k = 0; k != a.size(); ++k) {
+        Eigen::MatrixXd perturbation
+            = Eigen::MatrixXd::Zero(a.rows(), a.cols());
+        perturbation.reshaped()(k) = eps;
+        jacobian.col(k)
+            = (fn(a + perturbation) - fn(a - perturbation)).reshaped()
+            / (2 * eps);
+    }
+    return jacobian;
+}
+
+} // namespace
+
+SCENARIO("thinQR(A) with A in R^(3x2)", "EigenAD::ThinQR")
+{
+    auto const point = Eigen::MatrixXd{{1.0, 2.0}, {3.0, 4.0}, {5.0, 7.0}};
+    auto A      = var(point);
+    auto [Q, R] = thinQR(A);
+
+    auto const qDerivative = differences(
+        [](Eigen::MatrixXd const& a) { return factors(a).first; }, point);
+    auto const rDerivative = differences(
+        [](Eigen::MatrixXd const& a) { return factors(a).second; }, point);
+
+    THEN("the factors are correct")
+    {
+        CHECK(Q().rows() == 3);
+        CHECK(Q().cols() == 2);
+        CHECK((Q().transpose() * Q())
+                  .isApprox(Eigen::MatrixXd::Identity(2, 2)));
+        CHECK(R()(1, 0) == 0.0);
+        CHECK(R()(0, 0) > 0.0);
+        CHECK(R()(1, 1) > 0.0);
+        CHECK((Q() * R()).isApprox(point));
+    }
+    WHEN("pushing forward the tangent")
+    {
+        Function f(to(Q, R));
+        f.pushTangentAt(A);
+        THEN("the derivatives are correct")
+        {
+            CHECK(d(Q).isApprox(qDerivative, 1E-6));
+            CHECK(d(R).isApprox(rDerivative, 1E-6));
+        }
+    }
+    WHEN("pulling back the gradient of each output")
+    {
+        THEN("the derivatives are correct")
+        {
+            Function(Q).pullGradientAt(Q);
+            CHECK(d(A).isApprox(qDerivative, 1E-6));
+            Function(R).pullGradientAt(R);
+            CHECK(d(A).isApprox(rDerivative, 1E-6));
+        }
+    }
+    WHEN("pulling back the gradients of both outputs")
+    {
+        auto const qGradient
+            = Eigen::RowVectorXd::LinSpaced(6, -1.0, 1.0).eval();
+        auto const rGradient = Eigen::RowVector4d{1.0, 0.0, -2.0, 0.5};
+        Function f(to(Q, R));
+        Q.setDerivative(qGradient);
+        R.setDerivative(rGradient);
+        f.pullGradient();
+        THEN("the joint pullback combines them")
+        {
+            Eigen::MatrixXd const gradient
+                = qGradient * qDerivative + rGradient * rDerivative;
+            CHECK(d(A).isApprox(gradient, 1E-6));
+        }
+    }
+}
@@ -19,3 +19,28 @@ SCENARIO("x * y with x, y in R^(2x2)", "EigenAD::MatrixProduct")
         {0.0, 0.0, -0.5, 1.5}};
     CHECK_BINARY_OP(operator*, pX, pY, value, dX, dY, 1E-6);
 }
+
+SCENARIO("x * y with x in R^(1x2) and y in R^(2x3)", "EigenAD::MatrixProduct")
+{
+    auto const pX    = Eigen::MatrixXd{{1.0, 2.0}};
+    auto const pY    = Eigen::MatrixXd{{0.5, -1.0, 2.0}, {3.0, 0.0, -1.5}};
+    auto const value = Eigen::MatrixXd{{6.5, -1.0, -1.0}};
+    auto const dX    = Eigen::MatrixXd{{0.5, 3.0}, {-1.0, 0.0}, {2.0, -1.5}};
+    auto const dY    = Eigen::MatrixXd{//
+        {1.0, 2.0, 0.0, 0.0, 0.0, 0.0}, //
+        {0.0, 0.0, 1.0, 2.0, 0.0, 0.0}, //
+        {0.0, 0.0, 0.0, 0.0, 1.0, 2.0}};
+    CHECK_BINARY_OP(operator*, pX, pY, value, dX, dY, 1E-6);
+}
+
+SCENARIO("x * y with x in R^(3x2) and y in R^(2x1)", "EigenAD::MatrixProduct")
+{
+    auto const pX    = Eigen::MatrixXd{{1.0, 2.0}, {-0.5, 1.5}, {0.0, 1.0}};
+    auto const pY    = Eigen::MatrixXd{{2.0}, {-1.0}};
+    auto const value = Eigen::MatrixXd{{0.0}, {-2.5}, {-1.0}};
+    auto const dX    = Eigen::MatrixXd{//
+        {2.0, 0.0, 0.0, -1.0, 0.0, 0.0}, //
+        {0.0, 2.0, 0.0, 0.0, -1.0, 0.0}, //
+        {0.0, 0.0, 2.0, 0.0, 0.0, -1.0}};
+    CHECK_BINARY_OP(operator*, pX, pY, value, dX, pX, 1E-6);
+}
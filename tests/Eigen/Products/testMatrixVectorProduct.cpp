@@ -12,3 +12,15 @@ SCENARIO("x * y with x in R^(2x2) and y in R^2", "EigenAD::MatrixVectorProduct")
     auto const dY = Eigen::MatrixXd{{1.0, 2.0}, {-0.5, 1.5}};
     CHECK_BINARY_OP(operator*, pX, pY, value, dX, dY, 1E-6);
 }
+
+SCENARIO("x * y with x in R^(3x2) and y in R^2", "EigenAD::MatrixVectorProduct")
+{
+    auto const pX    = Eigen::MatrixXd{{1.0, 2.0}, {-0.5, 1.5}, {0.0, 1.0}};
+    auto const pY    = Eigen::VectorXd{{2.0, -1.0}};
+    auto const value = Eigen::VectorXd{{0.0, -2.5, -1.0}};
+    auto const dX    = Eigen::MatrixXd{//
+        {2.0, 0.0, 0.0, -1.0, 0.0, 0.0}, //
+        {0.0, 2.0, 0.0, 0.0, -1.0, 0.0}, //
+        {0.0, 0.0, 2.0, 0.0, 0.0, -1.0}};
+    CHECK_BINARY_OP(operator*, pX, pY, value, dX, pX, 1E-6);
+}
@@ -13,3 +13,21 @@ SCENARIO("tensorProduct(x, y)", "EigenAD::TensorProduct")
         = Eigen::MatrixXd{{1.0, 0.0}, {2.0, 0.0}, {0.0, 1.0}, {0.0, 2.0}};
     CHECK_BINARY_OP(tensorProduct, pX, pY, value, dX, dY, 1E-6);
 }
+
+SCENARIO("tensorProduct(x, y) with x in R^3 and y in R^2",
+    "EigenAD::TensorProduct")
+{
+    auto const pX    = Eigen::VectorXd{{1.0, 2.0, -1.0}};
+    auto const pY    = Eigen::VectorXd{{0.5, -2.0}};
+    auto const value = Eigen::MatrixXd{{0.5, -2.0}, {1.0, -4.0}, {-0.5, 2.0}};
+    auto const dX    = Eigen::MatrixXd{//
+        {0.5, 0.0, 0.0},                //
+        {0.0, 0.5, 0.0},                //
+        {0.0, 0.0, 0.5},                //
+        {-2.0, 0.0, 0.0},               //
+        {0.0, -2.0, 0.0},               //
+        {0.0, 0.0, -2.0}};
+    auto const dY    = Eigen::MatrixXd{{1.0, 0.0}, {2.0, 0.0}, {-1.0, 0.0},
+           {0.0, 1.0}, {0.0, 2.0}, {0.0, -1.0}};
+    CHECK_BINARY_OP(tensorProduct, pX, pY, value, dX, dY, 1E-6);
+}
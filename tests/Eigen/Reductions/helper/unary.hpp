@@ -15,6 +15,53 @@ namespace detail {
 template <typename T>
 using Unqualified_t = std::remove_cv_t<std::remove_reference_t<T>>;
 
+/**
+ * @brief point = MatrixBase, value = MatrixBase
+ */
+template <typename Value, typename Derivative, typename Derived, typename P,
+    typename V, typename D>
+void checkUnaryOp(test::MockOperation<Value, Derivative>& operand,
+    AutoDiff::Expression<Derived>& expression,
+    Eigen::MatrixBase<P> const& point, Eigen::MatrixBase<V> const& targetValue,
+    Eigen::MatrixBase<D> const& targetDeriv, double prec)
+{
+    operand.value() = point;
+    auto const exprValue{
+        expression._value()}; // evaluates expression, needed for diff
+    THEN("operation yields correct value")
+    {
+        CAPTURE(exprValue, targetValue);
+        CHECK(exprValue.isApprox(targetValue, prec));
+    }
+    auto const sizeP = point.size();
+    auto const sizeV = targetValue.size();
+    WHEN("pushing forward tangent")
+    {
+        operand.derivative() = Eigen::MatrixXd::Identity(sizeP, sizeP);
+        auto const opDerivative{expression._pushForward()};
+        THEN("operation yields correct derivative")
+        {
+            CAPTURE(opDerivative, targetDeriv);
+            CHECK(opDerivative.isApprox(targetDeriv, prec));
+        }
+    }
+    WHEN("pulling back gradient")
+    {
+        operand.derivative() = Eigen::MatrixXd::Zero(sizeP, sizeP);
+        expression._pullBack(Eigen::MatrixXd::Identity(sizeV, sizeV));
+        auto const opDerivative{operand.derivative()};
+        THEN("operation yields correct derivative")
+        {
+            CAPTURE(opDerivative, targetDeriv);
+            CHECK(opDerivative.isApprox(targetDeriv, prec));
+        }
+    }
+    THEN("operation has correct derivative type")
+    {
+        static_assert(std::is_same_v<typename Derived::Derivative, Derivative>);
+    }
+}
+
 /**
  * @brief point = MatrixBase, value = double
  */
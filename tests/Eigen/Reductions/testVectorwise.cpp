@@ -0,0 +1,143 @@
+#include "common.hpp"
+
+#include <AutoDiff/src/Core/Function.hpp>
+#include <AutoDiff/src/Core/Variable.hpp>
+
+#include <AutoDiff/src/Eigen/CWise/common.hpp>
+#include <AutoDiff/src/Eigen/CWise/ops/Sum.hpp>
+#include <AutoDiff/src/Eigen/Reductions/ops/Vectorwise.hpp>
+
+using AutoDiff::Function;
+using AutoDiff::var;
+using AutoDiff::EigenAD::hasColVectorValue_v;
+using AutoDiff::EigenAD::hasRowVectorValue_v;
+
+namespace {
+
+auto const point = Eigen::MatrixXd{{1.0, 2.0, -0.5}, {-3.0, 1.5, 4.0}};
+
+// the Jacobian of a reduction of each column with the given weights
+auto colwiseJacobian(Eigen::MatrixXd const& weights)
+{
+    auto jacobian = Eigen::MatrixXd::Zero(3, 6).eval();
+    for (Eigen::Index j = 0; j != 3; ++j) {
+        jacobian.row(j).segment(2 * j, 2) = weights.col(j).transpose();
+    }
+    return jacobian;
+}
+
+// the Jacobian of a reduction of each row with the given weights
+auto rowwiseJacobian(Eigen::MatrixXd const& weights)
+{
+    auto jacobian = Eigen::MatrixXd::Zero(2, 6).eval();
+    for (Eigen::Index j = 0; j != 3; ++j) {
+        for (Eigen::Index i = 0; i != 2; ++i) {
+            jacobian(i, i + 2 * j) = weights(i, j);
+        }
+    }
+    return jacobian;
+}
+
+} // namespace
+
+SCENARIO("colwiseSum(x) with x in R^(2x3)", "EigenAD::Vectorwise")
+{
+    auto const value      = Eigen::RowVectorXd{{-2.0, 3.5, 3.5}};
+    auto const derivative = colwiseJacobian(Eigen::MatrixXd::Ones(2, 3));
+    CHECK_UNARY_OP(colwiseSum, point, value, derivative, 1E-6);
+}
+
+SCENARIO("rowwiseSum(x) with x in R^(2x3)", "EigenAD::Vectorwise")
+{
+    auto const value      = Eigen::VectorXd{{2.5, 2.5}};
+    auto const derivative = rowwiseJacobian(Eigen::MatrixXd::Ones(2, 3));
+    CHECK_UNARY_OP(rowwiseSum, point, value, derivative, 1E-6);
+}
+
+SCENARIO("colwiseMean(x) with x in R^(2x3)", "EigenAD::Vectorwise")
+{
+    auto const value = Eigen::RowVectorXd{{-1.0, 1.75, 1.75}};
+    auto const derivative
+        = colwiseJacobian(Eigen::MatrixXd::Constant(2, 3, 0.5));
+    CHECK_UNARY_OP(colwiseMean, point, value, derivative, 1E-6);
+}
+
+SCENARIO("rowwiseMean(x) with x in R^(2x3)", "EigenAD::Vectorwise")
+{
+    auto const value = Eigen::VectorXd{{2.5 / 3.0, 2.5 / 3.0}};
+    auto const derivative
+        = rowwiseJacobian(Eigen::MatrixXd::Constant(2, 3, 1.0 / 3.0));
+    CHECK_UNARY_OP(rowwiseMean, point, value, derivative, 1E-6);
+}
+
+SCENARIO("colwiseSquaredNorm(x) with x in R^(2x3)", "EigenAD::Vectorwise")
+{
+    auto const value      = Eigen::RowVectorXd{{10.0, 6.25, 16.25}};
+    auto const derivative = colwiseJacobian(2.0 * point);
+    CHECK_UNARY_OP(colwiseSquaredNorm, point, value, derivative, 1E-6);
+}
+
+SCENARIO("rowwiseSquaredNorm(x) with x in R^(2x3)", "EigenAD::Vectorwise")
+{
+    auto const value      = Eigen::VectorXd{{5.25, 27.25}};
+    auto const derivative = rowwiseJacobian(2.0 * point);
+    CHECK_UNARY_OP(rowwiseSquaredNorm, point, value, derivative, 1E-6);
+}
+
+SCENARIO("colwiseNorm(x) with x in R^(2x3)", "EigenAD::Vectorwise")
+{
+    auto const value = point.colwise().norm().eval();
+    auto const derivative
+        = colwiseJacobian(point.array().rowwise() / value.array());
+    CHECK_UNARY_OP(colwiseNorm, point, value, derivative, 1E-6);
+}
+
+SCENARIO("rowwiseNorm(x) with x in R^(2x3)", "EigenAD::Vectorwise")
+{
+    auto const value = point.rowwise().norm().eval();
+    auto const derivative
+        = rowwiseJacobian(point.array().colwise() / value.array());
+    CHECK_UNARY_OP(rowwiseNorm, point, value, derivative, 1E-6);
+}
+
+SCENARIO("colwiseMax(x) with x in R^(2x3)", "EigenAD::Vectorwise")
+{
+    auto const value = Eigen::RowVectorXd{{1.0, 2.0, 4.0}};
+    auto const derivative
+        = colwiseJacobian(Eigen::MatrixXd{{1.0, 1.0, 0.0}, {0.0, 0.0, 1.0}});
+    CHECK_UNARY_OP(colwiseMax, point, value, derivative, 1E-6);
+}
+
+SCENARIO("rowwiseMin(x) with x in R^(2x3)", "EigenAD::Vectorwise")
+{
+    auto const value = Eigen::VectorXd{{-0.5, -3.0}};
+    auto const derivative
+        = rowwiseJacobian(Eigen::MatrixXd{{0.0, 0.0, 1.0}, {1.0, 0.0, 0.0}});
+    CHECK_UNARY_OP(rowwiseMin, point, value, derivative, 1E-6);
+}
+
+SCENARIO("colwiseSum(x) + colwiseSum(y) with x, y in R^(2x3)",
+    "EigenAD::Vectorwise")
+{
+    auto x = var(point);
+    auto y = var(Eigen::MatrixXd{{0.5, 1.0, -1.0}, {2.0, 0.0, 1.0}});
+
+    THEN("the reductions keep their vector shapes")
+    {
+        static_assert(hasRowVectorValue_v<decltype(colwiseSum(x))>);
+        static_assert(hasColVectorValue_v<decltype(rowwiseSum(x))>);
+    }
+    WHEN("the reductions are operands of a sum")
+    {
+        auto v = var(colwiseSum(x) + colwiseSum(y));
+        Function f(v);
+        v.setDerivative(Eigen::RowVectorXd::Ones(3));
+        f.pullGradient();
+        THEN("the sum reads both reductions")
+        {
+            CHECK(v().isApprox(Eigen::RowVectorXd{{0.5, 4.5, 3.5}}));
+            CHECK(d(x).isApprox(Eigen::RowVectorXd::Ones(6)));
+            CHECK(d(y).isApprox(Eigen::RowVectorXd::Ones(6)));
+        }
+    }
+}
@@ -0,0 +1,33 @@
+#ifndef TESTS_EIGEN_TENSOR_COMMON_HPP
+#define TESTS_EIGEN_TENSOR_COMMON_HPP
+
+#include "helper/jacobian.hpp"
+
+// must be included before including single operations
+#include <AutoDiff/src/Eigen/Tensor/common.hpp>
+#include <AutoDiff/src/Eigen/module.hpp>
+
+#include <unsupported/Eigen/CXX11/Tensor>
+
+#include <algorithm>
+#include <array>
+#include <cstddef>
+
+template <int Rank>
+using Tensor = Eigen::Tensor<double, Rank, 0, std::ptrdiff_t>;
+
+/**
+ * @brief A tensor with linearly spaced coefficients (in storage order).
+ */
+template <int Rank>
+auto linSpaced(std::array<std::ptrdiff_t, Rank> const& dims, double low,
+    double high) -> Tensor<Rank>
+{
+    auto tensor = Tensor<Rank>(dims);
+    auto const coeffs
+        = Eigen::VectorXd::LinSpaced(tensor.size(), low, high).eval();
+    std::copy(coeffs.data(), coeffs.data() + coeffs.size(), tensor.data());
+    return tensor;
+}
+
+#endif // TESTS_EIGEN_TENSOR_COMMON_HPP
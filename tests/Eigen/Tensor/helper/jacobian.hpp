@@ -0,0 +1,203 @@
+#ifndef TESTS_MODULES_EIGEN_TENSOR_HELPER_JACOBIAN_HPP
+#define TESTS_MODULES_EIGEN_TENSOR_HELPER_JACOBIAN_HPP
+
+#include "../../../helper/MockOperation.hpp"
+
+#include <Eigen/Core>
+#include <unsupported/Eigen/CXX11/Tensor>
+
+#include <catch2/catch_test_macros.hpp>
+
+#include <type_traits>
+
+namespace detail {
+
+template <typename T>
+using Unqualified_t = std::remove_cv_t<std::remove_reference_t<T>>;
+
+/**
+ * @brief The coefficients of a scalar or (evaluated) tensor as vector.
+ */
+template <typename T>
+auto flatValue(T const& value) -> Eigen::VectorXd
+{
+    if constexpr (std::is_arithmetic_v<T>) {
+        return Eigen::VectorXd::Constant(1, value);
+    } else {
+        using Plain = Eigen::Tensor<double, T::NumDimensions, 0,
+            std::ptrdiff_t>;
+        Plain const tensor = value;
+        return Eigen::Map<Eigen::VectorXd const>(tensor.data(), tensor.size());
+    }
+}
+
+template <typename T>
+auto flatSize(T const& point) -> Eigen::Index
+{
+    if constexpr (std::is_arithmetic_v<T>) {
+        return 1;
+    } else {
+        return point.size();
+    }
+}
+
+/**
+ * @brief The Jacobian of a function by central finite differences.
+ */
+template <typename Function, typename Point>
+auto numericJacobian(Function const& function, Point const& point)
+    -> Eigen::MatrixXd
+{
+    auto const step = 1E-6;
+    auto const rows = flatValue(function(point)).size();
+    auto const cols = flatSize(point);
+    auto jacobian   = Eigen::MatrixXd(rows, cols);
+    for (Eigen::Index j = 0; j != cols; ++j) {
+        auto plus  = point;
+        auto minus = point;
+        if constexpr (std::is_arithmetic_v<Point>) {
+            plus += step;
+            minus -= step;
+        } else {
+            plus.data()[j] += step;
+            minus.data()[j] -= step;
+        }
+        jacobian.col(j)
+            = (flatValue(function(plus)) - flatValue(function(minus)))
+            / (2 * step);
+    }
+    return jacobian;
+}
+
+/**
+ * @brief Compares value and derivatives with the reference @p function.
+ */
+template <typename Value, typename Derived, typename Function>
+void checkUnaryOp(test::MockOperation<Value, Eigen::MatrixXd>& operand,
+    AutoDiff::Expression<Derived>& expression, Function const& function,
+    Value const& point, double prec)
+{
+    operand.value() = point;
+    auto const exprValue{flatValue(
+        expression._value())}; // evaluates expression, needed for diff
+    auto const targetValue = flatValue(function(point));
+    THEN("operation yields correct value")
+    {
+        CAPTURE(exprValue, targetValue);
+        CHECK(exprValue.isApprox(targetValue, prec));
+    }
+    auto const targetDeriv = numericJacobian(function, point);
+    auto const rows        = targetDeriv.rows();
+    auto const cols        = targetDeriv.cols();
+    WHEN("pushing forward tangent")
+    {
+        operand.derivative() = Eigen::MatrixXd::Identity(cols, cols);
+        auto const opDerivative = Eigen::MatrixXd(expression._pushForward());
+        THEN("operation yields correct derivative")
+        {
+            CAPTURE(opDerivative, targetDeriv);
+            CHECK(opDerivative.isApprox(targetDeriv, prec));
+        }
+    }
+    WHEN("pulling back gradient")
+    {
+        operand.derivative() = Eigen::MatrixXd::Zero(rows, cols);
+        expression._pullBack(Eigen::MatrixXd::Identity(rows, rows));
+        auto const opDerivative{operand.derivative()};
+        THEN("operation yields correct derivative")
+        {
+            CAPTURE(opDerivative, targetDeriv);
+            CHECK(opDerivative.isApprox(targetDeriv, prec));
+        }
+    }
+}
+
+/**
+ * @brief Compares value and derivatives with the reference @p function.
+ */
+template <typename ValueX, typename ValueY, typename Derived,
+    typename Function>
+void checkBinaryOp(test::MockOperation<ValueX, Eigen::MatrixXd>& operandX,
+    test::MockOperation<ValueY, Eigen::MatrixXd>& operandY,
+    AutoDiff::Expression<Derived>& expression, Function const& function,
+    ValueX const& pointX, ValueY const& pointY, double prec)
+{
+    operandX.value() = pointX;
+    operandY.value() = pointY;
+    auto const exprValue{flatValue(
+        expression._value())}; // evaluates expression, needed for diff
+    auto const targetValue = flatValue(function(pointX, pointY));
+    THEN("operation yields correct value")
+    {
+        CAPTURE(exprValue, targetValue);
+        CHECK(exprValue.isApprox(targetValue, prec));
+    }
+    auto const targetDerivX = numericJacobian(
+        [&](auto const& x) { return function(x, pointY); }, pointX);
+    auto const targetDerivY = numericJacobian(
+        [&](auto const& y) { return function(pointX, y); }, pointY);
+    auto const rows  = targetDerivX.rows();
+    auto const colsX = targetDerivX.cols();
+    auto const colsY = targetDerivY.cols();
+    auto const cols  = colsX + colsY;
+    WHEN("pushing forward tangent")
+    {
+        // the columns of the domain are (x, y)
+        operandX.derivative() = Eigen::MatrixXd::Identity(colsX, cols);
+        operandY.derivative() = Eigen::MatrixXd::Zero(colsY, cols);
+        operandY.derivative().rightCols(colsY).setIdentity();
+        auto const opDerivative = Eigen::MatrixXd(expression._pushForward());
+        THEN("operation yields correct derivative")
+        {
+            CAPTURE(opDerivative, targetDerivX, targetDerivY);
+            CHECK(opDerivative.leftCols(colsX).isApprox(targetDerivX, prec));
+            CHECK(opDerivative.rightCols(colsY).isApprox(targetDerivY, prec));
+        }
+    }
+    WHEN("pulling back gradient")
+    {
+        expression._pullBack(Eigen::MatrixXd::Identity(rows, rows));
+        auto const derivativeX{operandX.derivative()};
+        auto const derivativeY{operandY.derivative()};
+        THEN("operation yields correct derivatives")
+        {
+            CAPTURE(derivativeX, targetDerivX);
+            CHECK(derivativeX.isApprox(targetDerivX, prec));
+            CAPTURE(derivativeY, targetDerivY);
+            CHECK(derivativeY.isApprox(targetDerivY, prec));
+        }
+    }
+}
+
+} // namespace detail
+
+/**
+ * @brief Checks whether, given point p, the unary operation agrees with the
+ * reference function f in value and (finite-difference) derivative.
+ */
+#define CHECK_TENSOR_UNARY_OP(operation, f, p, prec)                           \
+    WHEN("evaluating")                                                         \
+    {                                                                          \
+        using Point     = detail::Unqualified_t<decltype(p)>;                  \
+        auto operand    = test::MockOperation<Point, Eigen::MatrixXd>();       \
+        auto expression = operation(operand);                                  \
+        detail::checkUnaryOp(operand, expression, f, p, prec);                 \
+    }
+
+/**
+ * @brief Checks whether, given points pX and pY, the binary operation agrees
+ * with the reference function f in value and (finite-difference) derivatives.
+ */
+#define CHECK_TENSOR_BINARY_OP(operation, f, pX, pY, prec)                     \
+    WHEN("evaluating")                                                         \
+    {                                                                          \
+        using PointX    = detail::Unqualified_t<decltype(pX)>;                 \
+        using PointY    = detail::Unqualified_t<decltype(pY)>;                 \
+        auto operandX   = test::MockOperation<PointX, Eigen::MatrixXd>();      \
+        auto operandY   = test::MockOperation<PointY, Eigen::MatrixXd>();      \
+        auto expression = operation(operandX, operandY);                       \
+        detail::checkBinaryOp(                                                 \
+            operandX, operandY, expression, f, pX, pY, prec);                  \
+    }
+
+#endif // TESTS_MODULES_EIGEN_TENSOR_HELPER_JACOBIAN_HPP
@@ -0,0 +1,15 @@
+#include "common.hpp"
+
+#include <AutoDiff/src/Eigen/Tensor/ops/Broadcast.hpp>
+
+SCENARIO("broadcast(x, {2, 1, 3}) with x in R^(2x3x1)",
+    "EigenAD::Tensor::Broadcast")
+{
+    auto const factors  = std::array<int, 3>{2, 1, 3};
+    auto const point    = linSpaced<3>({2, 3, 1}, -1.0, 2.0);
+    auto const op       = [&](auto const& x) { return broadcast(x, factors); };
+    auto const function = [&](Tensor<3> const& x) -> Tensor<3> {
+        return x.broadcast(factors);
+    };
+    CHECK_TENSOR_UNARY_OP(op, function, point, 1E-6);
+}
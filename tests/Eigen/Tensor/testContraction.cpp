@@ -0,0 +1,49 @@
+#include "common.hpp"
+
+#include <AutoDiff/src/Eigen/Tensor/ops/Contraction.hpp>
+
+using Pair = Eigen::IndexPair<int>;
+
+SCENARIO("contract(x, y) over one pair with x in R^(2x3x4), y in R^(4x3)",
+    "EigenAD::Tensor::Contraction")
+{
+    auto const pairs = std::array<Pair, 1>{Pair(2, 0)};
+    auto const pX    = linSpaced<3>({2, 3, 4}, -1.0, 2.0);
+    auto const pY    = linSpaced<2>({4, 3}, 0.5, -1.5);
+    auto const op    = [&](auto const& x, auto const& y) {
+        return contract(x, y, pairs);
+    };
+    auto const function = [&](Tensor<3> const& x, Tensor<2> const& y)
+        -> Tensor<3> { return x.contract(y, pairs); };
+    CHECK_TENSOR_BINARY_OP(op, function, pX, pY, 1E-6);
+}
+
+SCENARIO("contract(x, y) over two crossed pairs with x in R^(2x3x4), "
+         "y in R^(4x5x2)",
+    "EigenAD::Tensor::Contraction")
+{
+    auto const pairs = std::array<Pair, 2>{Pair(2, 0), Pair(0, 2)};
+    auto const pX    = linSpaced<3>({2, 3, 4}, -1.0, 2.0);
+    auto const pY    = linSpaced<3>({4, 5, 2}, 0.5, -1.5);
+    auto const op    = [&](auto const& x, auto const& y) {
+        return contract(x, y, pairs);
+    };
+    auto const function = [&](Tensor<3> const& x, Tensor<3> const& y)
+        -> Tensor<2> { return x.contract(y, pairs); };
+    CHECK_TENSOR_BINARY_OP(op, function, pX, pY, 1E-6);
+}
+
+SCENARIO("contract(x, y) over a middle pair with x in R^(2x3), "
+         "y in R^(4x3x2)",
+    "EigenAD::Tensor::Contraction")
+{
+    auto const pairs = std::array<Pair, 1>{Pair(1, 1)};
+    auto const pX    = linSpaced<2>({2, 3}, -1.0, 2.0);
+    auto const pY    = linSpaced<3>({4, 3, 2}, 0.5, -1.5);
+    auto const op    = [&](auto const& x, auto const& y) {
+        return contract(x, y, pairs);
+    };
+    auto const function = [&](Tensor<2> const& x, Tensor<3> const& y)
+        -> Tensor<3> { return x.contract(y, pairs); };
+    CHECK_TENSOR_BINARY_OP(op, function, pX, pY, 1E-6);
+}
@@ -0,0 +1,11 @@
+#include "common.hpp"
+
+#include <AutoDiff/src/Eigen/Tensor/ops/Exp.hpp>
+
+SCENARIO("exp(x) with x in R^(2x3x2)", "EigenAD::Tensor::Exp")
+{
+    auto const point = linSpaced<3>({2, 3, 2}, -1.0, 1.0);
+    auto const function
+        = [](Tensor<3> const& x) -> Tensor<3> { return x.exp(); };
+    CHECK_TENSOR_UNARY_OP(exp, function, point, 1E-6);
+}
@@ -0,0 +1,11 @@
+#include "common.hpp"
+
+#include <AutoDiff/src/Eigen/Tensor/ops/Log.hpp>
+
+SCENARIO("log(x) with x in R^(2x3x2)", "EigenAD::Tensor::Log")
+{
+    auto const point = linSpaced<3>({2, 3, 2}, 0.5, 3.0);
+    auto const function
+        = [](Tensor<3> const& x) -> Tensor<3> { return x.log(); };
+    CHECK_TENSOR_UNARY_OP(log, function, point, 1E-6);
+}
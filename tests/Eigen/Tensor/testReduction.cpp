@@ -0,0 +1,25 @@
+#include "common.hpp"
+
+#include <AutoDiff/src/Eigen/Tensor/ops/Reduction.hpp>
+
+SCENARIO("sum(x, {0, 2}) with x in R^(2x3x4)", "EigenAD::Tensor::Reduction")
+{
+    auto const axes     = std::array<int, 2>{0, 2};
+    auto const point    = linSpaced<3>({2, 3, 4}, -1.0, 2.0);
+    auto const op       = [&](auto const& x) { return sum(x, axes); };
+    auto const function = [&](Tensor<3> const& x) -> Tensor<1> {
+        return x.sum(axes);
+    };
+    CHECK_TENSOR_UNARY_OP(op, function, point, 1E-6);
+}
+
+SCENARIO("mean(x, {1}) with x in R^(2x3x4)", "EigenAD::Tensor::Reduction")
+{
+    auto const axes     = std::array<int, 1>{1};
+    auto const point    = linSpaced<3>({2, 3, 4}, -1.0, 2.0);
+    auto const op       = [&](auto const& x) { return mean(x, axes); };
+    auto const function = [&](Tensor<3> const& x) -> Tensor<2> {
+        return x.mean(axes);
+    };
+    CHECK_TENSOR_UNARY_OP(op, function, point, 1E-6);
+}
@@ -0,0 +1,11 @@
+#include "common.hpp"
+
+#include <AutoDiff/src/Eigen/Tensor/ops/Sqrt.hpp>
+
+SCENARIO("sqrt(x) with x in R^(2x3x2)", "EigenAD::Tensor::Sqrt")
+{
+    auto const point = linSpaced<3>({2, 3, 2}, 0.5, 3.0);
+    auto const function
+        = [](Tensor<3> const& x) -> Tensor<3> { return x.sqrt(); };
+    CHECK_TENSOR_UNARY_OP(sqrt, function, point, 1E-6);
+}
@@ -0,0 +1,12 @@
+#include "common.hpp"
+
+#include <AutoDiff/src/Eigen/Tensor/ops/Sum.hpp>
+
+SCENARIO("x + y with x, y in R^(2x3x2)", "EigenAD::Tensor::Sum")
+{
+    auto const pX       = linSpaced<3>({2, 3, 2}, -1.0, 2.0);
+    auto const pY       = linSpaced<3>({2, 3, 2}, 0.5, -1.5);
+    auto const function = [](Tensor<3> const& x, Tensor<3> const& y)
+        -> Tensor<3> { return x + y; };
+    CHECK_TENSOR_BINARY_OP(operator+, function, pX, pY, 1E-6);
+}
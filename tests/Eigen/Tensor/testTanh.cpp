@@ -0,0 +1,11 @@
+#include "common.hpp"
+
+#include <AutoDiff/src/Eigen/Tensor/ops/Tanh.hpp>
+
+SCENARIO("tanh(x) with x in R^(2x3x2)", "EigenAD::Tensor::Tanh")
+{
+    auto const point = linSpaced<3>({2, 3, 2}, -1.5, 2.0);
+    auto const function
+        = [](Tensor<3> const& x) -> Tensor<3> { return x.tanh(); };
+    CHECK_TENSOR_UNARY_OP(tanh, function, point, 1E-6);
+}
@@ -0,0 +1,12 @@
+#include "common.hpp"
+
+#include <AutoDiff/src/Eigen/Tensor/ops/Total.hpp>
+
+SCENARIO("total(x) with x in R^(2x3x2)", "EigenAD::Tensor::Total")
+{
+    auto const point    = linSpaced<3>({2, 3, 2}, -1.0, 2.0);
+    auto const function = [](Tensor<3> const& x) -> double {
+        return Tensor<0>(x.sum())();
+    };
+    CHECK_TENSOR_UNARY_OP(total, function, point, 1E-6);
+}
@@ -0,0 +1,150 @@
+#include <AutoDiff/Core>
+#include <AutoDiff/Eigen>
+
+#include <Eigen/Core>
+
+#include <catch2/catch_test_macros.hpp>
+
+#include <atomic>
+#include <cstddef> // size_t
+#include <cstdlib> // free malloc
+#include <new>     // bad_alloc nothrow_t
+#include <type_traits>
+
+using AutoDiff::Function;
+using AutoDiff::var;
+
+using Derivative = AutoDiff::FixedDerivative<9>;
+using Real       = AutoDiff::FixedReal<9>;
+using Vector3d   = AutoDiff::FixedVector3d<9>;
+using Matrix3d   = AutoDiff::FixedMatrix3d<9>;
+
+static_assert(Derivative::MaxRowsAtCompileTime == 9
+              && Derivative::MaxColsAtCompileTime == 9);
+static_assert(std::is_same_v<std::decay_t<decltype(d(std::declval<Real&>()))>,
+    Derivative>);
+
+namespace {
+
+// allocations with operator new (Eigen allocates with malloc, which tests
+// forbid with Eigen::internal::set_is_malloc_allowed instead)
+std::atomic<std::size_t> allocations{0};
+
+} // namespace
+
+auto operator new(std::size_t size) -> void*
+{
+    ++allocations;
+    if (auto* memory = std::malloc(size == 0 ? 1 : size)) {
+        return memory;
+    }
+    throw std::bad_alloc();
+}
+
+auto operator new(std::size_t size, std::nothrow_t const& /*tag*/) noexcept
+    -> void*
+{
+    ++allocations;
+    return std::malloc(size == 0 ? 1 : size);
+}
+
+void operator delete(void* memory) noexcept { std::free(memory); }
+
+void operator delete(void* memory, std::size_t /*size*/) noexcept
+{
+    std::free(memory);
+}
+
+SCENARIO("Differentiating small fixed-size values with fixed derivatives",
+    "[FixedDerivatives]")
+{
+    GIVEN("z = a ||R R p + t||^2 + dot(sin(p), t) with 3x3 R and 3-vectors")
+    {
+        auto const pointR = Eigen::Matrix3d{
+            {0.0, -1.0, 0.0}, {1.0, 0.0, 0.0}, {0.0, 0.0, 1.0}};
+        auto const pointP = Eigen::Vector3d{1.0, 2.0, 3.0};
+        auto const pointT = Eigen::Vector3d{0.5, 0.0, -1.0};
+
+        auto R = Matrix3d(pointR);
+        auto p = Vector3d(pointP);
+        auto t = Vector3d(pointT);
+        auto a = Real(0.5);
+        auto q = var(R * var(R * p));
+        auto y = var(q + t);
+        auto z = var(a * squaredNorm(y) + dot(var(sin(p)), t));
+
+        // the same computation with dynamic derivatives
+        auto refR = AutoDiff::Matrix3d(pointR);
+        auto refP = AutoDiff::Vector3d(pointP);
+        auto refT = AutoDiff::Vector3d(pointT);
+        auto refA = AutoDiff::Real(0.5);
+        auto refQ = var(refR * var(refR * refP));
+        auto refY = var(refQ + refT);
+        auto refZ = var(
+            refA * squaredNorm(refY) + dot(var(sin(refP)), refT));
+
+        CHECK(z() == refZ());
+
+        WHEN("pulling back the gradient of z")
+        {
+            Function(from(refR, refP, refT, refA), to(refZ))
+                .pullGradientAt(refZ);
+            Function f(from(R, p, t, a), to(z));
+            f.pullGradientAt(z);
+            THEN("the gradients are correct")
+            {
+                CHECK(d(R).isApprox(d(refR)));
+                CHECK(d(p).isApprox(d(refP)));
+                CHECK(d(t).isApprox(d(refT)));
+                CHECK(d(a).isApprox(d(refA)));
+            }
+        }
+        WHEN("pushing forward the tangent of R")
+        {
+            Function(from(refR, refP, refT, refA), to(refZ))
+                .pushTangentAt(refR);
+            Function f(from(R, p, t, a), to(z));
+            f.pushTangentAt(R);
+            THEN("the derivatives are correct")
+            {
+                CHECK(d(q).rows() == 3);
+                CHECK(d(q).cols() == 9);
+                CHECK(d(q).isApprox(d(refQ)));
+                CHECK(d(z).isApprox(d(refZ)));
+            }
+        }
+    }
+}
+
+SCENARIO("Differentiating with fixed derivatives does not allocate",
+    "[FixedDerivatives]")
+{
+    GIVEN("z = a ||R p + t||^2 with 3x3 R and 3-vectors")
+    {
+        auto R = Matrix3d(Eigen::Matrix3d::Identity());
+        auto p = Vector3d(Eigen::Vector3d{1.0, 2.0, 3.0});
+        auto t = Vector3d(Eigen::Vector3d{0.5, 0.0, -1.0});
+        auto a = Real(0.5);
+        auto y = var(R * p + t);
+        auto z = var(a * squaredNorm(y));
+
+        Function f(from(R, p, t, a), to(z));
+        f.pullGradientAt(z); // compiles the function
+
+        WHEN("pulling back the gradient of z again")
+        {
+            auto const before = allocations.load();
+            Eigen::internal::set_is_malloc_allowed(false);
+            f.evaluate();
+            f.pullGradientAt(z);
+            Eigen::internal::set_is_malloc_allowed(true);
+            auto const count = allocations.load() - before;
+            THEN("no memory is allocated")
+            {
+                CHECK(count == 0);
+                // dz/dp = 2 a y^T R with a = 1/2 and R = I
+                CHECK(d(p).isApprox(y().transpose()));
+            }
+        }
+    }
+}
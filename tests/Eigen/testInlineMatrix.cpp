@@ -0,0 +1,144 @@
+#include <AutoDiff/Core>
+#include <AutoDiff/Eigen>
+
+#include <Eigen/Core>
+
+#include <catch2/catch_test_macros.hpp>
+
+#include <utility>
+
+using AutoDiff::Function;
+using AutoDiff::var;
+using AutoDiff::Variable;
+using AutoDiff::EigenAD::InlineMatrix;
+
+using Inline = InlineMatrix<double, 4>;
+using Real   = Variable<double, InlineMatrix<double>>;
+using Vector = Variable<Eigen::VectorXd, InlineMatrix<double>>;
+
+SCENARIO("Storage of inline matrices", "[InlineMatrix]")
+{
+    GIVEN("a matrix with at most as many coefficients as stored inline")
+    {
+        auto const coeffs = Eigen::MatrixXd{{1.0, 2.0}, {3.0, 4.0}};
+        auto matrix       = Inline(coeffs);
+        THEN("the coefficients are stored inline")
+        {
+            CHECK(matrix.isInline());
+            CHECK(matrix == coeffs);
+        }
+        WHEN("the matrix is copied or moved")
+        {
+            auto copy  = matrix;
+            auto moved = std::move(matrix);
+            THEN("each matrix views its own storage")
+            {
+                CHECK(copy == coeffs);
+                CHECK(moved == coeffs);
+                CHECK(copy.data() != moved.data());
+                CHECK(moved.isInline());
+            }
+        }
+        WHEN("a larger expression of the matrix itself is assigned")
+        {
+            matrix = matrix.replicate(3, 1);
+            THEN("the expression is evaluated before the storage is replaced")
+            {
+                CHECK_FALSE(matrix.isInline());
+                CHECK(matrix == coeffs.replicate(3, 1));
+            }
+            AND_WHEN("the heap storage is outgrown the same way")
+            {
+                matrix = matrix.replicate(1, 2);
+                THEN("the expression is evaluated before the storage is "
+                     "replaced")
+                {
+                    CHECK(matrix == coeffs.replicate(3, 2));
+                }
+            }
+        }
+        WHEN("a larger matrix is assigned")
+        {
+            matrix = Eigen::MatrixXd::Ones(3, 2);
+            THEN("the coefficients are stored on the heap")
+            {
+                CHECK_FALSE(matrix.isInline());
+                CHECK(matrix.capacity() == 6);
+                CHECK(matrix == Eigen::MatrixXd::Ones(3, 2));
+            }
+            AND_WHEN("the matrix is shrunk again")
+            {
+                auto const* const data = matrix.data();
+                matrix.setZero(1, 2);
+                THEN("the heap storage is reused")
+                {
+                    CHECK(matrix.data() == data);
+                    CHECK(matrix == Eigen::MatrixXd::Zero(1, 2));
+                }
+            }
+            AND_WHEN("the matrix is moved")
+            {
+                auto const* const data = matrix.data();
+                auto moved             = std::move(matrix);
+                THEN("the heap storage is taken over")
+                {
+                    CHECK(moved.data() == data);
+                    CHECK(moved == Eigen::MatrixXd::Ones(3, 2));
+                    CHECK(matrix.size() == 0);
+                }
+            }
+        }
+    }
+}
+
+SCENARIO("Differentiating scalar-heavy graphs with inline derivatives",
+    "[InlineMatrix]")
+{
+    GIVEN("z = sqrt(y) + x1 y + ||v|| with y = a ||v||^2 + x1 / 2 "
+          "and x1 = a^2 + b sin(b)")
+    {
+        auto const pointV = Eigen::VectorXd{{0.5, -1.0, 2.0}};
+
+        auto a  = Real(0.3);
+        auto b  = Real(1.2);
+        auto v  = Vector(pointV);
+        auto x1 = var(a * a + b * sin(b));
+        auto y  = var(a * squaredNorm(v) + x1 * 0.5);
+        auto z  = var(sqrt(y) + x1 * y + norm(v));
+
+        // the same computation with heap-allocated derivatives
+        auto refA  = AutoDiff::Real(0.3);
+        auto refB  = AutoDiff::Real(1.2);
+        auto refV  = AutoDiff::Vector(pointV);
+        auto refX1 = var(refA * refA + refB * sin(refB));
+        auto refY  = var(refA * squaredNorm(refV) + refX1 * 0.5);
+        auto refZ  = var(sqrt(refY) + refX1 * refY + norm(refV));
+
+        CHECK(z() == refZ());
+
+        WHEN("pulling back the gradient of z")
+        {
+            Function(from(refA, refB, refV), to(refZ)).pullGradientAt(refZ);
+            Function f(from(a, b, v), to(z));
+            f.pullGradientAt(z);
+            THEN("the gradients are correct and stored inline")
+            {
+                CHECK(d(a).isApprox(d(refA)));
+                CHECK(d(b).isApprox(d(refB)));
+                CHECK(d(v).isApprox(d(refV)));
+                CHECK(d(a).isInline());
+            }
+        }
+        WHEN("pushing forward the tangent of v")
+        {
+            Function(from(refA, refB, refV), to(refZ)).pushTangentAt(refV);
+            Function f(from(a, b, v), to(z));
+            f.pushTangentAt(v);
+            THEN("the derivatives are correct")
+            {
+                CHECK(d(y).isApprox(d(refY)));
+                CHECK(d(z).isApprox(d(refZ)));
+            }
+        }
+    }
+}
@@ -0,0 +1,97 @@
+#include <AutoDiff/Core>
+#include <AutoDiff/Eigen>
+
+#include <Eigen/Core>
+
+#include <catch2/catch_test_macros.hpp>
+
+#include <type_traits>
+#include <vector>
+
+using AutoDiff::ArrayMap;
+using AutoDiff::ConstMap;
+using AutoDiff::Function;
+using AutoDiff::var;
+using AutoDiff::VectorMap;
+
+static_assert(std::is_same_v<
+    std::decay_t<decltype(d(std::declval<VectorMap&>()))>, Eigen::MatrixXd>);
+static_assert(std::is_same_v<
+    std::decay_t<decltype(d(std::declval<ArrayMap&>()))>, Eigen::ArrayXd>);
+static_assert(std::is_same_v<decltype(var(std::declval<VectorMap&>())),
+    AutoDiff::Vector>);
+
+SCENARIO("Source variables viewing external memory", "[Maps]")
+{
+    GIVEN("z = dot(y, y) with y = A x + b, and x viewing a buffer of batches")
+    {
+        auto const A = Eigen::MatrixXd{{0.5, -1.0}, {0.25, 2.0}, {1.0, 0.0}};
+        auto const b = Eigen::VectorXd{{1.0, -0.5, 0.25}};
+        auto const buffer = std::vector<double>{0.5, 1.5, -1.0, 2.0};
+
+        auto x = VectorMap(ConstMap<Eigen::VectorXd>(buffer.data(), 2));
+        auto y = var(A * x + b);
+        auto z = var(dot(y, y));
+
+        auto const valueAt = [&](Eigen::VectorXd const& point) {
+            return (A * point + b).squaredNorm();
+        };
+        auto const gradientAt = [&](Eigen::VectorXd const& point) {
+            return (2.0 * (A * point + b).transpose() * A).eval();
+        };
+
+        THEN("x views the buffer without copying it")
+        {
+            CHECK(x().data() == buffer.data());
+            CHECK(z() == valueAt(Eigen::VectorXd{{0.5, 1.5}}));
+        }
+        WHEN("x is rebound to the next batch and the function is evaluated")
+        {
+            Function f(from(x), to(z));
+            x = ConstMap<Eigen::VectorXd>(buffer.data() + 2, 2);
+            f.evaluate();
+            f.pullGradientAt(z);
+            THEN("the value and gradient are those of the next batch")
+            {
+                auto const point = Eigen::VectorXd{{-1.0, 2.0}};
+                CHECK(x().data() == buffer.data() + 2);
+                CHECK(z() == valueAt(point));
+                CHECK(d(x).isApprox(gradientAt(point)));
+            }
+        }
+        WHEN("the viewed memory changes and the function is evaluated")
+        {
+            auto batch = Eigen::VectorXd{{0.5, 1.5}};
+            x          = ConstMap<Eigen::VectorXd>(batch.data(), 2);
+            Function f(from(x), to(z));
+            batch << 3.0, -0.5;
+            f.evaluate();
+            THEN("the value is computed from the current memory")
+            {
+                CHECK(z() == valueAt(batch));
+            }
+        }
+        WHEN("copying x through the identity")
+        {
+            auto copy = var(x);
+            THEN("the copy owns its value")
+            {
+                CHECK(copy().data() != buffer.data());
+                CHECK(copy() == x());
+            }
+        }
+    }
+}
+
+SCENARIO("Array source variables viewing external memory", "[Maps]")
+{
+    auto buffer = Eigen::ArrayXd{{0.5, -2.0, 1.5}};
+
+    auto u = ArrayMap(ConstMap<Eigen::ArrayXd>(buffer.data(), 3));
+    auto v = var(square(u) * u);
+
+    Function f(from(u), to(v));
+    f.pushTangentAt(u);
+    CHECK(v().isApprox(buffer.cube()));
+    CHECK(d(v).isApprox(3.0 * buffer.square()));
+}
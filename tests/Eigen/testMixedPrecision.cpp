@@ -0,0 +1,134 @@
+#include <AutoDiff/Core>
+#include <AutoDiff/Eigen>
+
+#include <Eigen/Core>
+
+#include <catch2/catch_test_macros.hpp>
+
+#include <type_traits>
+
+using AutoDiff::Function;
+using AutoDiff::var;
+
+using Half    = Eigen::Matrix<Eigen::half, -1, 1>;
+using VectorH = AutoDiff::Variable<Half, Eigen::MatrixXd>;
+
+static_assert(std::is_same_v<
+    std::decay_t<decltype(d(std::declval<AutoDiff::VectorXfd&>()))>,
+    Eigen::MatrixXd>);
+static_assert(std::is_same_v<
+    std::decay_t<decltype(d(std::declval<AutoDiff::ArrayXfd&>()))>,
+    Eigen::ArrayXd>);
+
+SCENARIO("Differentiating float values with double derivatives",
+    "[MixedPrecision]")
+{
+    GIVEN("z = dot(exp(A x), sin(x)) + total(sqrt(x) .* x) / ||x||")
+    {
+        auto const A      = Eigen::MatrixXf{{0.5F, -1.0F}, {0.25F, 2.0F}};
+        auto const pointX = Eigen::VectorXf{{0.5F, 1.5F}};
+
+        auto x = AutoDiff::VectorXfd(pointX);
+        auto z = var(dot(exp(A * x), sin(x))
+                     + total(cwiseProduct(sqrt(x), x)) / norm(x));
+
+        // the same computation in double precision
+        auto const refA = A.cast<double>().eval();
+        auto refX       = AutoDiff::Vector(pointX.cast<double>());
+        auto refZ = var(dot(exp(refA * refX), sin(refX))
+                        + total(cwiseProduct(sqrt(refX), refX)) / norm(refX));
+
+        Function(from(refX), to(refZ)).pullGradientAt(refZ);
+
+        WHEN("pulling back the gradient of z")
+        {
+            Function f(from(x), to(z));
+            f.pullGradientAt(z);
+            THEN("the gradient is accumulated in double precision")
+            {
+                CHECK(d(x).isApprox(d(refX), 1e-6));
+            }
+        }
+        WHEN("pushing forward the tangent of x")
+        {
+            Function f(from(x), to(z));
+            f.pushTangentAt(x);
+            THEN("the derivative is correct")
+            {
+                CHECK(d(z).isApprox(d(refX), 1e-6));
+            }
+        }
+    }
+    GIVEN("the matrix product z = total(A B)")
+    {
+        auto const pointA = Eigen::MatrixXf{{0.5F, -1.0F}, {0.25F, 2.0F}};
+        auto const pointB
+            = Eigen::MatrixXf{{1.5F, 0.5F, -2.0F}, {1.0F, 3.0F, 0.5F}};
+
+        auto A = AutoDiff::MatrixXfd(pointA);
+        auto B = AutoDiff::MatrixXfd(pointB);
+        auto z = var(total(A * B));
+
+        WHEN("pulling back the gradient of z")
+        {
+            Function f(from(A, B), to(z));
+            f.pullGradientAt(z);
+            THEN("the gradients are accumulated in double precision")
+            {
+                // d total(A B) = vec(1 B^T)^T dA + vec(A^T 1)^T dB
+                auto const ones  = Eigen::MatrixXd::Ones(2, 3);
+                auto const gradA = (ones * pointB.cast<double>().transpose())
+                                       .reshaped()
+                                       .transpose()
+                                       .eval();
+                auto const gradB = (pointA.cast<double>().transpose() * ones)
+                                       .reshaped()
+                                       .transpose()
+                                       .eval();
+                CHECK(d(A).isApprox(gradA));
+                CHECK(d(B).isApprox(gradB));
+            }
+        }
+    }
+    GIVEN("the array expression y = x * exp(x) / (1 + x)")
+    {
+        auto const point = Eigen::ArrayXf{{0.5F, 1.0F, 2.0F}};
+
+        auto x = AutoDiff::ArrayXfd(point);
+        auto y = var(x * exp(x) / (1.0F + x));
+
+        auto refX = AutoDiff::Array(point.cast<double>());
+        auto refY = var(refX * exp(refX) / (1.0 + refX));
+
+        Function(from(refX), to(refY)).pullGradientAt(refY);
+
+        WHEN("pulling back the gradient of y")
+        {
+            Function f(from(x), to(y));
+            f.pullGradientAt(y);
+            THEN("the gradient is accumulated in double precision")
+            {
+                CHECK(d(x).isApprox(d(refX), 1e-6));
+            }
+        }
+    }
+    GIVEN("half-precision storage z = total(square(x))")
+    {
+        auto const point
+            = Half{{Eigen::half(0.5F), Eigen::half(-1.5F), Eigen::half(2.0F)}};
+
+        auto x = VectorH(point);
+        auto z = var(total(square(x)));
+
+        WHEN("pulling back the gradient of z")
+        {
+            Function f(from(x), to(z));
+            f.pullGradientAt(z);
+            THEN("the gradient is 2 x in double precision")
+            {
+                auto const target = Eigen::RowVector3d{1.0, -3.0, 4.0};
+                CHECK(d(x).isApprox(target));
+            }
+        }
+    }
+}
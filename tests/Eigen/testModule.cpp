@@ -2,6 +2,7 @@
 #include <AutoDiff/Eigen>
 
 #include <Eigen/Core>
+#include <unsupported/Eigen/CXX11/Tensor>
 
 #include <catch2/catch_test_macros.hpp>
 #include <catch2/matchers/catch_matchers_floating_point.hpp>
@@ -53,6 +54,128 @@ SCENARIO("Integrating Eigen Matrix module with core classes", "[Eigen]")
     CHECK(d(y).isApprox(targetDerivY, 1e-6));
 }
 
+SCENARIO("Integrating Eigen Tensor module with core classes", "[Eigen]")
+{
+    using Tensor2 = Eigen::Tensor<double, 2, 0, std::ptrdiff_t>;
+    using Tensor3 = Eigen::Tensor<double, 3, 0, std::ptrdiff_t>;
+    using Pair    = Eigen::IndexPair<int>;
+
+    auto const pairs = std::array<Pair, 1>{Pair(2, 0)};
+    auto point       = Tensor3(2, 3, 2);
+    point.setValues({{{0.5, -1.0}, {1.5, 0.25}, {-0.5, 2.0}},
+        {{1.0, 0.5}, {-1.5, 0.75}, {0.25, -0.25}}});
+    auto weights = Tensor2(2, 2);
+    weights.setValues({{1.0, -0.5}, {0.5, 2.0}});
+
+    // z = total(tanh(x . W) * x / 2)
+    auto const function = [&](Tensor3 const& x) {
+        Eigen::Tensor<double, 0, 0, std::ptrdiff_t> const total
+            = (x.contract(weights, pairs).tanh() * x).sum() / 2.0;
+        return total();
+    };
+
+    auto x = AutoDiff::Tensor3(point);
+    auto y = var(tanh(contract(x, weights, pairs)));
+    auto z = var(total(y * x / 2.0));
+
+    CHECK_THAT(z(), WithinAbsMatcher(function(point), 1e-12));
+
+    auto targetDeriv = Eigen::RowVectorXd(point.size());
+    for (Eigen::Index i = 0; i != point.size(); ++i) {
+        auto plus  = Tensor3(point);
+        auto minus = Tensor3(point);
+        plus.data()[i] += 1e-6;
+        minus.data()[i] -= 1e-6;
+        targetDeriv[i] = (function(plus) - function(minus)) / 2e-6;
+    }
+
+    Function f(from(x), to(z));
+    WHEN("pulling back the gradient of z")
+    {
+        f.pullGradientAt(z);
+        CAPTURE(d(x), targetDeriv);
+        CHECK(d(x).isApprox(targetDeriv, 1e-6));
+    }
+    WHEN("pushing forward the tangent of x")
+    {
+        f.pushTangentAt(x);
+        CAPTURE(d(z), targetDeriv);
+        CHECK(d(z).isApprox(targetDeriv, 1e-6));
+    }
+}
+
+SCENARIO("Integrating fused Eigen operations with core classes", "[Eigen]")
+{
+    auto const W       = Eigen::MatrixXd{{1.0, -0.5}, {0.5, 2.0}, {0.0, 1.0}};
+    auto const targets = Eigen::MatrixXd{{0.0, 1.0}, {1.0, 0.0}, {0.0, 0.0}};
+    auto const point   = Eigen::MatrixXd{{0.5, -1.0}, {1.5, 0.25}};
+
+    // z = crossEntropy(W x, t)
+    auto x = AutoDiff::Matrix(point);
+    auto z = var(crossEntropy(W * x, targets));
+
+    // d z = vec(W^T (softmax(W x) - t))^T d x
+    auto const logits = (W * point).eval();
+    auto softmax      = logits.array().exp().eval();
+    softmax.rowwise() /= softmax.colwise().sum();
+    auto const targetDeriv
+        = (W.transpose() * (softmax.matrix() - targets))
+              .reshaped()
+              .transpose()
+              .eval();
+
+    Function f(from(x), to(z));
+    WHEN("pulling back the gradient of z")
+    {
+        f.pullGradientAt(z);
+        CAPTURE(d(x), targetDeriv);
+        CHECK(d(x).isApprox(targetDeriv, 1e-12));
+    }
+    WHEN("pushing forward the tangent of x")
+    {
+        f.pushTangentAt(x);
+        CAPTURE(d(z), targetDeriv);
+        CHECK(d(z).isApprox(targetDeriv, 1e-12));
+    }
+}
+
+SCENARIO("Integrating broadcasting operations with core classes", "[Eigen]")
+{
+    auto const W      = Eigen::MatrixXd{{1.0, -0.5}, {0.5, 2.0}, {0.0, 1.0}};
+    auto const pointX = Eigen::MatrixXd{{0.5, -1.0}, {1.5, 0.25}};
+    auto const pointB = Eigen::VectorXd{{0.5, -1.0, 2.0}};
+
+    // z = total(y .* y) with y = W x + b, b added to each column
+    auto x = AutoDiff::Matrix(pointX);
+    auto b = AutoDiff::Vector(pointB);
+    auto y = var(W * x + b);
+    auto z = var(total(cwiseProduct(y, y)));
+
+    // d z = vec(2 W^T y)^T d x + (2 y 1)^T d b
+    auto pointY = (W * pointX).eval();
+    pointY.colwise() += pointB;
+    auto const targetDerivX
+        = (2 * W.transpose() * pointY).reshaped().transpose().eval();
+    auto const targetDerivB = (2 * pointY.rowwise().sum()).transpose().eval();
+
+    Function f(from(x, b), to(z));
+    WHEN("pulling back the gradient of z")
+    {
+        f.pullGradientAt(z);
+        CHECK(y().isApprox(pointY));
+        CAPTURE(d(x), targetDerivX);
+        CHECK(d(x).isApprox(targetDerivX, 1e-12));
+        CAPTURE(d(b), targetDerivB);
+        CHECK(d(b).isApprox(targetDerivB, 1e-12));
+    }
+    WHEN("pushing forward the tangent of b")
+    {
+        f.pushTangentAt(b);
+        CAPTURE(d(z), targetDerivB);
+        CHECK(d(z).isApprox(targetDerivB, 1e-12));
+    }
+}
+
 SCENARIO("Deduced variable types match aliases", "[Eigen]")
 {
     auto doubleVar = var(0.5);
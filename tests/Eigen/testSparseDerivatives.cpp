@@ -0,0 +1,194 @@
+#include <AutoDiff/Core>
+#include <AutoDiff/Eigen>
+
+#include <Eigen/Core>
+#include <Eigen/SparseCore>
+
+#include <catch2/catch_test_macros.hpp>
+
+using AutoDiff::Function;
+using AutoDiff::var;
+using AutoDiff::Variable;
+
+using Sparse = Eigen::SparseMatrix<double>;
+using Vector = Variable<Eigen::VectorXd, Sparse>;
+using Real   = Variable<double, Sparse>;
+
+SCENARIO("Differentiating with sparse derivatives", "[SparseDerivatives]")
+{
+    GIVEN("y = exp(x) .* x - x with sparse derivatives")
+    {
+        auto const point = Eigen::Vector4d{-1.0, 0.5, 2.0, 0.0};
+        auto x           = Vector(point);
+        auto y           = var(cwiseProduct(exp(x), x) - x);
+
+        auto const target
+            = ((point.array().exp() * (1 + point.array())) - 1).matrix().eval();
+
+        WHEN("pushing forward the tangent of x")
+        {
+            Function f(from(x), to(y));
+            f.pushTangentAt(x);
+            THEN("the derivative is sparse and correct")
+            {
+                CHECK(d(y).nonZeros() <= 4);
+                CHECK(Eigen::MatrixXd(d(y)).isApprox(
+                    Eigen::MatrixXd(target.asDiagonal())));
+            }
+        }
+        WHEN("pulling back the gradient of y")
+        {
+            Function f(from(x), to(y));
+            f.pullGradientAt(y);
+            THEN("the derivative is sparse and correct")
+            {
+                CHECK(d(x).nonZeros() <= 4);
+                CHECK(Eigen::MatrixXd(d(x)).isApprox(
+                    Eigen::MatrixXd(target.asDiagonal())));
+            }
+        }
+        AND_GIVEN("z = A * y with a dense matrix A")
+        {
+            auto const A = Eigen::Matrix4d{{1.0, 2.0, 0.0, 0.0},
+                {0.0, 1.0, -1.0, 0.0},
+                {3.0, 0.0, 1.0, 0.0},
+                {0.0, 0.0, 0.0, 2.0}};
+            auto z       = var(A * y);
+
+            auto const targetX = (A * target.asDiagonal()).eval();
+
+            WHEN("pushing forward the tangent of x")
+            {
+                Function f(from(x), to(z));
+                f.pushTangentAt(x);
+                THEN("the derivative is correct")
+                {
+                    CHECK(Eigen::MatrixXd(d(z)).isApprox(targetX));
+                }
+            }
+            WHEN("pulling back the gradient of z")
+            {
+                Function f(from(x), to(z));
+                f.pullGradientAt(z);
+                THEN("the derivative is correct")
+                {
+                    CHECK(Eigen::MatrixXd(d(x)).isApprox(targetX));
+                }
+            }
+            WHEN("reducing z to its total")
+            {
+                auto t = var(total(z));
+                Function f(from(x), to(t));
+                f.pullGradientAt(t);
+                THEN("the derivative is correct")
+                {
+                    auto const ones = Eigen::RowVector4d::Ones();
+                    CHECK(Eigen::MatrixXd(d(x)).isApprox(ones * targetX));
+                }
+            }
+        }
+    }
+    GIVEN("w = x + s and v = M * x with a scalar s and a matrix M")
+    {
+        auto x = Vector(Eigen::Vector3d{1.0, 2.0, 3.0});
+        auto s = Real(2.0);
+        auto M = Variable<Eigen::MatrixXd, Sparse>(Eigen::MatrixXd::Ones(2, 3));
+        auto w = var(x + s);
+        auto v = var(M * x);
+
+        WHEN("pushing forward the tangent of s")
+        {
+            Function f(from(x, s), to(w));
+            f.pushTangentAt(s);
+            THEN("the derivative is correct")
+            {
+                CHECK(Eigen::MatrixXd(d(w)) == Eigen::Vector3d::Ones());
+            }
+        }
+        WHEN("pulling back the gradient of w")
+        {
+            Function f(from(x, s), to(w));
+            f.pullGradientAt(w);
+            THEN("the derivatives are correct")
+            {
+                CHECK(Eigen::MatrixXd(d(x)) == Eigen::Matrix3d::Identity());
+                CHECK(Eigen::MatrixXd(d(s)) == Eigen::Vector3d::Ones());
+            }
+        }
+        WHEN("pushing forward the tangent of M")
+        {
+            Function f(from(x, M), to(v));
+            f.pushTangentAt(M);
+            THEN("the derivative is correct")
+            {
+                auto target = Eigen::MatrixXd(2, 6);
+                target << 1.0, 0.0, 2.0, 0.0, 3.0, 0.0, //
+                    0.0, 1.0, 0.0, 2.0, 0.0, 3.0;
+                CHECK(Eigen::MatrixXd(d(v)) == target);
+            }
+        }
+    }
+}
+
+SCENARIO("Gathering rows of a table with row-sparse gradients",
+    "[SparseDerivatives]")
+{
+    using RowSparse = Eigen::SparseMatrix<double, Eigen::RowMajor>;
+    using Table     = Variable<Eigen::MatrixXd, RowSparse>;
+
+    GIVEN("a lookup y = sum(gather(T, {7, 42, 7})) in a table with 1000 rows")
+    {
+        auto T = Table(Eigen::MatrixXd::Ones(1000, 3));
+        auto y = var(total(gather(T, {7, 42, 7})));
+
+        WHEN("pulling back the gradient of y")
+        {
+            Function f(y);
+            f.pullGradientAt(y);
+            THEN("only the coefficients of the gathered rows are stored")
+            {
+                CHECK(d(T).rows() == 1);
+                CHECK(d(T).cols() == 3000);
+                CHECK(d(T).nonZeros() == 6);
+                for (Eigen::Index j = 0; j != 3; ++j) {
+                    CHECK(d(T).coeff(0, 7 + 1000 * j) == 2.0);
+                    CHECK(d(T).coeff(0, 42 + 1000 * j) == 1.0);
+                }
+            }
+        }
+        WHEN("pulling back the gradient of a second lookup z = y + ...")
+        {
+            auto z = var(y + total(gather(T, {42, 999})));
+            Function f(z);
+            f.pullGradientAt(z);
+            THEN("the gradients of both lookups are accumulated sparsely")
+            {
+                CHECK(d(T).nonZeros() == 9);
+                CHECK(d(T).coeff(0, 7) == 2.0);
+                CHECK(d(T).coeff(0, 42) == 2.0);
+                CHECK(d(T).coeff(0, 999) == 1.0);
+            }
+        }
+    }
+    GIVEN("a row and a segment of a column y of a table with 1000 rows")
+    {
+        auto T = Table(Eigen::MatrixXd::Ones(1000, 3));
+        auto y = var(total(row(T, 7)) + total(segment(col(T, 2), 40, 2)));
+
+        WHEN("pulling back the gradient of y")
+        {
+            Function f(y);
+            f.pullGradientAt(y);
+            THEN("only the coefficients of the blocks are stored")
+            {
+                CHECK(d(T).cols() == 3000);
+                CHECK(d(T).nonZeros() == 5);
+                for (Eigen::Index j = 0; j != 3; ++j) {
+                    CHECK(d(T).coeff(0, 7 + 1000 * j) == 1.0);
+                }
+                CHECK(d(T).coeff(0, 2040) == 1.0);
+                CHECK(d(T).coeff(0, 2041) == 1.0);
+            }
+        }
+    }
+}
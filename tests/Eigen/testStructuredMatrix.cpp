@@ -0,0 +1,176 @@
+#include <AutoDiff/Core>
+#include <AutoDiff/Eigen>
+
+#include <Eigen/Core>
+
+#include <catch2/catch_test_macros.hpp>
+
+using AutoDiff::Function;
+using AutoDiff::var;
+using AutoDiff::Variable;
+using AutoDiff::EigenAD::StructuredMatrix;
+
+using Structured = StructuredMatrix<double>;
+using Vector     = Variable<Eigen::VectorXd, Structured>;
+using Real       = Variable<double, Structured>;
+
+SCENARIO("Arithmetic of structured matrices", "[StructuredMatrix]")
+{
+    GIVEN("an identity matrix and a diagonal Eigen matrix")
+    {
+        auto const identity = Structured::Identity(3, 3);
+        auto const coeffs   = Eigen::Vector3d{1.0, 2.0, 3.0};
+
+        THEN("scaling preserves the structure")
+        {
+            auto const scaled = 2 * identity;
+            CHECK(scaled.structure() == Structured::scaledIdentity);
+            CHECK(scaled.scale() == 2.0);
+        }
+        THEN("multiplying with a diagonal matrix yields a diagonal matrix")
+        {
+            auto const product = coeffs.asDiagonal() * identity;
+            REQUIRE(product.structure() == Structured::diagonal);
+            CHECK(product.diagonalCoeffs() == coeffs);
+            auto const reverse = identity * coeffs.asDiagonal();
+            CHECK(reverse.structure() == Structured::diagonal);
+        }
+        THEN("scaling a non-square zero matrix yields a zero matrix")
+        {
+            auto const product = Structured::Zero(1, 3) * coeffs.asDiagonal();
+            REQUIRE(product.structure() == Structured::zero);
+            CHECK(product.rows() == 1);
+            CHECK(product.cols() == 3);
+            auto const reverse = coeffs.asDiagonal() * Structured::Zero(3, 2);
+            REQUIRE(reverse.structure() == Structured::zero);
+            CHECK(reverse.cols() == 2);
+        }
+        THEN("adding diagonal matrices yields a diagonal matrix")
+        {
+            auto const sum = identity - Structured::Diagonal(coeffs);
+            REQUIRE(sum.structure() == Structured::diagonal);
+            CHECK(sum.diagonalCoeffs() == Eigen::Vector3d{0.0, -1.0, -2.0});
+        }
+        THEN("adding a zero matrix preserves the structure")
+        {
+            auto const sum = Structured::Zero(3, 3) + identity;
+            CHECK(sum.structure() == Structured::scaledIdentity);
+        }
+        THEN("multiplying with a dense matrix yields a dense matrix")
+        {
+            auto const dense   = Eigen::Matrix3d::Constant(2.0);
+            auto const product = dense * Structured::Diagonal(coeffs);
+            REQUIRE(product.structure() == Structured::dense);
+            CHECK(product.denseCoeffs() == dense * coeffs.asDiagonal());
+            auto const sum = product + identity;
+            REQUIRE(sum.structure() == Structured::dense);
+            CHECK(sum.toDense()
+                  == dense * coeffs.asDiagonal()
+                         + Eigen::Matrix3d::Identity());
+        }
+        THEN("broadcasting yields the dense result")
+        {
+            auto const diagonal = Structured::Diagonal(coeffs);
+            CHECK(diagonal.colwise().sum().toDense()
+                  == coeffs.transpose().eval());
+            CHECK(diagonal.rowwise().sum().toDense() == coeffs);
+            CHECK(diagonal.row(1).toDense()
+                  == Eigen::RowVector3d{0.0, 2.0, 0.0});
+            CHECK(diagonal.replicate(1, 2).cols() == 6);
+        }
+    }
+}
+
+SCENARIO("Differentiating elementwise operations with structured "
+         "derivatives",
+    "[StructuredMatrix]")
+{
+    GIVEN("y = exp(x) + square(x) - x with structured derivatives")
+    {
+        auto const point = Eigen::Vector3d{-1.0, 0.5, 2.0};
+        auto x           = Vector(point);
+        auto y           = var(exp(x) + square(x) - x);
+
+        auto const target = (point.array().exp() + 2 * point.array() - 1)
+                                .matrix()
+                                .eval();
+
+        WHEN("pushing forward the tangent of x")
+        {
+            Function f(from(x), to(y));
+            f.pushTangentAt(x);
+            THEN("the derivative is diagonal")
+            {
+                REQUIRE(d(y).structure() == Structured::diagonal);
+                CHECK(d(y).diagonalCoeffs().isApprox(target));
+            }
+        }
+        WHEN("pulling back the gradient of y")
+        {
+            Function f(from(x), to(y));
+            f.pullGradientAt(y);
+            THEN("the derivative is diagonal")
+            {
+                REQUIRE(d(x).structure() == Structured::diagonal);
+                CHECK(d(x).diagonalCoeffs().isApprox(target));
+            }
+        }
+        AND_GIVEN("z = A * y + s * y with dense matrix A and scalar s")
+        {
+            auto const A = Eigen::Matrix3d{
+                {1.0, 2.0, 0.0}, {0.0, 1.0, -1.0}, {3.0, 0.0, 1.0}};
+            auto s = Real(2.0);
+            auto z = var(A * y + y * s);
+
+            auto const targetX = ((A + 2 * Eigen::Matrix3d::Identity())
+                                  * target.asDiagonal())
+                                     .eval();
+            auto const ones    = Eigen::Vector3d::Ones();
+            auto const targetS = (exp(point.array()) + point.array().square()
+                                  - point.array())
+                                     .matrix()
+                                     .eval();
+
+            WHEN("pushing forward the tangent of x")
+            {
+                Function f(from(x, s), to(z));
+                f.pushTangentAt(x);
+                THEN("the dense derivative is correct")
+                {
+                    REQUIRE(d(z).structure() == Structured::dense);
+                    CHECK(d(z).denseCoeffs().isApprox(targetX));
+                }
+            }
+            WHEN("pulling back the gradient of z")
+            {
+                Function f(from(x, s), to(z));
+                f.pullGradientAt(z);
+                THEN("the dense derivatives are correct")
+                {
+                    CHECK(d(x).toDense().isApprox(targetX));
+                    CHECK(d(s).toDense().isApprox(targetS));
+                }
+            }
+            WHEN("pushing forward the tangent of s by w = y + s")
+            {
+                auto w = var(y + s);
+                Function f(from(x, s), to(w));
+                f.pushTangentAt(s);
+                THEN("the dense derivative is correct")
+                {
+                    CHECK(d(w).toDense() == ones);
+                }
+            }
+            WHEN("reducing z to its total")
+            {
+                auto t = var(total(z));
+                Function f(from(x, s), to(t));
+                f.pullGradientAt(t);
+                THEN("the dense derivative is correct")
+                {
+                    CHECK(d(x).toDense().isApprox(ones.transpose() * targetX));
+                }
+            }
+        }
+    }
+}